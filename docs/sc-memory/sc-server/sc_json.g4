@@ -238,7 +238,23 @@ sc_json_command_answer_handle_link_contents
 
 sc_json_command_search_template
   : '"type"' ':' '"search_template"' ','
-    sc_json_command_template_payload
+    (sc_json_command_template_payload | sc_json_command_template_next_page_payload)
+  ;
+
+// Next page of found sc-constructions is got by cursor returned with the previous full page, cursor is kept by sc-server
+// until all sc-constructions are found
+sc_json_command_template_next_page_payload
+  : '"payload"' ':'
+    '{'
+        '"cursor"' ':' NUMBER ','
+        ('"limit"' ':' NUMBER ',')?
+    '}' ','
+  ;
+
+// "offset" and "limit" are used only by search_template to get page of found sc-constructions
+sc_json_command_template_page
+  : ('"offset"' ':' NUMBER ',')?
+    ('"limit"' ':' NUMBER ',')?
   ;
 
 sc_json_command_template_payload
@@ -288,6 +304,7 @@ sc_json_command_template_payload
         '{'
             (SC_ALIAS ':' (SC_ADDR_HASH | SC_ALIAS) ',')*
         '}' ','
+        sc_json_command_template_page
     '}' ','
   ;
 
@@ -308,6 +325,7 @@ sc_json_command_answer_search_template
         '{'
             (SC_ALIAS ':' NUMBER ',')*
         '}' ','
+        ('"cursor"' ':' NUMBER ',')?
     '}' ','
   ;
 
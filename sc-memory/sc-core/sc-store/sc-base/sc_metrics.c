@@ -0,0 +1,129 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_metrics.h"
+
+#include "sc_atomic.h"
+#include "sc_thread.h"
+
+#define SC_METRICS_SHARDS_COUNT 8
+
+// counters are pointer-sized to be updated by atomic operations
+typedef gssize sc_metrics_counter;
+
+#define _sc_metrics_counter_add(counter, value) sc_atomic_pointer_add(counter, value)
+#define _sc_metrics_counter_get(counter) ((sc_uint64)sc_atomic_pointer_get(counter))
+#define _sc_metrics_counter_set(counter, value) sc_atomic_pointer_set(counter, value)
+
+typedef struct
+{
+  sc_metrics_counter count;
+  sc_metrics_counter total_time;
+  sc_metrics_counter histogram[SC_METRIC_HISTOGRAM_BUCKETS_COUNT];
+} sc_metrics_shard_metric;
+
+typedef struct
+{
+  sc_metrics_shard_metric metrics[SC_METRICS_COUNT];
+} sc_metrics_shard;
+
+// counters are global, because monitors and fs-memory are used before sc-storage is initialized
+sc_metrics_shard sc_metrics_shards[SC_METRICS_SHARDS_COUNT];
+
+sc_char const * sc_metrics_names[SC_METRICS_COUNT] = {
+    "element_allocation",
+    "element_erasure",
+    "iterator_creation",
+    "iterator_step",
+    "monitor_wait",
+    "fs_memory_read",
+    "fs_memory_write",
+    "event_wait",
+    "event_run",
+    "template_search_prepare",
+    "template_search_run",
+};
+
+sc_uint32 _sc_metrics_get_shard_idx()
+{
+  // threads are allocated in heap, so the lowest bits of their pointers are the same
+  return (GPOINTER_TO_UINT(sc_thread_self()) >> 6) % SC_METRICS_SHARDS_COUNT;
+}
+
+sc_uint32 _sc_metrics_get_bucket_idx(sc_int64 time)
+{
+  sc_uint32 bucket_idx = 0;
+  while (time > 0 && bucket_idx < SC_METRIC_HISTOGRAM_BUCKETS_COUNT - 1)
+  {
+    time >>= 1;
+    ++bucket_idx;
+  }
+  return bucket_idx;
+}
+
+sc_int64 sc_metrics_get_time()
+{
+  return g_get_monotonic_time();
+}
+
+void sc_metrics_record(sc_metric metric, sc_int64 time)
+{
+  sc_metrics_record_batch(metric, 1, time);
+}
+
+void sc_metrics_record_batch(sc_metric metric, sc_uint32 count, sc_int64 time)
+{
+  if (count == 0)
+    return;
+
+  if (time < 0)
+    time = 0;
+
+  sc_metrics_shard_metric * shard_metric = &sc_metrics_shards[_sc_metrics_get_shard_idx()].metrics[metric];
+  _sc_metrics_counter_add(&shard_metric->count, count);
+  _sc_metrics_counter_add(&shard_metric->total_time, time);
+  _sc_metrics_counter_add(&shard_metric->histogram[_sc_metrics_get_bucket_idx(time / count)], count);
+}
+
+void sc_metrics_get_stat(sc_metrics_stat * stat)
+{
+  *stat = (sc_metrics_stat){0};
+
+  for (sc_uint32 shard_idx = 0; shard_idx < SC_METRICS_SHARDS_COUNT; ++shard_idx)
+  {
+    for (sc_uint32 metric = 0; metric < SC_METRICS_COUNT; ++metric)
+    {
+      sc_metrics_shard_metric * shard_metric = &sc_metrics_shards[shard_idx].metrics[metric];
+      sc_metric_stat * metric_stat = &stat->metrics[metric];
+
+      metric_stat->count += _sc_metrics_counter_get(&shard_metric->count);
+      metric_stat->total_time += _sc_metrics_counter_get(&shard_metric->total_time);
+      for (sc_uint32 i = 0; i < SC_METRIC_HISTOGRAM_BUCKETS_COUNT; ++i)
+        metric_stat->histogram[i] += _sc_metrics_counter_get(&shard_metric->histogram[i]);
+    }
+  }
+}
+
+void sc_metrics_reset()
+{
+  for (sc_uint32 shard_idx = 0; shard_idx < SC_METRICS_SHARDS_COUNT; ++shard_idx)
+  {
+    for (sc_uint32 metric = 0; metric < SC_METRICS_COUNT; ++metric)
+    {
+      sc_metrics_shard_metric * shard_metric = &sc_metrics_shards[shard_idx].metrics[metric];
+
+      _sc_metrics_counter_set(&shard_metric->count, 0);
+      _sc_metrics_counter_set(&shard_metric->total_time, 0);
+      for (sc_uint32 i = 0; i < SC_METRIC_HISTOGRAM_BUCKETS_COUNT; ++i)
+        _sc_metrics_counter_set(&shard_metric->histogram[i], 0);
+    }
+  }
+}
+
+sc_char const * sc_metrics_get_name(sc_metric metric)
+{
+  return metric < SC_METRICS_COUNT ? sc_metrics_names[metric] : null_ptr;
+}
@@ -0,0 +1,101 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_metrics_h_
+#define _sc_metrics_h_
+
+#include "../sc_types.h"
+
+//! Operations of sc-memory which counts and latencies are measured.
+typedef enum
+{
+  SC_METRIC_ELEMENT_ALLOCATION,       // allocation of sc-elements in segments of sc-storage
+  SC_METRIC_ELEMENT_ERASURE,          // erasure of sc-elements with their incident sc-connectors
+  SC_METRIC_ITERATOR_CREATION,        // creation of sc-iterators3, including inner ones of sc-iterators5
+  SC_METRIC_ITERATOR_STEP,            // steps of sc-iterators3, including inner ones of sc-iterators5
+  SC_METRIC_MONITOR_WAIT,             // waiting for acquiring of monitors
+  SC_METRIC_FS_MEMORY_READ,           // reading of contents of sc-links from fs-memory
+  SC_METRIC_FS_MEMORY_WRITE,          // writing of contents of sc-links to fs-memory
+  SC_METRIC_EVENT_WAIT,               // waiting of sc-events in the queue
+  SC_METRIC_EVENT_RUN,                // processing of sc-events
+  SC_METRIC_TEMPLATE_SEARCH_PREPARE,  // ordering of triples of sc-templates before search
+  SC_METRIC_TEMPLATE_SEARCH_RUN,      // search of constructions by ordered triples of sc-templates
+
+  SC_METRICS_COUNT
+} sc_metric;
+
+/*! Count of buckets of latency histograms. The first bucket counts operations lasted less than 1 microsecond, the
+ * bucket i counts operations lasted from 2^(i-1) to 2^i microseconds, the last bucket counts all longer operations.
+ */
+#define SC_METRIC_HISTOGRAM_BUCKETS_COUNT 24
+
+//! Counters of operation of sc-memory.
+typedef struct
+{
+  sc_uint64 count;       // amount of measured operations
+  sc_uint64 total_time;  // total time (in microseconds) of measured operations
+  sc_uint64 histogram[SC_METRIC_HISTOGRAM_BUCKETS_COUNT];
+} sc_metric_stat;
+
+//! Snapshot of counters of all measured operations of sc-memory.
+typedef struct
+{
+  sc_metric_stat metrics[SC_METRICS_COUNT];
+} sc_metrics_stat;
+
+/*! Metrics are collected only if sc-machine is built with option SC_MEMORY_METRICS, otherwise measurement macros are
+ * expanded to nothing and all counters are zero. Counters are split into shards chosen by calling thread, as counters
+ * of sc-storage statistics, so measurements don't contend for the same cache lines.
+ */
+#ifdef SC_MEMORY_METRICS
+#  define SC_METRICS_ENABLED SC_TRUE
+#  define SC_METRICS_START(_start_time) sc_int64 const _start_time = sc_metrics_get_time()
+#  define SC_METRICS_RECORD(_metric, _start_time) sc_metrics_record(_metric, sc_metrics_get_time() - (_start_time))
+#  define SC_METRICS_RECORD_TIME(_metric, _time) sc_metrics_record(_metric, _time)
+#  define SC_METRICS_RECORD_BATCH(_metric, _start_time, _count) \
+    sc_metrics_record_batch(_metric, _count, sc_metrics_get_time() - (_start_time))
+#else
+#  define SC_METRICS_ENABLED SC_FALSE
+#  define SC_METRICS_START(_start_time)
+#  define SC_METRICS_RECORD(_metric, _start_time)
+#  define SC_METRICS_RECORD_TIME(_metric, _time)
+#  define SC_METRICS_RECORD_BATCH(_metric, _start_time, _count)
+#endif
+
+/*! Gets monotonic time used to measure latencies of operations.
+ * @returns Returns time in microseconds.
+ */
+_SC_EXTERN sc_int64 sc_metrics_get_time();
+
+/*! Counts operation and adds its latency to counters of the specified metric.
+ * @param metric A measured operation.
+ * @param time A latency (in microseconds) of operation.
+ */
+_SC_EXTERN void sc_metrics_record(sc_metric metric, sc_int64 time);
+
+/*! Counts several operations performed at once and adds their latency to counters of the specified metric. Each
+ * operation is put into the histogram bucket of their average latency.
+ * @param metric A measured operation.
+ * @param count A count of operations.
+ * @param time A total latency (in microseconds) of operations.
+ */
+_SC_EXTERN void sc_metrics_record_batch(sc_metric metric, sc_uint32 count, sc_int64 time);
+
+/*! Sums counters of all metrics over shards.
+ * @param stat A pointer to structure to store counters.
+ */
+_SC_EXTERN void sc_metrics_get_stat(sc_metrics_stat * stat);
+
+//! Resets counters of all metrics.
+_SC_EXTERN void sc_metrics_reset();
+
+/*! Gets name of the specified metric.
+ * @param metric A measured operation.
+ * @returns Returns name of metric, for example, "element_allocation".
+ */
+_SC_EXTERN sc_char const * sc_metrics_get_name(sc_metric metric);
+
+#endif  // _sc_metrics_h_
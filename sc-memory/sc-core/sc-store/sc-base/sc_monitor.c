@@ -6,6 +6,7 @@
 
 #include "sc_monitor.h"
 #include "sc_allocator.h"
+#include "sc_metrics.h"
 
 #define SC_MONITOR_FREE_PERIOD_CHECK 10
 
@@ -70,6 +71,7 @@ void sc_monitor_acquire_read(sc_monitor * monitor)
     return;
 
   sc_monitor_acquire(monitor);
+  SC_METRICS_START(start_time);
 
   sc_mutex_lock(&monitor->rw_mutex);
 
@@ -85,6 +87,8 @@ void sc_monitor_acquire_read(sc_monitor * monitor)
   ++monitor->active_readers;
 
   sc_mutex_unlock(&monitor->rw_mutex);
+
+  SC_METRICS_RECORD(SC_METRIC_MONITOR_WAIT, start_time);
 }
 
 void sc_monitor_release_read(sc_monitor * monitor)
@@ -112,6 +116,7 @@ void sc_monitor_acquire_write(sc_monitor * monitor)
     return;
 
   sc_monitor_acquire(monitor);
+  SC_METRICS_START(start_time);
 
   sc_mutex_lock(&monitor->rw_mutex);
 
@@ -127,6 +132,8 @@ void sc_monitor_acquire_write(sc_monitor * monitor)
   monitor->active_writer = 1;
 
   sc_mutex_unlock(&monitor->rw_mutex);
+
+  SC_METRICS_RECORD(SC_METRIC_MONITOR_WAIT, start_time);
 }
 
 void sc_monitor_release_write(sc_monitor * monitor)
@@ -24,6 +24,10 @@ typedef GHashTable sc_hash_table;
 
 #define sc_hash_table_remove(table, key) g_hash_table_remove(table, key)
 
+#define sc_hash_table_remove_all(table) g_hash_table_remove_all(table)
+
+#define sc_hash_table_steal(table, key) g_hash_table_steal(table, key)
+
 #define sc_hash_table_default_hash_func g_direct_hash
 
 #define sc_hash_table_default_equal_func g_direct_equal
@@ -34,6 +38,8 @@ typedef GSList sc_hash_table_list;
 
 #define sc_hash_table_list_append(list, value) g_slist_append(list, value)
 
+#define sc_hash_table_list_prepend(list, value) g_slist_prepend(list, value)
+
 #define sc_hash_table_list_remove(list, value) g_slist_remove(list, value)
 
 #define sc_hash_table_list_remove_sublist(list, sublist) g_slist_delete_link(list, sublist)
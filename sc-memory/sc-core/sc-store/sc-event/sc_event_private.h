@@ -35,6 +35,11 @@ struct _sc_event_subscription
   sc_monitor monitor;
   //! Count of references (users) of this sc-event subscription
   sc_uint32 ref_count;
+  //! Counters of statistics of sc-events processing by this sc-event subscription. They are changed atomically.
+  sc_event_subscription_stat_counters stat;
+  //! Flag indicating whether sc-events of this subscription are processed one by one in order of their emission
+  //! together with sc-events of other subscriptions with ordered delivery of the same sc-element
+  sc_bool is_ordered_delivery;
 };
 
 /*! Notify about sc-element deletion.
@@ -44,6 +49,13 @@ struct _sc_event_subscription
  */
 sc_result sc_event_notify_element_deleted(sc_addr addr);
 
+/*! Notify about deletion of several sc-elements at once.
+ * @param addrs sc-addresses of deleted sc-elements
+ * @param count count of deleted sc-elements
+ * @remarks Table of events is locked once for all sc-elements.
+ */
+sc_result sc_event_notify_elements_deleted(sc_addr const * addrs, sc_uint32 count);
+
 /*! Emits event with \p type for sc-element \p subscription_addr with argument \p arg.
  * If \ctx is in a pending mode, then event will be pend for emit
  * @param ctx A pointer to context, that emits event
@@ -80,4 +92,13 @@ sc_result sc_event_emit_impl(
     sc_event_do_after_callback callback,
     sc_addr event_addr);
 
+/*! Emits the list of pending events immediately. All events are added to the sc-event emission manager as one batch.
+ * @param ctx A pointer to context, that emits events
+ * @param events A list of pending events (`sc_event_emit_params`) in order of their emission. Cancelled events are
+ * skipped.
+ * @note If no one event with an after-callback is emitted for the argument of this callback, then the callback is
+ * called immediately.
+ */
+void sc_event_emit_batch_impl(sc_memory_context const * ctx, sc_hash_table_list * events);
+
 #endif
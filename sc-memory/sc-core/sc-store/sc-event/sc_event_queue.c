@@ -15,6 +15,11 @@
 #include "../../sc_memory.h"
 
 #include "../sc-base/sc_allocator.h"
+#include "../sc-base/sc_atomic.h"
+#include "../sc-base/sc_metrics.h"
+
+#define _sc_event_stat_counter_add(counter, value) sc_atomic_pointer_add(counter, value)
+#define _sc_event_stat_counter_get(counter) ((sc_uint64)sc_atomic_pointer_get(counter))
 
 /*! Structure representing elementary sc-event.
  * @note This structure holds information required for processing events in a worker thread.
@@ -29,8 +34,17 @@ typedef struct
   sc_event_do_after_callback callback;  ///< A pointer to function that is executed after the execution of a function
                                         ///< that was called on the initiated event.
   sc_addr event_addr;                   ///< An argument of callback.
+  sc_int64 emission_time;               ///< Monotonic time (in microseconds) when the event was queued.
+  sc_pointer ordered_events_key;        ///< Key of the subscription sc-element if the event is delivered in order of
+                                        ///< emission, null_ptr otherwise.
 } sc_event;
 
+#define _sc_event_ordered_events_key(event_subscription) \
+  GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT((event_subscription)->subscription_addr))
+
+//! Key of thread-local flag set in threads of sc-events processing.
+static GPrivate emission_worker_key;
+
 sc_event * _sc_event_new(
     sc_event_subscription * event_subscription,
     sc_addr user_addr,
@@ -48,6 +62,7 @@ sc_event * _sc_event_new(
   event->other_addr = other_addr;
   event->callback = callback;
   event->event_addr = event_addr;
+  event->emission_time = g_get_monotonic_time();
 
   return event;
 }
@@ -57,14 +72,14 @@ void _sc_event_emission_pool_worker_data_destroy(sc_event * data)
   sc_mem_free(data);
 }
 
-/*! Function that represents the work performed by a worker in the sc-event emission pool.
- * @param data Pointer to the sc_event containing information about the work.
- * @param user_data Pointer to the sc_event_emission_manager managing the sc-event emission.
+/*! Function that processes an sc-event and destroys it.
+ * @param queue Pointer to the sc_event_emission_manager managing the sc-event emission.
+ * @param event Pointer to the sc_event to be processed.
  */
-void _sc_event_emission_pool_worker(sc_pointer data, sc_pointer user_data)
+void _sc_event_emission_pool_worker_process_event(sc_event_emission_manager * queue, sc_event * event)
 {
-  sc_event * event = (sc_event *)data;
-  sc_event_emission_manager * queue = user_data;
+  sc_int64 const start_time = g_get_monotonic_time();
+  sc_int64 run_time = 0;
 
   sc_event_subscription * event_subscription = event->event_subscription;
   if (event_subscription == null_ptr)
@@ -95,6 +110,13 @@ void _sc_event_emission_pool_worker(sc_pointer data, sc_pointer user_data)
 
   sc_storage_end_new_process();
 
+  run_time = g_get_monotonic_time() - start_time;
+  SC_METRICS_RECORD_TIME(SC_METRIC_EVENT_RUN, run_time);
+
+  _sc_event_stat_counter_add(&event_subscription->stat.processed_events_count, 1);
+  _sc_event_stat_counter_add(&event_subscription->stat.events_wait_time, start_time - event->emission_time);
+  _sc_event_stat_counter_add(&event_subscription->stat.events_run_time, run_time);
+
   sc_monitor_release_read(&event_subscription->monitor);
 
 end:
@@ -108,10 +130,85 @@ destroy:
     sc_memory_context_free(ctx);
   }
 
+  _sc_event_stat_counter_add(&queue->stat.processed_events_count, 1);
+  _sc_event_stat_counter_add(&queue->stat.events_wait_time, start_time - event->emission_time);
+  _sc_event_stat_counter_add(&queue->stat.events_run_time, run_time);
+
+  sc_atomic_int_add(&queue->queue_size, -1);
+  // Emitters increase the amount of waiting emitters before they check size of the queue, so they aren't missed here
+  if (sc_atomic_int_get(&queue->blocked_emitters_count) != 0)
+  {
+    sc_mutex_lock(&queue->queue_mutex);
+    sc_cond_broadcast(&queue->queue_condition);
+    sc_mutex_unlock(&queue->queue_mutex);
+  }
+
+  SC_METRICS_RECORD_TIME(SC_METRIC_EVENT_WAIT, start_time - event->emission_time);
+
   _sc_event_emission_pool_worker_data_destroy(event);
 }
 }
 
+/*! Function that destroys a queue of sc-events with ordered delivery of a subscription sc-element.
+ * @param data Pointer to the queue of sc-events.
+ */
+static void _sc_event_ordered_events_destroy(sc_pointer data)
+{
+  sc_queue * ordered_events = data;
+  sc_queue_destroy(ordered_events);
+  sc_mem_free(ordered_events);
+}
+
+/*! Function that gets the next sc-event with ordered delivery of a subscription sc-element.
+ * @param queue Pointer to the sc_event_emission_manager managing the sc-event emission.
+ * @param ordered_events_key Key of the subscription sc-element.
+ * @return Returns the next sc-event or null_ptr if there are no sc-events of the subscription sc-element waiting for
+ * processing. In the latter case the queue of the subscription sc-element is removed.
+ */
+static sc_event * _sc_event_emission_pool_worker_next_ordered_event(
+    sc_event_emission_manager * queue,
+    sc_pointer ordered_events_key)
+{
+  sc_event * event = null_ptr;
+
+  sc_mutex_lock(&queue->ordered_events_mutex);
+  sc_queue * ordered_events = sc_hash_table_get(queue->ordered_events_table, ordered_events_key);
+  if (sc_queue_empty(ordered_events))
+    sc_hash_table_remove(queue->ordered_events_table, ordered_events_key);
+  else
+    event = sc_queue_pop(ordered_events);
+  sc_mutex_unlock(&queue->ordered_events_mutex);
+
+  return event;
+}
+
+/*! Function that represents the work performed by a worker in the sc-event emission pool.
+ * @param data Pointer to the sc_event containing information about the work.
+ * @param user_data Pointer to the sc_event_emission_manager managing the sc-event emission.
+ */
+void _sc_event_emission_pool_worker(sc_pointer data, sc_pointer user_data)
+{
+  sc_event * event = (sc_event *)data;
+  sc_event_emission_manager * queue = user_data;
+
+  // The flag is set only while the worker processes sc-events and then restored for other tasks of the thread
+  sc_pointer const is_emission_worker = g_private_get(&emission_worker_key);
+  g_private_set(&emission_worker_key, GINT_TO_POINTER(SC_TRUE));
+
+  sc_pointer const ordered_events_key = event->ordered_events_key;
+  _sc_event_emission_pool_worker_process_event(queue, event);
+
+  // Sc-events with ordered delivery of the same subscription sc-element emitted while the previous one was processed
+  // are processed here
+  if (ordered_events_key != null_ptr)
+  {
+    while ((event = _sc_event_emission_pool_worker_next_ordered_event(queue, ordered_events_key)) != null_ptr)
+      _sc_event_emission_pool_worker_process_event(queue, event);
+  }
+
+  g_private_set(&emission_worker_key, is_emission_worker);
+}
+
 void sc_event_emission_manager_initialize(sc_event_emission_manager ** manager, sc_memory_params const * params)
 {
   *manager = sc_mem_new(sc_event_emission_manager, 1);
@@ -128,8 +225,23 @@ void sc_event_emission_manager_initialize(sc_event_emission_manager ** manager,
         "\tLimit max threads by max physical cores: %s",
         (*manager)->limit_max_threads_by_max_physical_cores ? "On" : "Off");
     sc_message("\tMax events and agents threads: %d", (*manager)->max_events_and_agents_threads);
+    if (params->max_events_queue_size == 0)
+      sc_message("\tMax events queue size: Unbounded");
+    else
+      sc_message(
+          "\tMax events queue size: %d (%s on overflow)",
+          params->max_events_queue_size,
+          params->events_queue_overflow_mode == SC_EVENTS_QUEUE_OVERFLOW_DROP ? "Drop" : "Block");
   }
 
+  (*manager)->max_events_queue_size = params->max_events_queue_size;
+  (*manager)->events_queue_overflow_mode = params->events_queue_overflow_mode;
+  sc_mutex_init(&(*manager)->queue_mutex);
+  sc_cond_init(&(*manager)->queue_condition);
+  sc_mutex_init(&(*manager)->ordered_events_mutex);
+  (*manager)->ordered_events_table = sc_hash_table_init(
+      sc_hash_table_default_hash_func, sc_hash_table_default_equal_func, null_ptr, _sc_event_ordered_events_destroy);
+
   (*manager)->running = SC_TRUE;
   sc_monitor_init(&(*manager)->destroy_monitor);
 
@@ -185,10 +297,87 @@ void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager)
 
   sc_monitor_destroy(&manager->pool_monitor);
   sc_monitor_destroy(&manager->destroy_monitor);
+  sc_hash_table_destroy(manager->ordered_events_table);
+  sc_mutex_destroy(&manager->ordered_events_mutex);
+  sc_cond_destroy(&manager->queue_condition);
+  sc_mutex_destroy(&manager->queue_mutex);
   sc_mem_free(manager);
 }
 
-void _sc_event_emission_manager_add(
+void _sc_event_emission_manager_wait_for_queue(sc_event_emission_manager * manager)
+{
+  if (manager == null_ptr || manager->max_events_queue_size == 0
+      || manager->events_queue_overflow_mode != SC_EVENTS_QUEUE_OVERFLOW_BLOCK)
+    return;
+
+  // Threads of sc-events processing must not wait for themselves
+  if (g_private_get(&emission_worker_key) != null_ptr)
+    return;
+
+  if (sc_atomic_int_get(&manager->queue_size) < manager->max_events_queue_size)
+    return;
+
+  _sc_event_stat_counter_add(&manager->stat.blocked_emissions_count, 1);
+
+  sc_mutex_lock(&manager->queue_mutex);
+  sc_atomic_int_inc(&manager->blocked_emitters_count);
+  while (sc_atomic_int_get(&manager->queue_size) >= manager->max_events_queue_size)
+    sc_cond_wait(&manager->queue_condition, &manager->queue_mutex);
+  sc_atomic_int_add(&manager->blocked_emitters_count, -1);
+  sc_mutex_unlock(&manager->queue_mutex);
+}
+
+void _sc_event_emission_manager_set_ordered_delivery(
+    sc_event_emission_manager * manager,
+    sc_event_subscription * event_subscription,
+    sc_bool is_ordered_delivery)
+{
+  if (manager == null_ptr)
+    return;
+
+  sc_mutex_lock(&manager->ordered_events_mutex);
+  event_subscription->is_ordered_delivery = is_ordered_delivery;
+  sc_mutex_unlock(&manager->ordered_events_mutex);
+}
+
+void sc_event_emission_manager_get_stat(sc_event_emission_manager * manager, sc_events_stat * stat)
+{
+  if (manager == null_ptr)
+  {
+    *stat = (sc_events_stat){0};
+    return;
+  }
+
+  stat->queue_size = sc_atomic_int_get(&manager->queue_size);
+  stat->max_queue_size = manager->max_events_queue_size;
+  stat->processed_events_count = _sc_event_stat_counter_get(&manager->stat.processed_events_count);
+  stat->dropped_events_count = _sc_event_stat_counter_get(&manager->stat.dropped_events_count);
+  stat->blocked_emissions_count = _sc_event_stat_counter_get(&manager->stat.blocked_emissions_count);
+  stat->events_wait_time = _sc_event_stat_counter_get(&manager->stat.events_wait_time);
+  stat->events_run_time = _sc_event_stat_counter_get(&manager->stat.events_run_time);
+}
+
+void sc_event_emission_manager_get_subscription_stat(
+    sc_event_emission_manager * manager,
+    sc_event_subscription const * event_subscription,
+    sc_event_subscription_stat * stat)
+{
+  sc_unused(manager);
+
+  stat->processed_events_count = _sc_event_stat_counter_get(&event_subscription->stat.processed_events_count);
+  stat->events_wait_time = _sc_event_stat_counter_get(&event_subscription->stat.events_wait_time);
+  stat->events_run_time = _sc_event_stat_counter_get(&event_subscription->stat.events_run_time);
+}
+
+void _sc_event_emission_manager_batch_begin(sc_event_emission_manager * manager)
+{
+  if (manager == null_ptr)
+    return;
+
+  sc_monitor_acquire_write(&manager->pool_monitor);
+}
+
+void _sc_event_emission_manager_batch_add(
     sc_event_emission_manager * manager,
     sc_event_subscription * event_subscription,
     sc_addr user_addr,
@@ -201,10 +390,73 @@ void _sc_event_emission_manager_add(
   if (manager == null_ptr)
     return;
 
+  // Events with callbacks are never dropped, because callbacks erase sc-elements after the events processing.
+  if (manager->max_events_queue_size != 0 && manager->events_queue_overflow_mode == SC_EVENTS_QUEUE_OVERFLOW_DROP
+      && callback == null_ptr)
+  {
+    sc_uint32 queue_size;
+    do
+    {
+      queue_size = sc_atomic_int_get(&manager->queue_size);
+      if (queue_size >= manager->max_events_queue_size)
+      {
+        _sc_event_stat_counter_add(&manager->stat.dropped_events_count, 1);
+        return;
+      }
+    } while (!sc_atomic_int_compare_and_exchange(&manager->queue_size, queue_size, queue_size + 1));
+  }
+  else
+    sc_atomic_int_inc(&manager->queue_size);
+
   sc_event * event =
       _sc_event_new(event_subscription, user_addr, connector_addr, connector_type, other_addr, callback, event_addr);
 
-  sc_monitor_acquire_write(&manager->pool_monitor);
+  if (event_subscription != null_ptr)
+  {
+    sc_mutex_lock(&manager->ordered_events_mutex);
+    if (event_subscription->is_ordered_delivery)
+    {
+      event->ordered_events_key = _sc_event_ordered_events_key(event_subscription);
+      sc_queue * ordered_events = sc_hash_table_get(manager->ordered_events_table, event->ordered_events_key);
+      if (ordered_events != null_ptr)
+      {
+        // The worker processing the previous sc-event of the subscription sc-element will process this one
+        sc_queue_push(ordered_events, event);
+        sc_mutex_unlock(&manager->ordered_events_mutex);
+        return;
+      }
+
+      // The queue exists while sc-events of the subscription sc-element are processed
+      ordered_events = sc_mem_new(sc_queue, 1);
+      sc_queue_init(ordered_events);
+      sc_hash_table_insert(manager->ordered_events_table, event->ordered_events_key, ordered_events);
+    }
+    sc_mutex_unlock(&manager->ordered_events_mutex);
+  }
+
   g_thread_pool_push(manager->thread_pool, event, null_ptr);
+}
+
+void _sc_event_emission_manager_batch_end(sc_event_emission_manager * manager)
+{
+  if (manager == null_ptr)
+    return;
+
   sc_monitor_release_write(&manager->pool_monitor);
 }
+
+void _sc_event_emission_manager_add(
+    sc_event_emission_manager * manager,
+    sc_event_subscription * event_subscription,
+    sc_addr user_addr,
+    sc_addr connector_addr,
+    sc_type connector_type,
+    sc_addr other_addr,
+    sc_event_do_after_callback callback,
+    sc_addr event_addr)
+{
+  _sc_event_emission_manager_batch_begin(manager);
+  _sc_event_emission_manager_batch_add(
+      manager, event_subscription, user_addr, connector_addr, connector_type, other_addr, callback, event_addr);
+  _sc_event_emission_manager_batch_end(manager);
+}
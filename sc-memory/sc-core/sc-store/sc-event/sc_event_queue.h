@@ -10,12 +10,38 @@
 #include "../../sc_memory_params.h"
 
 #include "../sc_types.h"
+#include "../sc_event_subscription.h"
 #include "../sc-base/sc_mutex.h"
 #include "../sc-container/sc-hash-table/sc_hash_table.h"
 #include "../sc-base/sc_monitor.h"
+#include "../sc-base/sc_condition.h"
 
 typedef sc_result (*sc_event_do_after_callback)(sc_memory_context const * ctx, sc_addr addr);
 
+//! Counter of statistics of sc-events processing. It is pointer-sized to be updated by atomic operations without locks.
+typedef gssize sc_event_stat_counter;
+
+/*! Structure representing counters of statistics of sc-events processing.
+ * @note Counters are updated atomically by worker threads and summed up when statistics are got.
+ */
+typedef struct
+{
+  sc_event_stat_counter processed_events_count;   ///< Amount of processed sc-events.
+  sc_event_stat_counter dropped_events_count;     ///< Amount of sc-events dropped because the queue was full.
+  sc_event_stat_counter blocked_emissions_count;  ///< Amount of times emitters waited because the queue was full.
+  sc_event_stat_counter events_wait_time;         ///< Total time (in microseconds) sc-events waited in the queue.
+  sc_event_stat_counter events_run_time;          ///< Total time (in microseconds) of sc-events processing.
+} sc_events_stat_counters;
+
+/*! Structure representing counters of statistics of sc-events processing by an sc-event subscription.
+ */
+typedef struct
+{
+  sc_event_stat_counter processed_events_count;  ///< Amount of processed sc-events.
+  sc_event_stat_counter events_wait_time;        ///< Total time (in microseconds) sc-events waited in the queue.
+  sc_event_stat_counter events_run_time;         ///< Total time (in microseconds) of sc-events processing.
+} sc_event_subscription_stat_counters;
+
 /*! Structure representing an sc-event emission manager.
  * @note This structure manages the asynchronous processing of sc-events using a thread pool.
  */
@@ -30,6 +56,16 @@ typedef struct
   sc_monitor destroy_monitor;               ///< Monitor for synchronizing access to the destruction process.
   GThreadPool * thread_pool;                ///< Thread pool used for worker threads processing events.
   sc_monitor pool_monitor;                  ///< Monitor for synchronizing access to the thread pool.
+  sc_uint32 max_events_queue_size;          ///< Maximum number of queued sc-events, 0 if the queue is unbounded.
+  sc_events_queue_overflow_mode events_queue_overflow_mode;  ///< Mode of handling sc-events when the queue is full.
+  sc_uint32 queue_size;               ///< Amount of queued sc-events. It is changed atomically.
+  sc_uint32 blocked_emitters_count;   ///< Amount of emitters waiting for free space in the queue.
+  sc_events_stat_counters stat;       ///< Counters of statistics of sc-events processing.
+  sc_mutex queue_mutex;               ///< Mutex for waiting of emitters for free space in the queue.
+  sc_condition queue_condition;       ///< Condition signaled when a queued sc-event has been processed.
+  sc_mutex ordered_events_mutex;  ///< Mutex for synchronizing access to queues of sc-events with ordered delivery.
+  sc_hash_table * ordered_events_table;  ///< Queues of sc-events with ordered delivery by subscription sc-elements
+                                         ///< which sc-events are being processed.
 } sc_event_emission_manager;
 
 /*! Function that initializes an sc-event emission manager.
@@ -51,6 +87,44 @@ void sc_event_emission_manager_stop(sc_event_emission_manager * manager);
  */
 void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager);
 
+/*! Function that waits until the sc-events queue has free space.
+ * @param manager Pointer to the sc_event_emission_manager managing event emission.
+ * @note It waits only if the queue is bounded and its overflow mode is `SC_EVENTS_QUEUE_OVERFLOW_BLOCK`. It doesn't
+ * wait in threads processing sc-events, because they free the queue. Call it before acquiring any sc-element monitors,
+ * otherwise processed sc-events may wait for them.
+ */
+void _sc_event_emission_manager_wait_for_queue(sc_event_emission_manager * manager);
+
+/*! Function that sets ordered delivery of sc-events for the specified sc-event subscription.
+ * @param manager Pointer to the sc_event_emission_manager managing event emission.
+ * @param event_subscription Pointer to the sc-event subscription.
+ * @param is_ordered_delivery Flag indicating whether sc-events of the subscription are processed one by one in order of
+ * their emission.
+ * @note Sc-events with ordered delivery are kept in a queue of their subscription sc-element while the previous
+ * sc-event of this sc-element is processed. The worker thread that processed the previous sc-event processes the next
+ * one. Sc-events of all subscriptions with ordered delivery of the same sc-element are processed in one queue.
+ */
+void _sc_event_emission_manager_set_ordered_delivery(
+    sc_event_emission_manager * manager,
+    sc_event_subscription * event_subscription,
+    sc_bool is_ordered_delivery);
+
+/*! Function that gets statistics of sc-events processing.
+ * @param manager Pointer to the sc_event_emission_manager managing event emission.
+ * @param stat Pointer to the statistics to be filled.
+ */
+void sc_event_emission_manager_get_stat(sc_event_emission_manager * manager, sc_events_stat * stat);
+
+/*! Function that gets statistics of sc-events processing by the specified sc-event subscription.
+ * @param manager Pointer to the sc_event_emission_manager managing event emission.
+ * @param event_subscription Pointer to the sc-event subscription.
+ * @param stat Pointer to the statistics to be filled.
+ */
+void sc_event_emission_manager_get_subscription_stat(
+    sc_event_emission_manager * manager,
+    sc_event_subscription const * event_subscription,
+    sc_event_subscription_stat * stat);
+
 /*! Function that adds an sc-event to the event emission manager for processing.
  * @param manager Pointer to the sc_event_emission_manager managing event emission.
  * @param event_subscription A pointer to sc-event subscription.
@@ -73,4 +147,29 @@ void _sc_event_emission_manager_add(
     sc_event_do_after_callback callback,
     sc_addr event_addr);
 
+/*! Function that starts adding of a batch of sc-events to the event emission manager.
+ * @param manager Pointer to the sc_event_emission_manager managing event emission.
+ * @note The emission pool is locked until `_sc_event_emission_manager_batch_end` is called.
+ */
+void _sc_event_emission_manager_batch_begin(sc_event_emission_manager * manager);
+
+/*! Function that adds an sc-event to the event emission manager within a batch.
+ * @note Parameters are the same as for `_sc_event_emission_manager_add`. This function must be called between
+ * `_sc_event_emission_manager_batch_begin` and `_sc_event_emission_manager_batch_end`.
+ */
+void _sc_event_emission_manager_batch_add(
+    sc_event_emission_manager * manager,
+    sc_event_subscription * event_subscription,
+    sc_addr user_addr,
+    sc_addr connector_addr,
+    sc_type connector_type,
+    sc_addr other_addr,
+    sc_event_do_after_callback callback,
+    sc_addr event_addr);
+
+/*! Function that finishes adding of a batch of sc-events to the event emission manager.
+ * @param manager Pointer to the sc_event_emission_manager managing event emission.
+ */
+void _sc_event_emission_manager_batch_end(sc_event_emission_manager * manager);
+
 #endif
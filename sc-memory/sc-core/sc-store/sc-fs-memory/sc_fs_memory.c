@@ -15,6 +15,8 @@
 
 #include "sc_io.h"
 
+#include "../sc-base/sc_metrics.h"
+
 sc_fs_memory_manager * manager;
 
 sc_fs_memory_status sc_fs_memory_initialize_ext(sc_memory_params const * params)
@@ -76,7 +78,11 @@ sc_fs_memory_status sc_fs_memory_link_string_ext(
     sc_uint32 const string_size,
     sc_bool is_searchable_string)
 {
-  return manager->link_string(manager->fs_memory, link_hash, string, string_size, is_searchable_string);
+  SC_METRICS_START(start_time);
+  sc_fs_memory_status const result =
+      manager->link_string(manager->fs_memory, link_hash, string, string_size, is_searchable_string);
+  SC_METRICS_RECORD(SC_METRIC_FS_MEMORY_WRITE, start_time);
+  return result;
 }
 
 sc_fs_memory_status sc_fs_memory_get_string_by_link_hash(
@@ -84,9 +90,11 @@ sc_fs_memory_status sc_fs_memory_get_string_by_link_hash(
     sc_char ** string,
     sc_uint32 * string_size)
 {
+  SC_METRICS_START(start_time);
   sc_uint64 size;
   sc_fs_memory_status result = manager->get_string_by_link_hash(manager->fs_memory, link_hash, string, &size);
   *string_size = size;
+  SC_METRICS_RECORD(SC_METRIC_FS_MEMORY_READ, start_time);
   return result;
 }
 
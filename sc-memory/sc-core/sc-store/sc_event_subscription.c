@@ -238,6 +238,11 @@ sc_result sc_event_subscription_destroy(sc_event_subscription * event_subscripti
 }
 
 sc_result sc_event_notify_element_deleted(sc_addr element)
+{
+  return sc_event_notify_elements_deleted(&element, 1);
+}
+
+sc_result sc_event_notify_elements_deleted(sc_addr const * elements, sc_uint32 count)
 {
   sc_hash_table_list * element_events_list = null_ptr;
   sc_event_subscription * event_subscription = null_ptr;
@@ -250,18 +255,17 @@ sc_result sc_event_notify_element_deleted(sc_addr element)
     goto result;
 
   // TODO(NikitaZotov): Implement monitor for `subscription_manager` to synchronize its freeing.
-  // lookup for all registered to specified sc-element events
+  // lookup for all registered to specified sc-elements events
   sc_monitor_acquire_write(&subscription_manager->events_table_monitor);
-  if (subscription_manager != null_ptr)
+  for (sc_uint32 i = 0; i < count; ++i)
   {
     element_events_list =
-        (sc_hash_table_list *)sc_hash_table_get(subscription_manager->events_table, TABLE_KEY(element));
-    if (element_events_list != null_ptr)
-      sc_hash_table_remove(subscription_manager->events_table, TABLE_KEY(element));
-  }
+        (sc_hash_table_list *)sc_hash_table_get(subscription_manager->events_table, TABLE_KEY(elements[i]));
+    if (element_events_list == null_ptr)
+      continue;
+
+    sc_hash_table_remove(subscription_manager->events_table, TABLE_KEY(elements[i]));
 
-  if (element_events_list != null_ptr)
-  {
     while (element_events_list != null_ptr)
     {
       event_subscription = (sc_event_subscription *)element_events_list->data;
@@ -302,10 +306,8 @@ sc_result sc_event_emit(
     return SC_RESULT_NO;
 
   if (_sc_memory_context_are_events_pending(ctx))
-  {
-    _sc_memory_context_pend_event(ctx, event_type_addr, subscription_addr, connector_addr, connector_type, other_addr);
-    return SC_RESULT_OK;
-  }
+    return _sc_memory_context_pend_event(
+        ctx, event_type_addr, subscription_addr, connector_addr, connector_type, other_addr, callback, event_addr);
 
   return sc_event_emit_impl(
       ctx, subscription_addr, event_type_addr, connector_addr, connector_type, other_addr, callback, event_addr);
@@ -367,6 +369,87 @@ result:
   return result;
 }
 
+void sc_event_emit_batch_impl(sc_memory_context const * ctx, sc_hash_table_list * events)
+{
+  if (events == null_ptr)
+    return;
+
+  sc_event_subscription_manager * subscription_manager = sc_storage_get_event_subscription_manager();
+  sc_event_emission_manager * emission_manager = sc_storage_get_event_emission_manager();
+
+  // callbacks of sc-elements which events are not emitted must be called here, otherwise they will not be called at all
+  sc_hash_table * emitted_callbacks_args = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  sc_hash_table * not_emitted_callbacks = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+
+  if (subscription_manager == null_ptr || subscription_manager->events_table == null_ptr)
+    goto callbacks;
+
+  sc_monitor_acquire_read(&subscription_manager->events_table_monitor);
+  _sc_event_emission_manager_batch_begin(emission_manager);
+
+  for (sc_hash_table_list * item = events; item != null_ptr; item = item->next)
+  {
+    sc_event_emit_params const * params = item->data;
+    if (params->is_cancelled)
+      continue;
+
+    sc_bool is_emitted = SC_FALSE;
+    sc_hash_table_list * element_events_list = (sc_hash_table_list *)sc_hash_table_get(
+        subscription_manager->events_table, TABLE_KEY(params->subscription_addr));
+    while (element_events_list != null_ptr)
+    {
+      sc_event_subscription * event_subscription = (sc_event_subscription *)element_events_list->data;
+
+      if (SC_ADDR_IS_EQUAL(event_subscription->event_type_addr, params->event_type_addr)
+          && ((event_subscription->event_element_type & params->connector_type)
+              == event_subscription->event_element_type))
+      {
+        _sc_event_emission_manager_batch_add(
+            emission_manager,
+            event_subscription,
+            ctx->user_addr,
+            params->connector_addr,
+            params->connector_type,
+            params->other_addr,
+            params->callback,
+            params->event_addr);
+        is_emitted = SC_TRUE;
+      }
+
+      element_events_list = element_events_list->next;
+    }
+
+    if (params->callback == null_ptr)
+      continue;
+
+    if (is_emitted)
+      sc_hash_table_insert(emitted_callbacks_args, TABLE_KEY(params->event_addr), (sc_pointer)params);
+    else
+      sc_hash_table_insert(not_emitted_callbacks, TABLE_KEY(params->event_addr), (sc_pointer)params);
+  }
+
+  _sc_event_emission_manager_batch_end(emission_manager);
+  sc_monitor_release_read(&subscription_manager->events_table_monitor);
+
+callbacks:
+{
+  sc_hash_table_iterator iterator;
+  sc_pointer key, value;
+  sc_hash_table_iterator_init(&iterator, not_emitted_callbacks);
+  while (sc_hash_table_iterator_next(&iterator, &key, &value))
+  {
+    if (sc_hash_table_get(emitted_callbacks_args, key) != null_ptr)
+      continue;
+
+    sc_event_emit_params const * params = value;
+    params->callback(ctx, params->event_addr);
+  }
+
+  sc_hash_table_destroy(not_emitted_callbacks);
+  sc_hash_table_destroy(emitted_callbacks_args);
+}
+}
+
 sc_bool sc_event_subscription_is_deletable(sc_event_subscription const * event_subscription)
 {
   return event_subscription->ref_count == SC_EVENT_REQUEST_DESTROY;
@@ -386,3 +469,27 @@ sc_addr sc_event_subscription_get_element(sc_event_subscription const * event_su
 {
   return event_subscription->subscription_addr;
 }
+
+sc_result sc_event_subscription_set_ordered_delivery(
+    sc_event_subscription * event_subscription,
+    sc_bool is_ordered_delivery)
+{
+  if (event_subscription == null_ptr)
+    return SC_RESULT_ERROR_INVALID_PARAMS;
+
+  _sc_event_emission_manager_set_ordered_delivery(
+      sc_storage_get_event_emission_manager(), event_subscription, is_ordered_delivery);
+  return SC_RESULT_OK;
+}
+
+sc_result sc_event_subscription_get_stat(
+    sc_event_subscription const * event_subscription,
+    sc_event_subscription_stat * stat)
+{
+  if (event_subscription == null_ptr || stat == null_ptr)
+    return SC_RESULT_ERROR_INVALID_PARAMS;
+
+  sc_event_emission_manager_get_subscription_stat(
+      sc_storage_get_event_emission_manager(), event_subscription, stat);
+  return SC_RESULT_OK;
+}
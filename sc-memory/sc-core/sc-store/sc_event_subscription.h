@@ -11,6 +11,15 @@
 
 typedef struct _sc_event_subscription_manager sc_event_subscription_manager;
 
+/*! Structure representing statistics of sc-events processing by an sc-event subscription.
+ */
+typedef struct
+{
+  sc_uint64 processed_events_count;  ///< Amount of processed sc-events.
+  sc_uint64 events_wait_time;        ///< Total time (in microseconds) sc-events waited in the queue.
+  sc_uint64 events_run_time;         ///< Total time (in microseconds) of sc-events processing.
+} sc_event_subscription_stat;
+
 /*! Event callback function type.
  * It takes 5 parameters:
  * @param event_subscription A pointer to sc-event subscription,
@@ -117,4 +126,24 @@ _SC_EXTERN sc_addr sc_event_subscription_get_event_type(sc_event_subscription co
  */
 _SC_EXTERN sc_addr sc_event_subscription_get_element(sc_event_subscription const * event_subscription);
 
+/*! Sets ordered delivery of sc-events for the specified sc-event subscription.
+ * @param event_subscription Pointer to the sc-event subscription.
+ * @param is_ordered_delivery If it is SC_TRUE, then sc-events of the subscription are processed one by one in order of
+ * their emission together with sc-events of other subscriptions with ordered delivery of the same subscription
+ * sc-element. Sc-events of other sc-elements are still processed in parallel.
+ * @return Returns SC_RESULT_OK if the operation is successful, SC_RESULT_ERROR_INVALID_PARAMS otherwise.
+ */
+_SC_EXTERN sc_result sc_event_subscription_set_ordered_delivery(
+    sc_event_subscription * event_subscription,
+    sc_bool is_ordered_delivery);
+
+/*! Gets statistics of sc-events processing by the specified sc-event subscription.
+ * @param event_subscription Pointer to the sc-event subscription.
+ * @param stat Pointer to the statistics to be filled.
+ * @return Returns SC_RESULT_OK if the operation is successful, SC_RESULT_ERROR_INVALID_PARAMS otherwise.
+ */
+_SC_EXTERN sc_result sc_event_subscription_get_stat(
+    sc_event_subscription const * event_subscription,
+    sc_event_subscription_stat * stat);
+
 #endif
@@ -14,6 +14,7 @@
 #include "../sc_memory_context_permissions.h"
 
 #include "sc-base/sc_allocator.h"
+#include "sc-base/sc_metrics.h"
 #include "sc-base/sc_monitor_table.h"
 
 sc_iterator3 * sc_iterator3_f_a_a_new(sc_memory_context const * ctx, sc_addr el, sc_type arc_type, sc_type end_type)
@@ -32,6 +33,27 @@ sc_iterator3 * sc_iterator3_f_a_a_new(sc_memory_context const * ctx, sc_addr el,
   return sc_iterator3_new(ctx, sc_iterator3_f_a_a, p1, p2, p3);
 }
 
+sc_bool sc_iterator3_f_a_a_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_addr el,
+    sc_type arc_type,
+    sc_type end_type)
+{
+  sc_iterator_param p1, p2, p3;
+
+  p1.is_type = SC_FALSE;
+  p1.addr = el;
+
+  p2.is_type = SC_TRUE;
+  p2.type = arc_type;
+
+  p3.is_type = SC_TRUE;
+  p3.type = end_type;
+
+  return sc_iterator3_init(it, ctx, sc_iterator3_f_a_a, p1, p2, p3);
+}
+
 sc_iterator3 * sc_iterator3_a_a_f_new(sc_memory_context const * ctx, sc_type beg_type, sc_type arc_type, sc_addr el)
 {
   sc_iterator_param p1, p2, p3;
@@ -48,6 +70,27 @@ sc_iterator3 * sc_iterator3_a_a_f_new(sc_memory_context const * ctx, sc_type beg
   return sc_iterator3_new(ctx, sc_iterator3_a_a_f, p1, p2, p3);
 }
 
+sc_bool sc_iterator3_a_a_f_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_type beg_type,
+    sc_type arc_type,
+    sc_addr el)
+{
+  sc_iterator_param p1, p2, p3;
+
+  p1.is_type = SC_TRUE;
+  p1.type = beg_type;
+
+  p2.is_type = SC_TRUE;
+  p2.type = arc_type;
+
+  p3.is_type = SC_FALSE;
+  p3.addr = el;
+
+  return sc_iterator3_init(it, ctx, sc_iterator3_a_a_f, p1, p2, p3);
+}
+
 sc_iterator3 * sc_iterator3_f_a_f_new(sc_memory_context const * ctx, sc_addr el_beg, sc_type arc_type, sc_addr el_end)
 {
   sc_iterator_param p1, p2, p3;
@@ -64,6 +107,27 @@ sc_iterator3 * sc_iterator3_f_a_f_new(sc_memory_context const * ctx, sc_addr el_
   return sc_iterator3_new(ctx, sc_iterator3_f_a_f, p1, p2, p3);
 }
 
+sc_bool sc_iterator3_f_a_f_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_addr el_beg,
+    sc_type arc_type,
+    sc_addr el_end)
+{
+  sc_iterator_param p1, p2, p3;
+
+  p1.is_type = SC_FALSE;
+  p1.addr = el_beg;
+
+  p2.is_type = SC_TRUE;
+  p2.type = arc_type;
+
+  p3.is_type = SC_FALSE;
+  p3.addr = el_end;
+
+  return sc_iterator3_init(it, ctx, sc_iterator3_f_a_f, p1, p2, p3);
+}
+
 sc_iterator3 * sc_iterator3_a_f_a_new(
     sc_memory_context const * ctx,
     sc_type beg_type,
@@ -84,6 +148,27 @@ sc_iterator3 * sc_iterator3_a_f_a_new(
   return sc_iterator3_new(ctx, sc_iterator3_a_f_a, p1, p2, p3);
 }
 
+sc_bool sc_iterator3_a_f_a_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_type beg_type,
+    sc_addr arc_addr,
+    sc_type end_type)
+{
+  sc_iterator_param p1, p2, p3;
+
+  p1.is_type = SC_TRUE;
+  p1.type = beg_type;
+
+  p2.is_type = SC_FALSE;
+  p2.addr = arc_addr;
+
+  p3.is_type = SC_TRUE;
+  p3.type = end_type;
+
+  return sc_iterator3_init(it, ctx, sc_iterator3_a_f_a, p1, p2, p3);
+}
+
 sc_iterator3 * sc_iterator3_f_f_a_new(
     sc_memory_context const * ctx,
     sc_addr beg_addr,
@@ -144,8 +229,7 @@ sc_iterator3 * sc_iterator3_f_f_f_new(
   return sc_iterator3_new(ctx, sc_iterator3_f_f_f, p1, p2, p3);
 }
 
-sc_iterator3 * sc_iterator3_new(
-    sc_memory_context const * ctx,
+sc_bool _sc_iterator3_check_params(
     sc_iterator3_type type,
     sc_iterator_param p1,
     sc_iterator_param p2,
@@ -153,60 +237,96 @@ sc_iterator3 * sc_iterator3_new(
 {
   // check types
   if (type >= sc_iterator3_count)
-    return null_ptr;
+    return SC_FALSE;
 
   // check params with template
   switch (type)
   {
   case sc_iterator3_f_a_a:
     if (p1.is_type || !p2.is_type || !p3.is_type)
-      return null_ptr;
+      return SC_FALSE;
     break;
 
   case sc_iterator3_a_a_f:
     if (!p1.is_type || !p2.is_type || p3.is_type)
-      return null_ptr;
+      return SC_FALSE;
     break;
 
   case sc_iterator3_f_a_f:
     if (p1.is_type || !p2.is_type || p3.is_type)
-      return null_ptr;
+      return SC_FALSE;
     break;
 
   case sc_iterator3_a_f_a:
     if (!p1.is_type || p2.is_type || !p3.is_type)
-      return null_ptr;
+      return SC_FALSE;
     break;
 
   case sc_iterator3_f_f_a:
     if (p1.is_type || p2.is_type || !p3.is_type)
-      return null_ptr;
+      return SC_FALSE;
     break;
 
   case sc_iterator3_a_f_f:
     if (!p1.is_type || p2.is_type || p3.is_type)
-      return null_ptr;
+      return SC_FALSE;
     break;
 
   case sc_iterator3_f_f_f:
     if (p1.is_type || p2.is_type || p3.is_type)
-      return null_ptr;
+      return SC_FALSE;
     break;
 
   default:
     break;
   }
 
-  sc_iterator3 * it = sc_mem_new(sc_iterator3, 1);
+  return SC_TRUE;
+}
+
+sc_bool sc_iterator3_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_iterator3_type type,
+    sc_iterator_param p1,
+    sc_iterator_param p2,
+    sc_iterator_param p3)
+{
+  if (it == null_ptr || _sc_iterator3_check_params(type, p1, p2, p3) == SC_FALSE)
+    return SC_FALSE;
+
+  SC_METRICS_START(start_time);
 
   it->params[0] = p1;
   it->params[1] = p2;
   it->params[2] = p3;
 
+  it->results[0] = (sc_iterator_result){SC_ADDR_EMPTY, SC_FALSE};
+  it->results[1] = (sc_iterator_result){SC_ADDR_EMPTY, SC_FALSE};
+  it->results[2] = (sc_iterator_result){SC_ADDR_EMPTY, SC_FALSE};
+
   it->type = type;
   it->ctx = ctx;
   it->finished = SC_FALSE;
+  it->is_arcs_index_used = SC_FALSE;
+
+  SC_METRICS_RECORD(SC_METRIC_ITERATOR_CREATION, start_time);
 
+  return SC_TRUE;
+}
+
+sc_iterator3 * sc_iterator3_new(
+    sc_memory_context const * ctx,
+    sc_iterator3_type type,
+    sc_iterator_param p1,
+    sc_iterator_param p2,
+    sc_iterator_param p3)
+{
+  if (_sc_iterator3_check_params(type, p1, p2, p3) == SC_FALSE)
+    return null_ptr;
+
+  sc_iterator3 * it = sc_mem_new(sc_iterator3, 1);
+  sc_iterator3_init(it, ctx, type, p1, p2, p3);
   return it;
 }
 
@@ -223,6 +343,13 @@ sc_addr _sc_iterator3_get_other_edge_incident_element(sc_element * el, sc_addr i
   return SC_ADDR_IS_EQUAL(incident_element, el->arc.end) ? el->arc.begin : el->arc.end;
 }
 
+//! Checks if outgoing sc-arcs of sc-element with the specified sc-type can be found by index of hub sc-arcs.
+//! Index contains sc-arcs only, so it can't be used for sc-types which sc-edges can have.
+#define _sc_iterator3_is_arcs_index_used(_element, _arc_type) \
+  (((_element)->flags.states & SC_STATE_ARCS_INDEXED) == SC_STATE_ARCS_INDEXED \
+   && sc_type_has_subtype_in_mask(_arc_type, sc_type_arc_access | sc_type_arc_common) \
+   && sc_type_has_not_subtype(_arc_type, sc_type_edge_common))
+
 sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
 {
   sc_addr const arc_begin = it->results[0].addr = it->params[0].addr;
@@ -241,16 +368,25 @@ sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
     goto error;
   it->results[0].is_accessed = SC_TRUE;
 
+  sc_element * beg_el = null_ptr;
+  result = sc_storage_get_element_by_addr(arc_begin, &beg_el);
+  if (result != SC_RESULT_OK)
+    goto error;
+
+  // sc-arcs of hubs are visited by chains of suitable sc-types instead of all outgoing sc-connectors. Chains don't
+  // keep order of the list of outgoing sc-connectors, so iterator started by the list isn't switched to the index
+  // built during iteration
+  sc_storage_arcs_index * arcs_index = sc_storage_get()->arcs_index;
+  if (SC_ADDR_IS_EMPTY(it->results[1].addr))
+    it->is_arcs_index_used = _sc_iterator3_is_arcs_index_used(beg_el, it->params[1].type);
+  sc_bool const is_indexed = it->is_arcs_index_used;
+
   // try to find first outgoing sc-arc
   sc_element * el = null_ptr;
-  if (sc_storage_get_element_by_addr(it->results[1].addr, &el) != SC_RESULT_OK)
-  {
-    result = sc_storage_get_element_by_addr(arc_begin, &el);
-    if (result != SC_RESULT_OK)
-      goto error;
-
-    arc_addr = el->first_out_arc;
-  }
+  if (is_indexed)
+    arc_addr = sc_storage_arcs_index_get_next_arc(arcs_index, arc_begin, it->results[1].addr, it->params[1].type);
+  else if (sc_storage_get_element_by_addr(it->results[1].addr, &el) != SC_RESULT_OK)
+    arc_addr = beg_el->first_out_arc;
   else
   {
     sc_bool const is_not_same = SC_ADDR_IS_NOT_EQUAL(arc_begin, it->results[1].addr);
@@ -294,10 +430,23 @@ sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
       goto error;
     }
 
-    sc_addr next_out_arc =
-        sc_type_has_subtype(el->flags.type, sc_type_edge_common)
-            ? SC_ADDR_IS_EQUAL(arc_begin, el->arc.end) ? el->arc.next_end_out_arc : el->arc.next_begin_out_arc
-            : el->arc.next_begin_out_arc;
+    sc_addr next_out_arc;
+    if (is_indexed)
+      next_out_arc = sc_storage_arcs_index_get_next_arc(arcs_index, arc_begin, arc_addr, it->params[1].type);
+    else
+      next_out_arc =
+          sc_type_has_subtype(el->flags.type, sc_type_edge_common)
+              ? SC_ADDR_IS_EQUAL(arc_begin, el->arc.end) ? el->arc.next_end_out_arc : el->arc.next_begin_out_arc
+              : el->arc.next_begin_out_arc;
+
+    // sc-connectors with unsuitable sc-types are skipped before checking permissions and getting their ends
+    sc_type const arc_type = el->flags.type;
+    if (sc_iterator_compare_type(arc_type, it->params[1].type) == SC_FALSE)
+    {
+      if (is_not_same)
+        sc_monitor_release_read(arc_monitor);
+      goto next;
+    }
 
     if (_sc_memory_context_check_local_and_global_permissions(
             sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_addr)
@@ -317,7 +466,6 @@ sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
       goto next;
     }
 
-    sc_type arc_type = el->flags.type;
     sc_addr arc_end = sc_type_has_subtype(el->flags.type, sc_type_edge_common)
                           ? _sc_iterator3_get_other_edge_incident_element(el, arc_begin)
                           : el->arc.end;
@@ -330,7 +478,7 @@ sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
     if (result != SC_RESULT_OK)
       goto error;
 
-    if (sc_iterator_compare_type(arc_type, it->params[1].type) && sc_iterator_compare_type(el_type, it->params[2].type))
+    if (sc_iterator_compare_type(el_type, it->params[2].type))
     {
       // store found result
       it->results[1].addr = arc_addr;
@@ -362,6 +510,20 @@ success:
   return SC_TRUE;
 }
 
+//! Gets next sc-connector after the specified one in the list of outgoing or incoming sc-connectors of sc-element.
+sc_addr _sc_iterator3_get_next_connector(sc_element * el, sc_addr element_addr, sc_bool is_outgoing)
+{
+  // sc-edges are in lists of their ends as their incoming and outgoing sc-connectors
+  sc_bool const is_edge = sc_type_has_subtype(el->flags.type, sc_type_edge_common);
+
+  if (is_outgoing)
+    return is_edge && SC_ADDR_IS_EQUAL(element_addr, el->arc.end) ? el->arc.next_end_out_arc
+                                                                  : el->arc.next_begin_out_arc;
+
+  return is_edge && SC_ADDR_IS_NOT_EQUAL(element_addr, el->arc.end) ? el->arc.next_begin_in_arc
+                                                                    : el->arc.next_end_in_arc;
+}
+
 sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
 {
   sc_addr const arc_begin = it->results[0].addr = it->params[0].addr;
@@ -388,16 +550,29 @@ sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
     goto error;
   it->results[2].is_accessed = SC_TRUE;
 
-  // try to find first incoming sc-arc
-  sc_element * el = null_ptr;
-  if (sc_storage_get_element_by_addr(it->results[1].addr, &el) != SC_RESULT_OK)
-  {
-    result = sc_storage_get_element_by_addr(arc_end, &el);
-    if (result != SC_RESULT_OK)
-      goto error;
+  sc_element * beg_el = null_ptr;
+  result = sc_storage_get_element_by_addr(arc_begin, &beg_el);
+  if (result != SC_RESULT_OK)
+    goto error;
 
-    arc_addr = el->first_in_arc;
-  }
+  sc_element * end_el = null_ptr;
+  result = sc_storage_get_element_by_addr(arc_end, &end_el);
+  if (result != SC_RESULT_OK)
+    goto error;
+
+  // sc-arcs from hubs are found by chains of their end sc-elements, otherwise the shortest list of sc-connectors is
+  // visited. Sc-connectors between the same sc-elements have the same order in all lists and chains, so the next
+  // sc-connector is found correctly, even if the list is changed between calls
+  sc_storage_arcs_index * arcs_index = sc_storage_get()->arcs_index;
+  sc_bool const is_indexed = _sc_iterator3_is_arcs_index_used(beg_el, it->params[1].type);
+  sc_bool const is_outgoing = beg_el->outgoing_arcs_count < end_el->incoming_arcs_count;
+
+  // try to find first sc-connector
+  sc_element * el = null_ptr;
+  if (is_indexed)
+    arc_addr = sc_storage_arcs_index_get_next_arc_to_element(arcs_index, arc_begin, arc_end, it->results[1].addr);
+  else if (sc_storage_get_element_by_addr(it->results[1].addr, &el) != SC_RESULT_OK)
+    arc_addr = is_outgoing ? beg_el->first_out_arc : end_el->first_in_arc;
   else
   {
     sc_bool const is_not_same =
@@ -416,15 +591,13 @@ sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
       goto error;
     }
 
-    arc_addr = sc_type_has_subtype(el->flags.type, sc_type_edge_common)
-                   ? SC_ADDR_IS_EQUAL(arc_end, el->arc.end) ? el->arc.next_end_in_arc : el->arc.next_begin_in_arc
-                   : el->arc.next_end_in_arc;
+    arc_addr = _sc_iterator3_get_next_connector(el, is_outgoing ? arc_begin : arc_end, is_outgoing);
 
     if (is_not_same)
       sc_monitor_release_read(arc_monitor);
   }
 
-  // trying to find incoming sc-arc, that created before iterator, and wasn't deleted
+  // trying to find sc-connector, that created before iterator, and wasn't deleted
   while (SC_ADDR_IS_NOT_EMPTY(arc_addr))
   {
     sc_bool const is_not_same = SC_ADDR_IS_NOT_EQUAL(arc_begin, arc_addr) && SC_ADDR_IS_NOT_EQUAL(arc_end, arc_addr);
@@ -442,10 +615,25 @@ sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
       goto error;
     }
 
-    sc_addr next_in_arc =
-        sc_type_has_subtype(el->flags.type, sc_type_edge_common)
-            ? SC_ADDR_IS_EQUAL(arc_end, el->arc.end) ? el->arc.next_end_in_arc : el->arc.next_begin_in_arc
-            : el->arc.next_end_in_arc;
+    sc_addr next_arc;
+    if (is_indexed)
+      next_arc = sc_storage_arcs_index_get_next_arc_to_element(arcs_index, arc_begin, arc_end, arc_addr);
+    else
+      next_arc = _sc_iterator3_get_next_connector(el, is_outgoing ? arc_begin : arc_end, is_outgoing);
+
+    sc_bool const is_edge = sc_type_has_subtype(el->flags.type, sc_type_edge_common);
+    sc_bool const is_incident =
+        is_edge ? (SC_ADDR_IS_EQUAL(arc_begin, el->arc.begin) && SC_ADDR_IS_EQUAL(arc_end, el->arc.end))
+                      || (SC_ADDR_IS_EQUAL(arc_begin, el->arc.end) && SC_ADDR_IS_EQUAL(arc_end, el->arc.begin))
+                : SC_ADDR_IS_EQUAL(arc_begin, el->arc.begin) && SC_ADDR_IS_EQUAL(arc_end, el->arc.end);
+
+    // sc-connectors with other incident sc-elements or unsuitable sc-types are skipped before checking permissions
+    if (is_incident == SC_FALSE || sc_iterator_compare_type(el->flags.type, it->params[1].type) == SC_FALSE)
+    {
+      if (is_not_same)
+        sc_monitor_release_read(arc_monitor);
+      goto next;
+    }
 
     if (_sc_memory_context_check_local_and_global_permissions(
             sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_addr)
@@ -465,26 +653,17 @@ sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
       goto next;
     }
 
-    sc_type arc_type = el->flags.type;
-
-    sc_bool is_begin_same = sc_type_has_subtype(el->flags.type, sc_type_edge_common)
-                                ? SC_ADDR_IS_EQUAL(arc_begin, el->arc.begin) || SC_ADDR_IS_EQUAL(arc_begin, el->arc.end)
-                                : SC_ADDR_IS_EQUAL(arc_begin, el->arc.begin);
-
     if (is_not_same)
       sc_monitor_release_read(arc_monitor);
 
-    if (is_begin_same && sc_iterator_compare_type(arc_type, it->params[1].type))
-    {
-      // store found result
-      it->results[1].addr = arc_addr;
-      it->results[1].is_accessed = SC_TRUE;
-      goto success;
-    }
+    // store found result
+    it->results[1].addr = arc_addr;
+    it->results[1].is_accessed = SC_TRUE;
+    goto success;
 
     // go to next arc
   next:
-    arc_addr = next_in_arc;
+    arc_addr = next_arc;
   }
 
 error:
@@ -926,6 +1105,8 @@ sc_bool sc_iterator3_next_ext(sc_iterator3 * it, sc_result * result)
     return status;
   }
 
+  SC_METRICS_START(start_time);
+
   switch (it->type)
   {
   case sc_iterator3_f_a_a:
@@ -967,6 +1148,8 @@ sc_bool sc_iterator3_next_ext(sc_iterator3 * it, sc_result * result)
     it->results[2] = SC_ITERATOR_RESULT_EMPTY;
   }
 
+  SC_METRICS_RECORD(SC_METRIC_ITERATOR_STEP, start_time);
+
   return status;
 }
 
@@ -62,6 +62,7 @@ struct _sc_iterator3
   sc_iterator_result results[3];  // results array (same size as params)
   sc_memory_context const * ctx;  // pointer to used memory context
   sc_bool finished;
+  sc_bool is_arcs_index_used;  // whether outgoing sc-arcs are visited by index of hub, it is chosen on the first step
 };
 
 /*! Create iterator to find outgoing sc-arcs for specified element
@@ -140,6 +141,70 @@ _SC_EXTERN sc_iterator3 * sc_iterator3_new(
     sc_iterator_param p2,
     sc_iterator_param p3);
 
+/*! Initialize sc-iterator-3 in caller-provided storage. Unlike `sc_iterator3_new` it doesn't allocate memory, so
+ * initialized iterator may be placed on stack or inside other structure and mustn't be freed by `sc_iterator3_free`.
+ * Iterator may be reinitialized with other parameters in the same storage.
+ * @param it Pointer to storage of iterator
+ * @param type Iterator type (search template)
+ * @param p1 First iterator parameter
+ * @param p2 Second iterator parameter
+ * @param p3 Third iterator parameter
+ * @return Return SC_TRUE, if iterator initialized; otherwise return SC_FALSE if parameters invalid for specified
+ * iterator type, or type is not a sc-iterator-3.
+ * @code
+ * sc_iterator3 it;
+ * sc_iterator3_f_a_a_init(&it, ctx, addr, sc_type_arc_pos_const_perm, 0);
+ * while (sc_iterator3_next(&it)) { <your code> }
+ * @endcode
+ */
+_SC_EXTERN sc_bool sc_iterator3_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_iterator3_type type,
+    sc_iterator_param p1,
+    sc_iterator_param p2,
+    sc_iterator_param p3);
+
+/*! Initialize iterator to find outgoing sc-arcs for specified element in caller-provided storage
+ * @see sc_iterator3_f_a_a_new, sc_iterator3_init
+ */
+_SC_EXTERN sc_bool sc_iterator3_f_a_a_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_addr el,
+    sc_type arc_type,
+    sc_type end_type);
+
+/*! Initialize iterator to find incoming sc-arcs for specified element in caller-provided storage
+ * @see sc_iterator3_a_a_f_new, sc_iterator3_init
+ */
+_SC_EXTERN sc_bool sc_iterator3_a_a_f_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_type beg_type,
+    sc_type arc_type,
+    sc_addr el);
+
+/*! Initialize iterator to find arcs between two specified elements in caller-provided storage
+ * @see sc_iterator3_f_a_f_new, sc_iterator3_init
+ */
+_SC_EXTERN sc_bool sc_iterator3_f_a_f_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_addr el_beg,
+    sc_type arc_type,
+    sc_addr el_end);
+
+/*! Initialize iterator to determine edge source and target in caller-provided storage
+ * @see sc_iterator3_a_f_a_new, sc_iterator3_init
+ */
+_SC_EXTERN sc_bool sc_iterator3_a_f_a_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_type beg_type,
+    sc_addr arc_addr,
+    sc_type end_type);
+
 /*! Destroy iterator and free allocated memory
  * @param it Pointer to sc-iterator that need to be destroyed
  */
@@ -12,8 +12,7 @@
 
 #include "sc-base/sc_allocator.h"
 
-sc_iterator5 * sc_iterator5_new(
-    sc_memory_context const * ctx,
+sc_bool _sc_iterator5_check_params(
     sc_iterator5_type type,
     sc_iterator_param p1,
     sc_iterator_param p2,
@@ -26,37 +25,51 @@ sc_iterator5 * sc_iterator5_new(
   {
   case sc_iterator5_f_a_a_a_f:
     if (p1.is_type || !p2.is_type || !p3.is_type || !p4.is_type || p5.is_type)
-      return null_ptr;
+      return SC_FALSE;
     break;
   case sc_iterator5_a_a_f_a_f:
     if (!p1.is_type || !p2.is_type || p3.is_type || !p4.is_type || p5.is_type)
-      return null_ptr;
+      return SC_FALSE;
     break;
   case sc_iterator5_f_a_f_a_f:
     if (p1.is_type || !p2.is_type || p3.is_type || !p4.is_type || p5.is_type)
-      return null_ptr;
+      return SC_FALSE;
     break;
   case sc_iterator5_f_a_f_a_a:
     if (p1.is_type || !p2.is_type || p3.is_type || !p4.is_type || !p5.is_type)
-      return null_ptr;
+      return SC_FALSE;
     break;
   case sc_iterator5_f_a_a_a_a:
     if (p1.is_type || !p2.is_type || !p3.is_type || !p4.is_type || !p5.is_type)
-      return null_ptr;
+      return SC_FALSE;
     break;
   case sc_iterator5_a_a_f_a_a:
     if (!p1.is_type || !p2.is_type || p3.is_type || !p4.is_type || !p5.is_type)
-      return null_ptr;
+      return SC_FALSE;
     break;
   case sc_iterator5_a_a_a_a_f:
     if (!p1.is_type || !p2.is_type || !p3.is_type || !p4.is_type || p5.is_type)
-      return null_ptr;
+      return SC_FALSE;
     break;
   default:
-    return null_ptr;
+    return SC_FALSE;
   }
 
-  sc_iterator5 * it = sc_mem_new(sc_iterator5, 1);
+  return SC_TRUE;
+}
+
+sc_bool sc_iterator5_init(
+    sc_iterator5 * it,
+    sc_memory_context const * ctx,
+    sc_iterator5_type type,
+    sc_iterator_param p1,
+    sc_iterator_param p2,
+    sc_iterator_param p3,
+    sc_iterator_param p4,
+    sc_iterator_param p5)
+{
+  if (it == null_ptr || _sc_iterator5_check_params(type, p1, p2, p3, p4, p5) == SC_FALSE)
+    return SC_FALSE;
 
   it->params[0] = p1;
   it->params[1] = p2;
@@ -64,57 +77,68 @@ sc_iterator5 * sc_iterator5_new(
   it->params[3] = p4;
   it->params[4] = p5;
 
+  for (sc_uint32 i = 0; i < 5; ++i)
+    it->results[i] = (sc_iterator_result){SC_ADDR_EMPTY, SC_FALSE};
+
   it->type = type;
   it->ctx = ctx;
+  it->is_inner_initialized = SC_FALSE;
 
-  // create main cycle iterator
+  // initialize outer cycle iterator, inner one is initialized in place for each result of outer one
   switch (type)
   {
   case sc_iterator5_f_a_a_a_f:
-    it->it_main = sc_iterator3_f_a_a_new(ctx, p1.addr, p2.type, p3.type);
-    it->it_attr = null_ptr;
+    sc_iterator3_f_a_a_init(&it->it_main, ctx, p1.addr, p2.type, p3.type);
     it->results[0].addr = p1.addr;
     it->results[4].addr = p5.addr;
     break;
   case sc_iterator5_a_a_f_a_f:
-    it->it_main = sc_iterator3_a_a_f_new(ctx, p1.type, p2.type, p3.addr);
-    it->it_attr = null_ptr;
+    sc_iterator3_a_a_f_init(&it->it_main, ctx, p1.type, p2.type, p3.addr);
     it->results[2].addr = p3.addr;
     it->results[4].addr = p5.addr;
     break;
   case sc_iterator5_f_a_f_a_f:
-    it->it_main = sc_iterator3_f_a_f_new(ctx, p1.addr, p2.type, p3.addr);
-    it->it_attr = null_ptr;
+    sc_iterator3_f_a_f_init(&it->it_main, ctx, p1.addr, p2.type, p3.addr);
     it->results[0].addr = p1.addr;
     it->results[2].addr = p3.addr;
     it->results[4].addr = p5.addr;
     break;
   case sc_iterator5_f_a_f_a_a:
-    it->it_main = sc_iterator3_f_a_f_new(ctx, p1.addr, p2.type, p3.addr);
-    it->it_attr = null_ptr;
+    sc_iterator3_f_a_f_init(&it->it_main, ctx, p1.addr, p2.type, p3.addr);
     it->results[0].addr = p1.addr;
     it->results[2].addr = p3.addr;
     break;
   case sc_iterator5_a_a_f_a_a:
-    it->it_main = sc_iterator3_a_a_f_new(ctx, p1.type, p2.type, p3.addr);
-    it->it_attr = null_ptr;
+    sc_iterator3_a_a_f_init(&it->it_main, ctx, p1.type, p2.type, p3.addr);
     it->results[2].addr = p3.addr;
     break;
   case sc_iterator5_f_a_a_a_a:
-    it->it_main = sc_iterator3_f_a_a_new(ctx, p1.addr, p2.type, p3.type);
-    it->it_attr = null_ptr;
+    sc_iterator3_f_a_a_init(&it->it_main, ctx, p1.addr, p2.type, p3.type);
     it->results[0].addr = p1.addr;
     break;
   case sc_iterator5_a_a_a_a_f:
-    it->it_main = null_ptr;
-    it->it_attr = sc_iterator3_f_a_a_new(ctx, p5.addr, p4.type, p2.type);
+    sc_iterator3_f_a_a_init(&it->it_attr, ctx, p5.addr, p4.type, p2.type);
     it->results[4].addr = p5.addr;
     break;
-  default:
-    sc_mem_free(it);
-    it = null_ptr;
   }
 
+  return SC_TRUE;
+}
+
+sc_iterator5 * sc_iterator5_new(
+    sc_memory_context const * ctx,
+    sc_iterator5_type type,
+    sc_iterator_param p1,
+    sc_iterator_param p2,
+    sc_iterator_param p3,
+    sc_iterator_param p4,
+    sc_iterator_param p5)
+{
+  if (_sc_iterator5_check_params(type, p1, p2, p3, p4, p5) == SC_FALSE)
+    return null_ptr;
+
+  sc_iterator5 * it = sc_mem_new(sc_iterator5, 1);
+  sc_iterator5_init(it, ctx, type, p1, p2, p3, p4, p5);
   return it;
 }
 
@@ -284,50 +308,66 @@ void sc_iterator5_free(sc_iterator5 * it)
   if (it == null_ptr)
     return;
 
-  if (it->it_attr != null_ptr)
-    sc_iterator3_free(it->it_attr);
-  if (it->it_main != null_ptr)
-    sc_iterator3_free(it->it_main);
   sc_mem_free(it);
 }
 
+/*! Initializes inner iterator in place for current result of outer iterator.
+ */
+sc_bool _sc_iterator5_init_inner(sc_iterator5 * it)
+{
+  switch (it->type)
+  {
+  case sc_iterator5_f_a_a_a_f:
+  case sc_iterator5_a_a_f_a_f:
+  case sc_iterator5_f_a_f_a_f:
+    return sc_iterator3_f_a_f_init(
+        &it->it_attr, it->ctx, it->params[4].addr, it->params[3].type, it->it_main.results[1].addr);
+  case sc_iterator5_f_a_f_a_a:
+  case sc_iterator5_f_a_a_a_a:
+  case sc_iterator5_a_a_f_a_a:
+    return sc_iterator3_a_a_f_init(
+        &it->it_attr, it->ctx, it->params[4].type, it->params[3].type, it->it_main.results[1].addr);
+  case sc_iterator5_a_a_a_a_f:
+    return sc_iterator3_a_f_a_init(
+        &it->it_main, it->ctx, it->params[0].type, it->it_attr.results[2].addr, it->params[2].type);
+  }
+
+  return SC_FALSE;
+}
+
+/*! Goes to next result of inner iterator. If inner iterator is finished, then goes to next result of outer iterator
+ * and reinitializes inner iterator for it in the same storage.
+ */
+sc_bool _sc_iterator5_next_inner(sc_iterator5 * it, sc_iterator3 * outer, sc_iterator3 * inner)
+{
+  while (it->is_inner_initialized == SC_FALSE || !sc_iterator3_next(inner))
+  {
+    it->is_inner_initialized = SC_FALSE;
+    if (!sc_iterator3_next(outer))
+      return SC_FALSE;
+
+    it->is_inner_initialized = _sc_iterator5_init_inner(it);
+    if (it->is_inner_initialized == SC_FALSE)
+      return SC_FALSE;
+  }
+
+  return SC_TRUE;
+}
+
 sc_bool _sc_iterator5_a_a_f_a_f_next(sc_iterator5 * it)
 {
   it->results[0].addr = SC_ADDR_EMPTY;
   it->results[1].addr = SC_ADDR_EMPTY;
   it->results[3].addr = SC_ADDR_EMPTY;
 
-  if (it->it_attr == null_ptr || !sc_iterator3_next(it->it_attr))
-  {
-    if (it->it_attr != null_ptr)
-    {
-      sc_iterator3_free(it->it_attr);
-      it->it_attr = null_ptr;
-    }
-
-    while (it->it_attr == null_ptr || !sc_iterator3_next(it->it_attr))
-    {
-      if (it->it_attr != null_ptr)
-      {
-        sc_iterator3_free(it->it_attr);
-        it->it_attr = null_ptr;
-      }
-
-      if (!sc_iterator3_next(it->it_main))
-        return SC_FALSE;
-
-      it->it_attr =
-          sc_iterator3_f_a_f_new(it->ctx, it->params[4].addr, it->params[3].type, it->it_main->results[1].addr);
-      if (it->it_attr == null_ptr)
-        return SC_FALSE;
-    }
-  }
+  if (!_sc_iterator5_next_inner(it, &it->it_main, &it->it_attr))
+    return SC_FALSE;
 
-  it->results[0] = it->it_main->results[0];
-  it->results[1] = it->it_main->results[1];
-  it->results[2].is_accessed = it->it_main->results[2].is_accessed;
-  it->results[3] = it->it_attr->results[1];
-  it->results[4].is_accessed = it->it_attr->results[0].is_accessed;
+  it->results[0] = it->it_main.results[0];
+  it->results[1] = it->it_main.results[1];
+  it->results[2].is_accessed = it->it_main.results[2].is_accessed;
+  it->results[3] = it->it_attr.results[1];
+  it->results[4].is_accessed = it->it_attr.results[0].is_accessed;
   return SC_TRUE;
 }
 
@@ -337,37 +377,14 @@ sc_bool _sc_iterator5_f_a_a_a_f_next(sc_iterator5 * it)
   it->results[2].addr = SC_ADDR_EMPTY;
   it->results[3].addr = SC_ADDR_EMPTY;
 
-  if (it->it_attr == null_ptr || !sc_iterator3_next(it->it_attr))
-  {
-    if (it->it_attr != null_ptr)
-    {
-      sc_iterator3_free(it->it_attr);
-      it->it_attr = null_ptr;
-    }
-
-    while (it->it_attr == null_ptr || !sc_iterator3_next(it->it_attr))
-    {
-      if (it->it_attr != null_ptr)
-      {
-        sc_iterator3_free(it->it_attr);
-        it->it_attr = null_ptr;
-      }
-
-      if (!sc_iterator3_next(it->it_main))
-        return SC_FALSE;
-
-      it->it_attr =
-          sc_iterator3_f_a_f_new(it->ctx, it->params[4].addr, it->params[3].type, it->it_main->results[1].addr);
-      if (it->it_attr == null_ptr)
-        return SC_FALSE;
-    }
-  }
+  if (!_sc_iterator5_next_inner(it, &it->it_main, &it->it_attr))
+    return SC_FALSE;
 
-  it->results[0].is_accessed = it->it_main->results[0].is_accessed;
-  it->results[1] = it->it_main->results[1];
-  it->results[2] = it->it_main->results[2];
-  it->results[3] = it->it_attr->results[1];
-  it->results[4].is_accessed = it->it_attr->results[0].is_accessed;
+  it->results[0].is_accessed = it->it_main.results[0].is_accessed;
+  it->results[1] = it->it_main.results[1];
+  it->results[2] = it->it_main.results[2];
+  it->results[3] = it->it_attr.results[1];
+  it->results[4].is_accessed = it->it_attr.results[0].is_accessed;
   return SC_TRUE;
 }
 
@@ -376,37 +393,14 @@ sc_bool _sc_iterator5_f_a_f_a_f_next(sc_iterator5 * it)
   it->results[1].addr = SC_ADDR_EMPTY;
   it->results[3].addr = SC_ADDR_EMPTY;
 
-  if (it->it_attr == null_ptr || !sc_iterator3_next(it->it_attr))
-  {
-    if (it->it_attr != null_ptr)
-    {
-      sc_iterator3_free(it->it_attr);
-      it->it_attr = null_ptr;
-    }
-
-    while (it->it_attr == null_ptr || !sc_iterator3_next(it->it_attr))
-    {
-      if (it->it_attr != null_ptr)
-      {
-        sc_iterator3_free(it->it_attr);
-        it->it_attr = null_ptr;
-      }
-
-      if (!sc_iterator3_next(it->it_main))
-        return SC_FALSE;
-
-      it->it_attr =
-          sc_iterator3_f_a_f_new(it->ctx, it->params[4].addr, it->params[3].type, it->it_main->results[1].addr);
-      if (it->it_attr == null_ptr)
-        return SC_FALSE;
-    }
-  }
+  if (!_sc_iterator5_next_inner(it, &it->it_main, &it->it_attr))
+    return SC_FALSE;
 
-  it->results[0].is_accessed = it->it_main->results[0].is_accessed;
-  it->results[1] = it->it_main->results[1];
-  it->results[2].is_accessed = it->it_main->results[2].is_accessed;
-  it->results[3] = it->it_attr->results[1];
-  it->results[4].is_accessed = it->it_attr->results[0].is_accessed;
+  it->results[0].is_accessed = it->it_main.results[0].is_accessed;
+  it->results[1] = it->it_main.results[1];
+  it->results[2].is_accessed = it->it_main.results[2].is_accessed;
+  it->results[3] = it->it_attr.results[1];
+  it->results[4].is_accessed = it->it_attr.results[0].is_accessed;
   return SC_TRUE;
 }
 
@@ -416,37 +410,14 @@ sc_bool _sc_iterator5_f_a_f_a_a_next(sc_iterator5 * it)
   it->results[3].addr = SC_ADDR_EMPTY;
   it->results[4].addr = SC_ADDR_EMPTY;
 
-  if (it->it_attr == null_ptr || !sc_iterator3_next(it->it_attr))
-  {
-    if (it->it_attr != null_ptr)
-    {
-      sc_iterator3_free(it->it_attr);
-      it->it_attr = null_ptr;
-    }
-
-    while (it->it_attr == null_ptr || !sc_iterator3_next(it->it_attr))
-    {
-      if (it->it_attr != null_ptr)
-      {
-        sc_iterator3_free(it->it_attr);
-        it->it_attr = null_ptr;
-      }
-
-      if (!sc_iterator3_next(it->it_main))
-        return SC_FALSE;
-
-      it->it_attr =
-          sc_iterator3_a_a_f_new(it->ctx, it->params[4].type, it->params[3].type, it->it_main->results[1].addr);
-      if (it->it_attr == null_ptr)
-        return SC_FALSE;
-    }
-  }
+  if (!_sc_iterator5_next_inner(it, &it->it_main, &it->it_attr))
+    return SC_FALSE;
 
-  it->results[0].is_accessed = it->it_main->results[0].is_accessed;
-  it->results[1] = it->it_main->results[1];
-  it->results[2].is_accessed = it->it_main->results[2].is_accessed;
-  it->results[3] = it->it_attr->results[1];
-  it->results[4] = it->it_attr->results[0];
+  it->results[0].is_accessed = it->it_main.results[0].is_accessed;
+  it->results[1] = it->it_main.results[1];
+  it->results[2].is_accessed = it->it_main.results[2].is_accessed;
+  it->results[3] = it->it_attr.results[1];
+  it->results[4] = it->it_attr.results[0];
   return SC_TRUE;
 }
 
@@ -457,37 +428,14 @@ sc_bool _sc_iterator5_f_a_a_a_a_next(sc_iterator5 * it)
   it->results[3].addr = SC_ADDR_EMPTY;
   it->results[4].addr = SC_ADDR_EMPTY;
 
-  if (it->it_attr == null_ptr || !sc_iterator3_next(it->it_attr))
-  {
-    if (it->it_attr != null_ptr)
-    {
-      sc_iterator3_free(it->it_attr);
-      it->it_attr = null_ptr;
-    }
-
-    while (it->it_attr == null_ptr || !sc_iterator3_next(it->it_attr))
-    {
-      if (it->it_attr != null_ptr)
-      {
-        sc_iterator3_free(it->it_attr);
-        it->it_attr = null_ptr;
-      }
-
-      if (!sc_iterator3_next(it->it_main))
-        return SC_FALSE;
-
-      it->it_attr =
-          sc_iterator3_a_a_f_new(it->ctx, it->params[4].type, it->params[3].type, it->it_main->results[1].addr);
-      if (it->it_attr == null_ptr)
-        return SC_FALSE;
-    }
-  }
+  if (!_sc_iterator5_next_inner(it, &it->it_main, &it->it_attr))
+    return SC_FALSE;
 
-  it->results[0].is_accessed = it->it_main->results[0].is_accessed;
-  it->results[1] = it->it_main->results[1];
-  it->results[2] = it->it_main->results[2];
-  it->results[3] = it->it_attr->results[1];
-  it->results[4] = it->it_attr->results[0];
+  it->results[0].is_accessed = it->it_main.results[0].is_accessed;
+  it->results[1] = it->it_main.results[1];
+  it->results[2] = it->it_main.results[2];
+  it->results[3] = it->it_attr.results[1];
+  it->results[4] = it->it_attr.results[0];
   return SC_TRUE;
 }
 
@@ -498,36 +446,14 @@ sc_bool _sc_iterator5_a_a_f_a_a_next(sc_iterator5 * it)
   it->results[3].addr = SC_ADDR_EMPTY;
   it->results[4].addr = SC_ADDR_EMPTY;
 
-  if (it->it_attr == null_ptr || !sc_iterator3_next(it->it_attr))
-  {
-    if (it->it_attr != null_ptr)
-    {
-      sc_iterator3_free(it->it_attr);
-      it->it_attr = null_ptr;
-    }
-
-    while (it->it_attr == null_ptr || !sc_iterator3_next(it->it_attr))
-    {
-      if (it->it_attr != null_ptr)
-      {
-        sc_iterator3_free(it->it_attr);
-        it->it_attr = null_ptr;
-      }
-      if (!sc_iterator3_next(it->it_main))
-        return SC_FALSE;
-
-      it->it_attr =
-          sc_iterator3_a_a_f_new(it->ctx, it->params[4].type, it->params[3].type, it->it_main->results[1].addr);
-      if (it->it_attr == null_ptr)
-        return SC_FALSE;
-    }
-  }
+  if (!_sc_iterator5_next_inner(it, &it->it_main, &it->it_attr))
+    return SC_FALSE;
 
-  it->results[0] = it->it_main->results[0];
-  it->results[1] = it->it_main->results[1];
-  it->results[2].is_accessed = it->it_main->results[2].is_accessed;
-  it->results[3] = it->it_attr->results[1];
-  it->results[4] = it->it_attr->results[0];
+  it->results[0] = it->it_main.results[0];
+  it->results[1] = it->it_main.results[1];
+  it->results[2].is_accessed = it->it_main.results[2].is_accessed;
+  it->results[3] = it->it_attr.results[1];
+  it->results[4] = it->it_attr.results[0];
   return SC_TRUE;
 }
 
@@ -538,37 +464,14 @@ sc_bool _sc_iterator5_a_a_a_a_f_next(sc_iterator5 * it)
   it->results[2].addr = SC_ADDR_EMPTY;
   it->results[3].addr = SC_ADDR_EMPTY;
 
-  if (it->it_main == null_ptr || !sc_iterator3_next(it->it_main))
-  {
-    if (it->it_main != null_ptr)
-    {
-      sc_iterator3_free(it->it_main);
-      it->it_main = null_ptr;
-    }
-
-    while (it->it_main == null_ptr || !sc_iterator3_next(it->it_main))
-    {
-      if (it->it_main != null_ptr)
-      {
-        sc_iterator3_free(it->it_main);
-        it->it_main = null_ptr;
-      }
-
-      if (!sc_iterator3_next(it->it_attr))
-        return SC_FALSE;
-
-      it->it_main =
-          sc_iterator3_a_f_a_new(it->ctx, it->params[0].type, it->it_attr->results[2].addr, it->params[2].type);
-      if (it->it_main == null_ptr)
-        return SC_FALSE;
-    }
-  }
+  if (!_sc_iterator5_next_inner(it, &it->it_attr, &it->it_main))
+    return SC_FALSE;
 
-  it->results[0] = it->it_main->results[0];
-  it->results[1] = it->it_main->results[1];
-  it->results[2] = it->it_main->results[2];
-  it->results[3] = it->it_attr->results[1];
-  it->results[4].is_accessed = it->it_attr->results[0].is_accessed;
+  it->results[0] = it->it_main.results[0];
+  it->results[1] = it->it_main.results[1];
+  it->results[2] = it->it_main.results[2];
+  it->results[3] = it->it_attr.results[1];
+  it->results[4].is_accessed = it->it_attr.results[0].is_accessed;
   return SC_TRUE;
 }
 
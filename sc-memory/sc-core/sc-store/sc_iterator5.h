@@ -28,8 +28,9 @@ struct _sc_iterator5
   sc_iterator5_type type;         // iterator type (search template)
   sc_iterator_param params[5];    // parameters array
   sc_iterator_result results[5];  // results array (same size as params)
-  sc_iterator3 * it_main;         // iterator of main arc
-  sc_iterator3 * it_attr;         // iterator of attribute arc
+  sc_iterator3 it_main;           // iterator of main arc
+  sc_iterator3 it_attr;           // iterator of attribute arc
+  sc_bool is_inner_initialized;   // SC_TRUE if inner iterator is initialized for current result of outer iterator
   sc_memory_context const * ctx;  // pointer to used memory context
 };
 
@@ -44,6 +45,23 @@ _SC_EXTERN sc_iterator5 * sc_iterator5_new(
     sc_iterator_param p4,
     sc_iterator_param p5);
 
+/*! Initialize sc-iterator-5 in caller-provided storage. Unlike `sc_iterator5_new` it doesn't allocate memory, so
+ * initialized iterator may be placed on stack and mustn't be freed by `sc_iterator5_free`.
+ * @param it Pointer to storage of iterator
+ * @param type Iterator type (search template)
+ * @return Return SC_TRUE, if iterator initialized; otherwise return SC_FALSE if parameters invalid for specified
+ * iterator type.
+ */
+_SC_EXTERN sc_bool sc_iterator5_init(
+    sc_iterator5 * it,
+    sc_memory_context const * ctx,
+    sc_iterator5_type type,
+    sc_iterator_param p1,
+    sc_iterator_param p2,
+    sc_iterator_param p3,
+    sc_iterator_param p4,
+    sc_iterator_param p5);
+
 /*! Generate new sc-iterator5
  * @param type Iterator type (search template)
  * @param p1 First element type
@@ -28,20 +28,15 @@ void sc_segment_free(sc_segment * segment)
   sc_mem_free(segment);
 }
 
-void sc_segment_collect_elements_stat(sc_segment * seg, sc_stat * stat)
+void sc_segment_count_elements(sc_segment * seg, sc_storage_stat_manager * manager)
 {
-  for (sc_addr_offset i = 0; i < seg->last_engaged_offset; ++i)
+  // sc-element with zero offset stores the segment list links, not sc-element
+  for (sc_addr_offset i = 1; i < SC_SEGMENT_ELEMENTS_COUNT; ++i)
   {
-    sc_element element = seg->elements[i];
-    if ((element.flags.states & SC_STATE_ELEMENT_EXIST) == 0)
+    sc_element const * element = &seg->elements[i];
+    if ((element->flags.states & SC_STATE_ELEMENT_EXIST) == 0)
       continue;
 
-    sc_type type = element.flags.type;
-    if (sc_type_has_subtype(type, sc_type_node))
-      stat->node_count++;
-    else if (sc_type_has_subtype(type, sc_type_link))
-      stat->link_count++;
-    else if (sc_type_has_subtype_in_mask(type, sc_type_arc_mask))
-      stat->arc_count++;
+    sc_storage_stat_manager_add_element(manager, element->flags.type);
   }
 }
@@ -10,6 +10,7 @@
 #include "sc_types.h"
 #include "sc_defines.h"
 #include "sc_element.h"
+#include "sc_storage_stat_manager.h"
 #include "sc-container/sc-list/sc_list.h"
 #include "sc-base/sc_monitor.h"
 
@@ -33,7 +34,7 @@ sc_segment * sc_segment_new(sc_addr_seg num);
 
 void sc_segment_free(sc_segment * segment);
 
-//! Collects segment elements statistics
-void sc_segment_collect_elements_stat(sc_segment * seg, sc_stat * stat);
+//! Counts existing segment elements in sc-storage statistics
+void sc_segment_count_elements(sc_segment * seg, sc_storage_stat_manager * manager);
 
 #endif
@@ -6,6 +6,8 @@
 
 #include "sc_storage.h"
 
+#include <stdlib.h>
+
 #include "sc_segment.h"
 #include "sc_element.h"
 
@@ -16,13 +18,33 @@
 #include "../sc_memory_private.h"
 
 #include "../sc_keynodes.h"
+#include "../sc_helper_private.h"
+#include "../sc_memory_context_manager.h"
 
 #include "sc_stream_memory.h"
 #include "sc-base/sc_allocator.h"
+#include "sc-base/sc_atomic.h"
+#include "sc-base/sc_metrics.h"
 #include "sc-container/sc-string/sc_string.h"
 
 sc_storage * storage = null_ptr;
 
+void _sc_storage_build_arcs_indices(sc_segment * segment)
+{
+  // sc-element with zero offset stores the segment list links, not sc-element
+  for (sc_addr_offset i = 1; i < SC_SEGMENT_ELEMENTS_COUNT; ++i)
+  {
+    sc_element * element = &segment->elements[i];
+    if ((element->flags.states & SC_STATE_ELEMENT_EXIST) == 0)
+      continue;
+
+    sc_bool const is_indexed = (element->flags.states & SC_STATE_ARCS_INDEXED) == SC_STATE_ARCS_INDEXED;
+    element->flags.states &= ~SC_STATE_ARCS_INDEXED;
+    if (is_indexed || element->outgoing_arcs_count >= SC_STORAGE_ARCS_INDEX_MIN_ARCS_COUNT)
+      sc_storage_arcs_index_build(storage->arcs_index, (sc_addr){segment->num, i}, element);
+  }
+}
+
 sc_result sc_storage_initialize(sc_memory_params const * params)
 {
   if (sc_fs_memory_initialize_ext(params) != SC_FS_MEMORY_OK)
@@ -36,6 +58,10 @@ sc_result sc_storage_initialize(sc_memory_params const * params)
   storage->segments = sc_mem_new(sc_segment *, params->max_loaded_segments);
   sc_monitor_init(&storage->segments_monitor);
   _sc_monitor_table_init(&storage->addr_monitors_table);
+  sc_storage_stat_manager_initialize(&storage->stat_manager);
+  sc_storage_arcs_index_initialize(&storage->arcs_index);
+  sc_metrics_reset();
+  storage->local_permissions_epoch = 0;
 
   sc_memory_info("Sc-memory configuration:");
   sc_message("\tClean on initialize: %s", params->clear ? "On" : "Off");
@@ -53,6 +79,20 @@ sc_result sc_storage_initialize(sc_memory_params const * params)
   {
     sc_monitor_acquire_write(&storage->segments_monitor);
     result = sc_fs_memory_load(storage) == SC_FS_MEMORY_OK;
+
+    // loaded sc-elements are counted once, then counters are updated on generation and erasure of sc-elements
+    for (sc_addr_seg i = 0; i < storage->segments_count; ++i)
+    {
+      if (storage->segments[i] != null_ptr)
+        sc_segment_count_elements(storage->segments[i], storage->stat_manager);
+    }
+
+    // indices of outgoing sc-arcs aren't saved, they are built again for loaded hubs
+    for (sc_addr_seg i = 0; i < storage->segments_count; ++i)
+    {
+      if (storage->segments[i] != null_ptr)
+        _sc_storage_build_arcs_indices(storage->segments[i]);
+    }
     sc_monitor_release_write(&storage->segments_monitor);
   }
 
@@ -116,6 +156,8 @@ error:
   sc_mem_free(storage->segments);
   sc_monitor_destroy(&storage->segments_monitor);
   _sc_monitor_table_destroy(&storage->addr_monitors_table);
+  sc_storage_stat_manager_shutdown(storage->stat_manager);
+  sc_storage_arcs_index_shutdown(storage->arcs_index);
   sc_mem_free(storage);
   storage = null_ptr;
 
@@ -142,6 +184,25 @@ sc_event_subscription_manager * sc_storage_get_event_subscription_manager()
   return storage ? storage->events_subscription_manager : null_ptr;
 }
 
+sc_uint32 sc_storage_get_local_permissions_epoch()
+{
+  return storage ? (sc_uint32)sc_atomic_int_get(&storage->local_permissions_epoch) : 0;
+}
+
+void sc_storage_invalidate_local_permissions()
+{
+  if (storage != null_ptr)
+    sc_atomic_int_inc(&storage->local_permissions_epoch);
+}
+
+//! Checks if outgoing sc-arcs of sc-element are indexed by their sc-types.
+#define _sc_storage_has_arcs_index(_element) \
+  (((_element)->flags.states & SC_STATE_ARCS_INDEXED) == SC_STATE_ARCS_INDEXED)
+
+//! Checks if sc-element is a sc-structure with local permissions of users.
+#define _sc_storage_is_permitted_structure(_element) \
+  (((_element)->flags.states & SC_CONTEXT_PERMITTED_STRUCTURE) == SC_CONTEXT_PERMITTED_STRUCTURE)
+
 sc_bool sc_storage_is_element(sc_memory_context const * ctx, sc_addr addr)
 {
   sc_element * el = null_ptr;
@@ -172,6 +233,17 @@ error:
   return result;
 }
 
+//! Removes sc-element from statistics, local permissions and indices before its slot is released.
+static void _sc_storage_forget_element(sc_addr addr, sc_element const * element)
+{
+  sc_storage_stat_manager_remove_element(storage->stat_manager, element->flags.type);
+  sc_helper_invalidate_system_identifier(addr, element);
+  if (_sc_storage_is_permitted_structure(element))
+    sc_storage_invalidate_local_permissions();
+  if (_sc_storage_has_arcs_index(element))
+    sc_storage_arcs_index_remove_element(storage->arcs_index, addr);
+}
+
 sc_result sc_storage_free_element(sc_addr addr)
 {
   sc_result result = SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
@@ -186,6 +258,8 @@ sc_result sc_storage_free_element(sc_addr addr)
   if (segment == null_ptr)
     goto error;
 
+  _sc_storage_forget_element(addr, element);
+
   sc_monitor_acquire_write(&segment->monitor);
   sc_addr_offset const last_released_offset = segment->last_released_offset;
   segment->elements[addr.offset] = (sc_element){(sc_element_flags){.type = last_released_offset}};
@@ -399,6 +473,8 @@ sc_element * sc_storage_allocate_new_element(sc_memory_context const * ctx, sc_a
   *addr = SC_ADDR_EMPTY;
   sc_element * element = null_ptr;
 
+  SC_METRICS_START(start_time);
+
   element = _sc_storage_get_element(addr);
   if (element == null_ptr)
   {
@@ -412,6 +488,8 @@ sc_element * sc_storage_allocate_new_element(sc_memory_context const * ctx, sc_a
   if (element != null_ptr)
     element->flags.states |= SC_STATE_ELEMENT_EXIST;
 
+  SC_METRICS_RECORD(SC_METRIC_ELEMENT_ALLOCATION, start_time);
+
   return element;
 }
 
@@ -459,99 +537,101 @@ end:
   sc_monitor_release_write(&storage->processes_monitor);
 }
 
-sc_result _sc_storage_element_erase(sc_addr addr)
+sc_monitor * _sc_storage_get_neighbour_connector_monitor(
+    sc_addr connector_addr,
+    sc_addr begin_addr,
+    sc_monitor const * beg_monitor,
+    sc_addr end_addr,
+    sc_monitor const * end_monitor)
+{
+  // monitors of begin and end sc-elements are already acquired
+  if ((beg_monitor != null_ptr && SC_ADDR_IS_EQUAL(connector_addr, begin_addr))
+      || (end_monitor != null_ptr && SC_ADDR_IS_EQUAL(connector_addr, end_addr)))
+    return null_ptr;
+
+  return sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, connector_addr);
+}
+
+/*! Excludes the specified sc-connector from lists of sc-connectors of its begin and end sc-elements. If the begin or
+ * end sc-element is erased together with the sc-connector, then all sc-connectors from its lists are erased too, so its
+ * lists are not updated.
+ */
+void _sc_storage_connector_unlink(
+    sc_addr addr,
+    sc_element * element,
+    sc_bool is_begin_erased,
+    sc_bool is_end_erased)
 {
   sc_result result;
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
-  sc_monitor_acquire_write(monitor);
+  sc_bool const is_edge = sc_type_has_subtype(element->flags.type, sc_type_edge_common);
 
-  sc_element * element;
-  result = sc_storage_get_element_by_addr(addr, &element);
-  if (result != SC_RESULT_OK || (element->flags.states & SC_STATE_REQUEST_DELETION) == SC_STATE_REQUEST_DELETION)
-  {
-    sc_monitor_release_write(monitor);
-    return result;
-  }
+  sc_addr begin_addr = element->arc.begin;
+  sc_addr end_addr = element->arc.end;
 
-  element->flags.states |= SC_STATE_REQUEST_DELETION;
-  sc_type type = element->flags.type;
+  sc_bool const is_not_loop = SC_ADDR_IS_NOT_EQUAL(begin_addr, end_addr);
 
-  sc_monitor_release_write(monitor);
+  sc_monitor * beg_monitor = is_begin_erased
+                                 ? null_ptr
+                                 : sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, begin_addr);
+  sc_monitor * end_monitor =
+      is_end_erased ? null_ptr : sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, end_addr);
 
-  if (sc_type_has_subtype(type, sc_type_link))
-    sc_fs_memory_unlink_string(SC_ADDR_LOCAL_TO_INT(addr));
-  else if (sc_type_has_subtype_in_mask(type, sc_type_arc_mask))
+  sc_monitor_acquire_write_n(2, beg_monitor, end_monitor);
+
+  // outgoing sc-arcs
+  sc_addr prev_out_connector_addr = element->arc.prev_begin_out_arc;
+  sc_addr next_out_connector_addr = element->arc.next_begin_out_arc;
+  sc_monitor * prev_out_arc_monitor = null_ptr;
+  sc_monitor * next_out_arc_monitor = null_ptr;
+  if (is_begin_erased == SC_FALSE)
   {
-    sc_bool const is_edge = sc_type_has_subtype(type, sc_type_edge_common);
-
-    sc_addr begin_addr = element->arc.begin;
-    sc_addr end_addr = element->arc.end;
-
-    sc_bool const is_not_loop = SC_ADDR_IS_NOT_EQUAL(begin_addr, end_addr);
-
-    sc_monitor * beg_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, begin_addr);
-    sc_monitor * end_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, end_addr);
-
-    sc_monitor_acquire_write_n(2, beg_monitor, end_monitor);
-
-    // outgoing sc-arcs
-    sc_addr prev_out_connector_addr = element->arc.prev_begin_out_arc;
-    sc_monitor * prev_out_arc_monitor = null_ptr;
-    if (SC_ADDR_IS_NOT_EQUAL(begin_addr, prev_out_connector_addr)
-        && SC_ADDR_IS_NOT_EQUAL(end_addr, prev_out_connector_addr))
-      prev_out_arc_monitor =
-          sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, prev_out_connector_addr);
-
-    sc_addr next_out_connector_addr = element->arc.next_begin_out_arc;
-    sc_monitor * next_out_arc_monitor = null_ptr;
-    if (SC_ADDR_IS_NOT_EQUAL(begin_addr, next_out_connector_addr)
-        && SC_ADDR_IS_NOT_EQUAL(end_addr, next_out_connector_addr))
-      next_out_arc_monitor =
-          sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, next_out_connector_addr);
-
-    // incoming sc-arcs
-    sc_addr prev_in_connector_addr = element->arc.prev_end_in_arc;
-    sc_monitor * prev_in_arc_monitor = null_ptr;
-    if (SC_ADDR_IS_NOT_EQUAL(begin_addr, prev_in_connector_addr)
-        && SC_ADDR_IS_NOT_EQUAL(end_addr, prev_in_connector_addr))
-      prev_in_arc_monitor =
-          sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, prev_in_connector_addr);
-
-    sc_addr next_in_arc = element->arc.next_end_in_arc;
-    sc_monitor * next_in_arc_monitor = null_ptr;
-    if (SC_ADDR_IS_NOT_EQUAL(begin_addr, next_in_arc) && SC_ADDR_IS_NOT_EQUAL(end_addr, next_in_arc))
-      next_in_arc_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, next_in_arc);
+    prev_out_arc_monitor = _sc_storage_get_neighbour_connector_monitor(
+        prev_out_connector_addr, begin_addr, beg_monitor, end_addr, end_monitor);
+    next_out_arc_monitor = _sc_storage_get_neighbour_connector_monitor(
+        next_out_connector_addr, begin_addr, beg_monitor, end_addr, end_monitor);
+  }
 
-#ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
-    sc_addr prev_in_arc_from_structure = element->arc.prev_in_arc_from_structure;
-    sc_monitor * prev_in_arc_from_structure_monitor = null_ptr;
-    if (SC_ADDR_IS_NOT_EQUAL(begin_addr, prev_in_arc_from_structure)
-        && SC_ADDR_IS_NOT_EQUAL(end_addr, prev_in_arc_from_structure))
-      prev_in_arc_from_structure_monitor =
-          sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, prev_in_arc_from_structure);
-
-    sc_addr next_in_arc_from_structure_addr = element->arc.next_in_arc_from_structure;
-    sc_monitor * next_in_arc_from_structure_monitor = null_ptr;
-    if (SC_ADDR_IS_NOT_EQUAL(begin_addr, next_in_arc_from_structure_addr)
-        && SC_ADDR_IS_NOT_EQUAL(end_addr, next_in_arc_from_structure_addr))
-      next_in_arc_from_structure_monitor =
-          sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, next_in_arc_from_structure_addr);
-#endif
+  // incoming sc-arcs
+  sc_addr prev_in_connector_addr = element->arc.prev_end_in_arc;
+  sc_addr next_in_arc = element->arc.next_end_in_arc;
+  sc_monitor * prev_in_arc_monitor = null_ptr;
+  sc_monitor * next_in_arc_monitor = null_ptr;
+  if (is_end_erased == SC_FALSE)
+  {
+    prev_in_arc_monitor = _sc_storage_get_neighbour_connector_monitor(
+        prev_in_connector_addr, begin_addr, beg_monitor, end_addr, end_monitor);
+    next_in_arc_monitor =
+        _sc_storage_get_neighbour_connector_monitor(next_in_arc, begin_addr, beg_monitor, end_addr, end_monitor);
+  }
 
 #ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
-    sc_monitor_acquire_write_n(
-        6,
-        prev_out_arc_monitor,
-        next_out_arc_monitor,
-        prev_in_arc_monitor,
-        next_in_arc_monitor,
-        prev_in_arc_from_structure_monitor,
-        next_in_arc_from_structure_monitor);
+  sc_addr prev_in_arc_from_structure = element->arc.prev_in_arc_from_structure;
+  sc_addr next_in_arc_from_structure_addr = element->arc.next_in_arc_from_structure;
+  sc_monitor * prev_in_arc_from_structure_monitor = null_ptr;
+  sc_monitor * next_in_arc_from_structure_monitor = null_ptr;
+  if (is_end_erased == SC_FALSE)
+  {
+    prev_in_arc_from_structure_monitor = _sc_storage_get_neighbour_connector_monitor(
+        prev_in_arc_from_structure, begin_addr, beg_monitor, end_addr, end_monitor);
+    next_in_arc_from_structure_monitor = _sc_storage_get_neighbour_connector_monitor(
+        next_in_arc_from_structure_addr, begin_addr, beg_monitor, end_addr, end_monitor);
+  }
+
+  sc_monitor_acquire_write_n(
+      6,
+      prev_out_arc_monitor,
+      next_out_arc_monitor,
+      prev_in_arc_monitor,
+      next_in_arc_monitor,
+      prev_in_arc_from_structure_monitor,
+      next_in_arc_from_structure_monitor);
 #else
-    sc_monitor_acquire_write_n(3, prev_out_arc_monitor, next_out_arc_monitor, prev_in_arc_monitor, next_in_arc_monitor);
+  sc_monitor_acquire_write_n(4, prev_out_arc_monitor, next_out_arc_monitor, prev_in_arc_monitor, next_in_arc_monitor);
 #endif
 
+  if (is_begin_erased == SC_FALSE)
+  {
     if (SC_ADDR_IS_NOT_EMPTY(prev_out_connector_addr))
     {
       sc_element * prev_el_arc;
@@ -577,6 +657,13 @@ sc_result _sc_storage_element_erase(sc_addr addr)
 
       --b_el->outgoing_arcs_count;
 
+      if (!is_edge && _sc_storage_has_arcs_index(b_el))
+        sc_storage_arcs_index_remove_arc(storage->arcs_index, begin_addr, addr);
+
+      if (sc_type_is_structure_and_arc(b_el->flags.type, element->flags.type)
+          && _sc_storage_is_permitted_structure(b_el))
+        sc_storage_invalidate_local_permissions();
+
       if (is_edge && is_not_loop)
       {
         if (SC_ADDR_IS_EQUAL(addr, b_el->first_in_arc))
@@ -585,7 +672,10 @@ sc_result _sc_storage_element_erase(sc_addr addr)
         --b_el->incoming_arcs_count;
       }
     }
+  }
 
+  if (is_end_erased == SC_FALSE)
+  {
     if (SC_ADDR_IS_NOT_EMPTY(prev_in_connector_addr))
     {
       sc_element * prev_el_arc;
@@ -642,47 +732,122 @@ sc_result _sc_storage_element_erase(sc_addr addr)
         --e_el->outgoing_arcs_count;
       }
     }
+  }
 
 #ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
-    sc_monitor_release_write_n(
-        6,
-        prev_out_arc_monitor,
-        next_out_arc_monitor,
-        prev_in_arc_monitor,
-        next_in_arc_monitor,
-        prev_in_arc_from_structure_monitor,
-        next_in_arc_from_structure_monitor);
+  sc_monitor_release_write_n(
+      6,
+      prev_out_arc_monitor,
+      next_out_arc_monitor,
+      prev_in_arc_monitor,
+      next_in_arc_monitor,
+      prev_in_arc_from_structure_monitor,
+      next_in_arc_from_structure_monitor);
 #else
-    sc_monitor_release_write_n(4, prev_out_arc_monitor, next_out_arc_monitor, prev_in_arc_monitor, next_in_arc_monitor);
+  sc_monitor_release_write_n(4, prev_out_arc_monitor, next_out_arc_monitor, prev_in_arc_monitor, next_in_arc_monitor);
 #endif
-    sc_monitor_release_write_n(2, beg_monitor, end_monitor);
+  sc_monitor_release_write_n(2, beg_monitor, end_monitor);
+}
+
+int _sc_storage_compare_addrs(void const * first, void const * second)
+{
+  sc_uint32 const first_hash = SC_ADDR_LOCAL_TO_INT(*(sc_addr const *)first);
+  sc_uint32 const second_hash = SC_ADDR_LOCAL_TO_INT(*(sc_addr const *)second);
+  return (first_hash > second_hash) - (first_hash < second_hash);
+}
+
+/*! Releases slots of the specified sc-elements. Slots are released grouped by sc-segments, so each sc-segment is
+ * locked once.
+ */
+void _sc_storage_free_elements(sc_addr * addrs, sc_uint32 count)
+{
+  // sc-elements become invisible for readers before their slots are released
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addrs[i]);
+    sc_monitor_acquire_write(monitor);
+    sc_element * element;
+    if (sc_storage_get_element_by_addr(addrs[i], &element) == SC_RESULT_OK)
+    {
+      element->flags.states &= ~SC_STATE_ELEMENT_EXIST;
+      _sc_storage_forget_element(addrs[i], element);
+    }
+    sc_monitor_release_write(monitor);
   }
 
-  sc_monitor_acquire_write(monitor);
-  sc_storage_free_element(addr);
-  sc_monitor_release_write(monitor);
+  qsort(addrs, count, sizeof(sc_addr), _sc_storage_compare_addrs);
 
-  // erase registered events before deletion
-  sc_event_notify_element_deleted(addr);
+  sc_uint32 group_begin = 0;
+  while (group_begin < count)
+  {
+    sc_addr_seg const segment_num = addrs[group_begin].seg;
+    sc_uint32 group_end = group_begin + 1;
+    while (group_end < count && addrs[group_end].seg == segment_num)
+      ++group_end;
+
+    sc_monitor_acquire_read(&storage->segments_monitor);
+    sc_segment * segment = storage->segments[segment_num - 1];
+    sc_monitor_release_read(&storage->segments_monitor);
+
+    sc_monitor_acquire_write(&segment->monitor);
+    sc_addr_offset const last_released_offset = segment->last_released_offset;
+    for (sc_uint32 i = group_begin; i < group_end; ++i)
+    {
+      segment->elements[addrs[i].offset] =
+          (sc_element){(sc_element_flags){.type = segment->last_released_offset}};
+      segment->last_released_offset = addrs[i].offset;
+    }
+    sc_monitor_release_write(&segment->monitor);
 
-  return result;
+    if (last_released_offset == 0)
+    {
+      sc_monitor_acquire_write(&storage->segments_monitor);
+      segment->elements[0].flags.type = storage->last_released_segment_num;
+      storage->last_released_segment_num = segment->num;
+      sc_monitor_release_write(&storage->segments_monitor);
+    }
+
+    group_begin = group_end;
+  }
 }
 
 sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
 {
-  sc_result result;
+  return sc_storage_elements_erase(ctx, &addr, 1);
+}
 
-  sc_element * el = null_ptr;
-  result = sc_storage_get_element_by_addr(addr, &el);
-  if (result != SC_RESULT_OK)
-    goto error;
+sc_result sc_storage_elements_erase(sc_memory_context const * ctx, sc_addr const * addrs, sc_uint32 count)
+{
+  sc_result result = SC_RESULT_OK;
+
+  _sc_event_emission_manager_wait_for_queue(storage->events_emission_manager);
+
+  SC_METRICS_START(start_time);
 
   sc_hash_table * cache_table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
 
+  sc_element * el = null_ptr;
+  sc_pointer p_addr;
   sc_queue iter_queue;
   sc_queue_init(&iter_queue);
-  sc_pointer p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(addr));
-  sc_queue_push(&iter_queue, p_addr);
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    if (sc_storage_get_element_by_addr(addrs[i], &el) != SC_RESULT_OK)
+    {
+      result = SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
+      continue;
+    }
+
+    p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(addrs[i]));
+    if (sc_hash_table_get(cache_table, p_addr) != null_ptr)
+      continue;
+
+    sc_hash_table_insert(cache_table, p_addr, el);
+    sc_queue_push(&iter_queue, p_addr);
+  }
+
+  // sc-elements which erasure is deferred by subscribers of sc-events can remain in lists of erased sc-elements
+  sc_bool has_deferred_elements = SC_FALSE;
 
   sc_queue addrs_with_not_emitted_erase_events;
   sc_queue_init(&addrs_with_not_emitted_erase_events);
@@ -696,8 +861,7 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
 
     sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, element_addr);
     sc_monitor_acquire_read(monitor);
-    result = sc_storage_get_element_by_addr(element_addr, &el);
-    if (result != SC_RESULT_OK)
+    if (sc_storage_get_element_by_addr(element_addr, &el) != SC_RESULT_OK)
     {
       sc_monitor_release_read(monitor);
       continue;
@@ -797,6 +961,7 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
         || erase_incoming_arc_result == SC_RESULT_OK || erase_outgoing_arc_result == SC_RESULT_OK
         || erase_element_result == SC_RESULT_OK)
     {
+      has_deferred_elements = SC_TRUE;
       sc_monitor_release_read(monitor);
       continue;
     }
@@ -811,8 +976,7 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
       sc_element * connector = sc_hash_table_get(cache_table, p_addr);
       if (connector == null_ptr)
       {
-        result = sc_storage_get_element_by_addr(connector_addr, &connector);
-        if (result != SC_RESULT_OK)
+        if (sc_storage_get_element_by_addr(connector_addr, &connector) != SC_RESULT_OK)
           break;
 
         sc_hash_table_insert(cache_table, p_addr, connector);
@@ -830,8 +994,7 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
       sc_element * connector = sc_hash_table_get(cache_table, p_addr);
       if (connector == null_ptr)
       {
-        result = sc_storage_get_element_by_addr(connector_addr, &connector);
-        if (result != SC_RESULT_OK)
+        if (sc_storage_get_element_by_addr(connector_addr, &connector) != SC_RESULT_OK)
           break;
 
         sc_hash_table_insert(cache_table, p_addr, connector);
@@ -847,19 +1010,67 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
   sc_queue_destroy(&iter_queue);
   sc_hash_table_destroy(cache_table);
 
+  // mark sc-elements as erased by this call, the other ones are erased by other calls
+  sc_hash_table * erased_table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  sc_addr * erased_addrs = sc_mem_new(sc_addr, addrs_with_not_emitted_erase_events.size);
+  sc_uint32 erased_count = 0;
   while (!sc_queue_empty(&addrs_with_not_emitted_erase_events))
   {
-    sc_addr_hash addr_int = (sc_pointer_to_sc_addr_hash)sc_queue_pop(&addrs_with_not_emitted_erase_events);
-    addr.seg = SC_ADDR_LOCAL_SEG_FROM_INT(addr_int);
-    addr.offset = SC_ADDR_LOCAL_OFFSET_FROM_INT(addr_int);
+    p_addr = sc_queue_pop(&addrs_with_not_emitted_erase_events);
 
-    _sc_storage_element_erase(addr);
-  }
+    sc_addr element_addr;
+    element_addr.seg = SC_ADDR_LOCAL_SEG_FROM_INT((sc_pointer_to_sc_addr_hash)p_addr);
+    element_addr.offset = SC_ADDR_LOCAL_OFFSET_FROM_INT((sc_pointer_to_sc_addr_hash)p_addr);
+
+    sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, element_addr);
+    sc_monitor_acquire_write(monitor);
+    if (sc_storage_get_element_by_addr(element_addr, &el) != SC_RESULT_OK
+        || (el->flags.states & SC_STATE_REQUEST_DELETION) == SC_STATE_REQUEST_DELETION)
+    {
+      sc_monitor_release_write(monitor);
+      continue;
+    }
+
+    el->flags.states |= SC_STATE_REQUEST_DELETION;
+    sc_monitor_release_write(monitor);
 
+    erased_addrs[erased_count++] = element_addr;
+    sc_hash_table_insert(erased_table, p_addr, el);
+  }
   sc_queue_destroy(&addrs_with_not_emitted_erase_events);
 
-  result = SC_RESULT_OK;
-error:
+  // slots of sc-elements are released after all sc-connectors are unlinked, so sc-elements from lists are still valid
+  for (sc_uint32 i = 0; i < erased_count; ++i)
+  {
+    el = sc_hash_table_get(erased_table, GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(erased_addrs[i])));
+    sc_type const type = el->flags.type;
+
+    if (sc_type_has_subtype(type, sc_type_link))
+      sc_fs_memory_unlink_string(SC_ADDR_LOCAL_TO_INT(erased_addrs[i]));
+    else if (sc_type_has_subtype_in_mask(type, sc_type_arc_mask))
+    {
+      sc_bool is_begin_erased =
+          has_deferred_elements == SC_FALSE
+          && sc_hash_table_get(erased_table, GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(el->arc.begin))) != null_ptr;
+      sc_bool is_end_erased =
+          has_deferred_elements == SC_FALSE
+          && sc_hash_table_get(erased_table, GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(el->arc.end))) != null_ptr;
+      // sc-edges are in lists of both their sc-elements, so these lists can be skipped only together
+      if (sc_type_has_subtype(type, sc_type_edge_common))
+        is_begin_erased = is_end_erased = is_begin_erased && is_end_erased;
+      _sc_storage_connector_unlink(erased_addrs[i], el, is_begin_erased, is_end_erased);
+    }
+  }
+  sc_hash_table_destroy(erased_table);
+
+  _sc_storage_free_elements(erased_addrs, erased_count);
+
+  // erase registered events before deletion
+  sc_event_notify_elements_deleted(erased_addrs, erased_count);
+  sc_mem_free(erased_addrs);
+
+  SC_METRICS_RECORD(SC_METRIC_ELEMENT_ERASURE, start_time);
+
   return result;
 }
 
@@ -887,6 +1098,7 @@ sc_addr sc_storage_node_new_ext(sc_memory_context const * ctx, sc_type type, sc_
   }
 
   element->flags.type = sc_type_node | type;
+  sc_storage_stat_manager_add_element(storage->stat_manager, element->flags.type);
   *result = SC_RESULT_OK;
   return addr;
 }
@@ -915,10 +1127,92 @@ sc_addr sc_storage_link_new_ext(sc_memory_context const * ctx, sc_type type, sc_
   }
 
   element->flags.type = sc_type_link | type;
+  sc_storage_stat_manager_add_element(storage->stat_manager, element->flags.type);
   *result = SC_RESULT_OK;
   return addr;
 }
 
+sc_type _sc_storage_get_node_or_link_type(sc_type type)
+{
+  return sc_type_has_subtype(type, sc_type_link) ? type : sc_type_node | type;
+}
+
+sc_uint32 _sc_storage_get_elements(sc_type const * types, sc_uint32 count, sc_addr * addrs)
+{
+  sc_uint32 allocated_count = 0;
+
+  SC_METRICS_START(start_time);
+
+  sc_segment * segment = _sc_storage_get_segment();
+  if (segment == null_ptr)
+    goto error;
+
+  // all sc-elements that fit in segment are engaged under one lock of it
+  sc_monitor_acquire_write(&segment->monitor);
+
+  for (; allocated_count < count; ++allocated_count)
+  {
+    sc_addr_offset element_offset;
+    if (segment->last_engaged_offset + 1 != SC_SEGMENT_ELEMENTS_COUNT)
+      element_offset = ++segment->last_engaged_offset;
+    else if (segment->last_released_offset != 0)
+    {
+      element_offset = segment->last_released_offset;
+      segment->last_released_offset = segment->elements[element_offset].flags.type;
+    }
+    else
+      break;
+
+    sc_element * element = &segment->elements[element_offset];
+    element->flags.type = _sc_storage_get_node_or_link_type(types[allocated_count]);
+    sc_storage_stat_manager_add_element(storage->stat_manager, element->flags.type);
+    element->flags.states |= SC_STATE_ELEMENT_EXIST;
+
+    addrs[allocated_count] = (sc_addr){segment->num, element_offset};
+  }
+
+  sc_monitor_release_write(&segment->monitor);
+
+error:
+  SC_METRICS_RECORD_BATCH(SC_METRIC_ELEMENT_ALLOCATION, start_time, allocated_count);
+  return allocated_count;
+}
+
+sc_result sc_storage_nodes_and_links_new_ext(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_uint32 count,
+    sc_addr * addrs)
+{
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    if (sc_type_has_subtype_in_mask(types[i], sc_type_arc_mask))
+      return SC_RESULT_ERROR_ELEMENT_IS_NOT_NODE;
+  }
+
+  sc_uint32 allocated_count = _sc_storage_get_elements(types, count, addrs);
+
+  // the rest sc-elements are allocated one by one in other segments
+  for (; allocated_count < count; ++allocated_count)
+  {
+    sc_element * element = sc_storage_allocate_new_element(ctx, &addrs[allocated_count]);
+    if (element == null_ptr)
+    {
+      for (sc_uint32 i = 0; i < allocated_count; ++i)
+      {
+        sc_storage_free_element(addrs[i]);
+        addrs[i] = SC_ADDR_EMPTY;
+      }
+      return SC_RESULT_ERROR_FULL_MEMORY;
+    }
+
+    element->flags.type = _sc_storage_get_node_or_link_type(types[allocated_count]);
+    sc_storage_stat_manager_add_element(storage->stat_manager, element->flags.type);
+  }
+
+  return SC_RESULT_OK;
+}
+
 void _sc_storage_make_elements_incident_to_arc(
     sc_addr connector_addr,
     sc_element * arc_el,
@@ -1029,6 +1323,8 @@ sc_addr sc_storage_arc_new_ext(
 {
   sc_addr connector_addr = SC_ADDR_EMPTY;
 
+  _sc_event_emission_manager_wait_for_queue(storage->events_emission_manager);
+
   if (sc_type_has_not_subtype_in_mask(type, sc_type_arc_mask))
   {
     *result = SC_RESULT_ERROR_ELEMENT_IS_NOT_CONNECTOR;
@@ -1051,6 +1347,7 @@ sc_addr sc_storage_arc_new_ext(
   }
 
   arc_el->flags.type = type;
+  sc_storage_stat_manager_add_element(storage->stat_manager, type);
   arc_el->arc.begin = beg_addr;
   arc_el->arc.end = end_addr;
 
@@ -1080,6 +1377,17 @@ sc_addr sc_storage_arc_new_ext(
     _sc_storage_update_structure_arcs(connector_addr, arc_el, beg_addr, end_addr, end_el);
 #endif
 
+  if (sc_type_is_structure_and_arc(beg_el->flags.type, type) && _sc_storage_is_permitted_structure(beg_el))
+    sc_storage_invalidate_local_permissions();
+
+  if (is_edge == SC_FALSE)
+  {
+    if (_sc_storage_has_arcs_index(beg_el))
+      sc_storage_arcs_index_add_arc(storage->arcs_index, beg_addr, connector_addr, type, end_addr);
+    else if (beg_el->outgoing_arcs_count >= SC_STORAGE_ARCS_INDEX_MIN_ARCS_COUNT)
+      sc_storage_arcs_index_build(storage->arcs_index, beg_addr, beg_el);
+  }
+
   // emit events
   if (is_edge && is_not_loop)
   {
@@ -1179,6 +1487,98 @@ error:
   return result;
 }
 
+typedef void (*_sc_storage_read_element_callback)(sc_element const * element, sc_uint32 index, void * data);
+
+/*! Reads the specified sc-elements grouped by sc-segments. The lock of each sc-segment is taken once for all its
+ * sc-elements, and it prevents them from being freed while they are read. For sc-elements that don't exist the callback
+ * is called with null pointer.
+ */
+void _sc_storage_read_elements_by_segments(
+    sc_addr const * addrs,
+    sc_uint32 count,
+    _sc_storage_read_element_callback callback,
+    void * data)
+{
+  if (count == 0)
+    return;
+
+  sc_monitor_acquire_read(&storage->segments_monitor);
+  sc_addr_seg const segments_count = storage->segments_count;
+  sc_monitor_release_read(&storage->segments_monitor);
+
+  // sc-addresses are grouped by counting sort, the first group contains sc-addresses of not loaded sc-segments
+  sc_uint32 * group_offsets = sc_mem_new(sc_uint32, segments_count + 2);
+  for (sc_uint32 i = 0; i < count; ++i)
+    ++group_offsets[(addrs[i].seg <= segments_count ? addrs[i].seg : 0) + 1];
+  for (sc_uint32 group = 1; group <= segments_count + 1; ++group)
+    group_offsets[group] += group_offsets[group - 1];
+
+  sc_uint32 * indices = sc_mem_new(sc_uint32, count);
+  for (sc_uint32 i = 0; i < count; ++i)
+    indices[group_offsets[addrs[i].seg <= segments_count ? addrs[i].seg : 0]++] = i;
+
+  sc_uint32 group_begin = 0;
+  for (sc_addr_seg segment_num = 0; segment_num <= segments_count; ++segment_num)
+  {
+    sc_uint32 const group_end = group_offsets[segment_num];
+
+    sc_segment * segment = null_ptr;
+    if (segment_num != 0 && group_begin < group_end)
+    {
+      sc_monitor_acquire_read(&storage->segments_monitor);
+      segment = storage->segments[segment_num - 1];
+      sc_monitor_release_read(&storage->segments_monitor);
+    }
+
+    if (segment != null_ptr)
+      sc_monitor_acquire_read(&segment->monitor);
+
+    for (sc_uint32 i = group_begin; i < group_end; ++i)
+    {
+      sc_uint32 const index = indices[i];
+      sc_element * element = null_ptr;
+      // sc_storage_get_element_by_addr sets pointer to slot of erased sc-element too
+      if (segment != null_ptr && sc_storage_get_element_by_addr(addrs[index], &element) != SC_RESULT_OK)
+        element = null_ptr;
+      callback(element, index, data);
+    }
+
+    if (segment != null_ptr)
+      sc_monitor_release_read(&segment->monitor);
+
+    group_begin = group_end;
+  }
+
+  sc_mem_free(indices);
+  sc_mem_free(group_offsets);
+}
+
+void _sc_storage_read_element_existence(sc_element const * element, sc_uint32 index, void * data)
+{
+  sc_bool * results = data;
+  results[index] = element != null_ptr;
+}
+
+void sc_storage_are_elements(sc_memory_context const * ctx, sc_addr const * addrs, sc_uint32 count, sc_bool * results)
+{
+  _sc_storage_read_elements_by_segments(addrs, count, _sc_storage_read_element_existence, results);
+}
+
+void _sc_storage_read_element_type(sc_element const * element, sc_uint32 index, void * data)
+{
+  sc_type * types = data;
+  types[index] = element == null_ptr ? 0 : element->flags.type;
+}
+
+void sc_storage_get_elements_types(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_uint32 count,
+    sc_type * types)
+{
+  _sc_storage_read_elements_by_segments(addrs, count, _sc_storage_read_element_type, types);
+}
+
 sc_result sc_storage_change_element_subtype(sc_memory_context const * ctx, sc_addr addr, sc_type type)
 {
   sc_result result;
@@ -1186,7 +1586,12 @@ sc_result sc_storage_change_element_subtype(sc_memory_context const * ctx, sc_ad
   sc_element * el = null_ptr;
 
   sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
-  sc_monitor_acquire_write(monitor);
+  sc_addr begin_addr = SC_ADDR_EMPTY;
+  sc_monitor * beg_monitor = null_ptr;
+
+  // index of sc-arcs of hub is changed under the monitor of hub, so begin sc-element of sc-arc is locked too
+retry:
+  sc_monitor_acquire_write_n(2, monitor, beg_monitor);
 
   result = sc_storage_get_element_by_addr(addr, &el);
   if (result != SC_RESULT_OK)
@@ -1198,10 +1603,30 @@ sc_result sc_storage_change_element_subtype(sc_memory_context const * ctx, sc_ad
     goto error;
   }
 
+  sc_bool const is_arc = sc_type_has_subtype_in_mask(el->flags.type, sc_type_arc_access | sc_type_arc_common);
+  if (is_arc && SC_ADDR_IS_NOT_EQUAL(begin_addr, el->arc.begin))
+  {
+    sc_monitor_release_write_n(2, monitor, beg_monitor);
+    begin_addr = el->arc.begin;
+    beg_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, begin_addr);
+    goto retry;
+  }
+
+  sc_storage_stat_manager_change_element_type(storage->stat_manager, el->flags.type, type);
+  // sc-structures and their sc-arcs are selected by types when local permissions are checked
+  if (_sc_storage_is_permitted_structure(el) || sc_type_has_subtype_in_mask(el->flags.type, sc_type_arc_mask))
+    sc_storage_invalidate_local_permissions();
+  // sc-arcs from hubs are moved to index chains of their new sc-types
+  sc_element * beg_el = null_ptr;
+  if (is_arc && el->flags.type != type && sc_storage_get_element_by_addr(begin_addr, &beg_el) == SC_RESULT_OK
+      && _sc_storage_has_arcs_index(beg_el))
+    sc_storage_arcs_index_change_arc_type(storage->arcs_index, begin_addr, addr, type);
+  if (el->flags.type != type)
+    sc_helper_invalidate_system_identifier(addr, el);
   el->flags.type = type;
 
 error:
-  sc_monitor_release_write(monitor);
+  sc_monitor_release_write_n(2, monitor, beg_monitor);
   return result;
 }
 
@@ -1292,6 +1717,37 @@ error:
   return result;
 }
 
+typedef struct
+{
+  sc_addr * begin_addrs;
+  sc_addr * end_addrs;
+} _sc_storage_arcs_info;
+
+void _sc_storage_read_arc_info(sc_element const * element, sc_uint32 index, void * data)
+{
+  _sc_storage_arcs_info * info = data;
+  if (element == null_ptr || sc_type_has_not_subtype_in_mask(element->flags.type, sc_type_arc_mask))
+  {
+    info->begin_addrs[index] = SC_ADDR_EMPTY;
+    info->end_addrs[index] = SC_ADDR_EMPTY;
+    return;
+  }
+
+  info->begin_addrs[index] = element->arc.begin;
+  info->end_addrs[index] = element->arc.end;
+}
+
+void sc_storage_get_arcs_info(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_uint32 count,
+    sc_addr * begin_addrs,
+    sc_addr * end_addrs)
+{
+  _sc_storage_arcs_info info = {.begin_addrs = begin_addrs, .end_addrs = end_addrs};
+  _sc_storage_read_elements_by_segments(addrs, count, _sc_storage_read_arc_info, &info);
+}
+
 sc_result sc_storage_set_link_content(
     sc_memory_context const * ctx,
     sc_addr addr,
@@ -1300,6 +1756,8 @@ sc_result sc_storage_set_link_content(
 {
   sc_result result;
 
+  _sc_event_emission_manager_wait_for_queue(storage->events_emission_manager);
+
   sc_element * el = null_ptr;
 
   sc_char * string = null_ptr;
@@ -1332,6 +1790,7 @@ sc_result sc_storage_set_link_content(
     result = SC_RESULT_ERROR_FILE_MEMORY_IO;
     goto error;
   }
+  sc_helper_invalidate_system_identifier(addr, el);
 
   sc_event_emit(
       ctx, addr, sc_event_before_change_link_content_addr, SC_ADDR_EMPTY, 0, SC_ADDR_EMPTY, null_ptr, SC_ADDR_EMPTY);
@@ -1489,24 +1948,15 @@ error:
 
 sc_result sc_storage_get_elements_stat(sc_stat * stat)
 {
-  sc_mem_set(stat, 0, sizeof(sc_stat));
-
-  sc_monitor_acquire_read(&storage->segments_monitor);
-  sc_addr_seg count = storage->segments_count;
-  sc_monitor_release_read(&storage->segments_monitor);
-
-  for (sc_addr_seg i = 0; i < count; ++i)
-  {
-    sc_segment * segment = storage->segments[i];
-
-    sc_monitor_acquire_read(&segment->monitor);
-    sc_segment_collect_elements_stat(segment, stat);
-    sc_monitor_release_read(&segment->monitor);
-  }
-
+  sc_storage_stat_manager_get_stat(storage->stat_manager, stat);
   return SC_RESULT_OK;
 }
 
+sc_uint64 sc_storage_get_elements_count_by_type(sc_type type)
+{
+  return sc_storage_stat_manager_get_elements_count_by_type(storage->stat_manager, type);
+}
+
 sc_result sc_storage_save(sc_memory_context const * ctx)
 {
   return sc_fs_memory_save(storage) == SC_FS_MEMORY_OK ? SC_RESULT_OK : SC_RESULT_ERROR;
@@ -89,6 +89,22 @@ sc_bool sc_storage_is_initialized();
  */
 sc_bool sc_storage_is_element(sc_memory_context const * ctx, sc_addr addr);
 
+/*!
+ * @brief Checks if several sc-addrs represent valid sc-elements at once.
+ *
+ * This function sorts the specified sc-addrs by sc-segments and checks sc-elements of each sc-segment under one lock
+ * of this sc-segment.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addrs A pointer to array of `count` sc-addrs to be checked.
+ * @param count A count of the specified sc-addrs.
+ * @param results [out] A pointer to array of `count` values to store SC_TRUE for sc-addrs of valid sc-elements and
+ * SC_FALSE for the other ones.
+ *
+ * @note This function is thread-safe.
+ */
+void sc_storage_are_elements(sc_memory_context const * ctx, sc_addr const * addrs, sc_uint32 count, sc_bool * results);
+
 /*!
  * @brief Erases the memory occupied by a sc-element and all connected sc-elements.
  *
@@ -110,6 +126,28 @@ sc_bool sc_storage_is_element(sc_memory_context const * ctx, sc_addr addr);
  */
 sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr);
 
+/*!
+ * @brief Erases several sc-elements and all connected sc-elements at once.
+ *
+ * This function collects all sc-elements to be erased first, then excludes the erased sc-connectors from lists of
+ * sc-connectors that are not erased and releases slots of the erased sc-elements grouped by sc-segments. Lists of
+ * sc-connectors of the erased sc-elements are not updated.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addrs A pointer to array of `count` sc-addrs of sc-elements to be erased.
+ * @param count A count of the specified sc-addrs.
+ *
+ * @return Returns SC_RESULT_OK if the operation executed successfully.
+ *
+ * @note This function is thread-safe.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID Some of the specified sc-addrs are not valid. The other sc-elements are
+ * erased.
+ */
+sc_result sc_storage_elements_erase(sc_memory_context const * ctx, sc_addr const * addrs, sc_uint32 count);
+
 /*!
  * @brief Generates a new sc-node with the specified type.
  *
@@ -196,6 +234,33 @@ sc_addr sc_storage_link_new(sc_memory_context const * ctx, sc_type type);
  */
 sc_addr sc_storage_link_new_ext(sc_memory_context const * ctx, sc_type type, sc_result * result);
 
+/*!
+ * @brief Generates several sc-nodes and sc-links with the specified types at once.
+ *
+ * This function engages as many sc-elements as possible in the current segment under one lock of it, and allocates
+ * the rest ones one by one. If at least one sc-element can't be allocated, then none of them are generated.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param types Types of the new sc-elements. Types with sc-link subtype are used to generate sc-links, the other ones
+ * are used to generate sc-nodes.
+ * @param count A count of the new sc-elements.
+ * @param addrs [out] A pointer to array of `count` sc-addrs to store sc-addrs of the new sc-elements.
+ *
+ * @return Returns the result of the operation.
+ *
+ * @note This function is thread-safe.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ELEMENT_IS_NOT_NODE One of the specified sc-types is a sc-connector type.
+ * @retval SC_RESULT_ERROR_FULL_MEMORY Unable to allocate memory for the new sc-elements.
+ */
+sc_result sc_storage_nodes_and_links_new_ext(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_uint32 count,
+    sc_addr * addrs);
+
 /*!
  * @brief Generates a new sc-connector between two sc-elements with the specified type.
  *
@@ -329,6 +394,26 @@ sc_uint32 sc_storage_get_element_incoming_arcs_count(sc_memory_context const * c
  */
 sc_result sc_storage_get_element_type(sc_memory_context const * ctx, sc_addr addr, sc_type * result);
 
+/*!
+ * @brief Retrieves types of several sc-elements at once.
+ *
+ * This function sorts the specified sc-addrs by sc-segments and reads sc-elements of each sc-segment under one lock
+ * of this sc-segment.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addrs A pointer to array of `count` sc-addrs of sc-elements.
+ * @param count A count of the specified sc-addrs.
+ * @param types [out] A pointer to array of `count` sc-types to store types of the sc-elements. If sc-element with the
+ * specified sc-addr doesn't exist, then its type is set to 0.
+ *
+ * @note This function is thread-safe.
+ */
+void sc_storage_get_elements_types(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_uint32 count,
+    sc_type * types);
+
 /*!
  * @brief Changes the subtype of the specified sc-element.
  *
@@ -440,6 +525,29 @@ sc_result sc_storage_get_arc_info(
     sc_addr * result_begin_addr,
     sc_addr * result_end_addr);
 
+/*!
+ * @brief Retrieves the begin and end sc-addrs of several sc-connectors at once.
+ *
+ * This function sorts the specified sc-addrs by sc-segments and reads sc-connectors of each sc-segment under one lock
+ * of this sc-segment.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addrs A pointer to array of `count` sc-addrs of sc-connectors.
+ * @param count A count of the specified sc-addrs.
+ * @param begin_addrs [out] A pointer to array of `count` sc-addrs to store begin sc-addrs of the sc-connectors.
+ * @param end_addrs [out] A pointer to array of `count` sc-addrs to store end sc-addrs of the sc-connectors.
+ *
+ * @note If sc-element with the specified sc-addr doesn't exist or isn't a sc-connector, then its begin and end sc-addrs
+ * are set to empty sc-addrs.
+ * @note This function is thread-safe.
+ */
+void sc_storage_get_arcs_info(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_uint32 count,
+    sc_addr * begin_addrs,
+    sc_addr * end_addrs);
+
 /*!
  * @brief Sets the content of the specified sc-link.
  *
@@ -606,6 +714,21 @@ sc_result sc_storage_find_links_contents_by_content_substring(
  */
 sc_result sc_storage_get_elements_stat(sc_stat * stat);
 
+/*!
+ * @brief Gets count of sc-elements which sc-types include the specified sc-type.
+ *
+ * Counts of sc-elements are maintained on generation, erasure and change of sc-elements sc-types, so this function
+ * doesn't visit sc-elements.
+ *
+ * @param type A sc-type to count sc-elements with it. For example, count of sc-elements with `sc_type_node` is count of
+ * all sc-nodes, count of sc-elements with zero sc-type is count of all sc-elements.
+ *
+ * @return Returns count of sc-elements.
+ *
+ * @note This function is thread-safe.
+ */
+sc_uint64 sc_storage_get_elements_count_by_type(sc_type type);
+
 /*!
  * @brief Saves the current state of the sc-storage to persistent storage.
  *
@@ -0,0 +1,371 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_storage_arcs_index.h"
+
+#include "sc_storage_private.h"
+
+#include "sc-base/sc_allocator.h"
+#include "sc-base/sc_monitor.h"
+#include "sc-container/sc-hash-table/sc_hash_table.h"
+
+typedef struct
+{
+  sc_addr prev_arc;
+  sc_addr next_arc;
+  sc_uint32 type_idx;  // index of chain of sc-arcs in hub
+  sc_addr end;
+  sc_addr prev_end_arc;
+  sc_addr next_end_arc;
+} sc_storage_arcs_index_link;
+
+typedef struct
+{
+  // sc-types of chains in order of their appearance, chains are never removed, so indices of chains are stable
+  sc_type * types;
+  sc_addr * first_arcs;
+  sc_uint32 types_count;
+  // first sc-arcs of chains of sc-arcs with the same end sc-elements by these sc-elements
+  sc_hash_table * end_arcs;
+  // links of chains by sc-arcs
+  sc_hash_table * links;
+} sc_storage_arcs_index_hub;
+
+//! Count of parts of the table of hubs, hubs from different parts are found and removed independently.
+#define SC_STORAGE_ARCS_INDEX_HUBS_SHARDS_COUNT 64
+
+typedef struct
+{
+  sc_hash_table * hubs;
+  sc_monitor monitor;
+} sc_storage_arcs_index_hubs_shard;
+
+struct _sc_storage_arcs_index
+{
+  sc_storage_arcs_index_hubs_shard shards[SC_STORAGE_ARCS_INDEX_HUBS_SHARDS_COUNT];
+};
+
+#define _sc_storage_arcs_index_key(_addr) GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_addr))
+
+#define _sc_storage_arcs_index_get_shard(_index, _addr) \
+  (&(_index)->shards[SC_ADDR_LOCAL_TO_INT(_addr) % SC_STORAGE_ARCS_INDEX_HUBS_SHARDS_COUNT])
+
+sc_addr _sc_storage_arcs_index_addr(sc_pointer key)
+{
+  sc_addr addr = SC_ADDR_EMPTY;
+  if (key != null_ptr)
+  {
+    SC_ADDR_LOCAL_FROM_INT(GPOINTER_TO_UINT(key), addr);
+  }
+  return addr;
+}
+
+void _sc_storage_arcs_index_hub_free(sc_storage_arcs_index_hub * hub)
+{
+  sc_hash_table_destroy(hub->links);
+  sc_hash_table_destroy(hub->end_arcs);
+  sc_mem_free(hub->first_arcs);
+  sc_mem_free(hub->types);
+  sc_mem_free(hub);
+}
+
+void sc_storage_arcs_index_initialize(sc_storage_arcs_index ** index)
+{
+  *index = sc_mem_new(sc_storage_arcs_index, 1);
+  for (sc_uint32 i = 0; i < SC_STORAGE_ARCS_INDEX_HUBS_SHARDS_COUNT; ++i)
+  {
+    sc_storage_arcs_index_hubs_shard * shard = &(*index)->shards[i];
+    shard->hubs =
+        sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, (GDestroyNotify)_sc_storage_arcs_index_hub_free);
+    sc_monitor_init(&shard->monitor);
+  }
+}
+
+void sc_storage_arcs_index_shutdown(sc_storage_arcs_index * index)
+{
+  if (index == null_ptr)
+    return;
+
+  for (sc_uint32 i = 0; i < SC_STORAGE_ARCS_INDEX_HUBS_SHARDS_COUNT; ++i)
+  {
+    sc_storage_arcs_index_hubs_shard * shard = &index->shards[i];
+    sc_hash_table_destroy(shard->hubs);
+    sc_monitor_destroy(&shard->monitor);
+  }
+  sc_mem_free(index);
+}
+
+// only the table of hubs is locked here, chains of hub are protected by the monitor of its sc-address
+sc_storage_arcs_index_hub * _sc_storage_arcs_index_get_hub(sc_storage_arcs_index * index, sc_addr element_addr)
+{
+  sc_storage_arcs_index_hubs_shard * shard = _sc_storage_arcs_index_get_shard(index, element_addr);
+  sc_monitor_acquire_read(&shard->monitor);
+  sc_storage_arcs_index_hub * hub = sc_hash_table_get(shard->hubs, _sc_storage_arcs_index_key(element_addr));
+  sc_monitor_release_read(&shard->monitor);
+  return hub;
+}
+
+sc_uint32 _sc_storage_arcs_index_hub_get_type_idx(sc_storage_arcs_index_hub * hub, sc_type type)
+{
+  for (sc_uint32 i = 0; i < hub->types_count; ++i)
+  {
+    if (hub->types[i] == type)
+      return i;
+  }
+
+  hub->types = sc_mem_realloc(hub->types, hub->types_count + 1, sizeof(sc_type));
+  hub->first_arcs = sc_mem_realloc(hub->first_arcs, hub->types_count + 1, sizeof(sc_addr));
+  hub->types[hub->types_count] = type;
+  hub->first_arcs[hub->types_count] = SC_ADDR_EMPTY;
+  return hub->types_count++;
+}
+
+#define _sc_storage_arcs_index_hub_get_link(_hub, _arc_addr) \
+  ((sc_storage_arcs_index_link *)sc_hash_table_get((_hub)->links, _sc_storage_arcs_index_key(_arc_addr)))
+
+void _sc_storage_arcs_index_hub_prepend_arc(
+    sc_storage_arcs_index_hub * hub,
+    sc_storage_arcs_index_link * link,
+    sc_addr arc_addr,
+    sc_type arc_type)
+{
+  sc_uint32 const type_idx = _sc_storage_arcs_index_hub_get_type_idx(hub, arc_type);
+
+  link->prev_arc = SC_ADDR_EMPTY;
+  link->next_arc = hub->first_arcs[type_idx];
+  link->type_idx = type_idx;
+
+  if (SC_ADDR_IS_NOT_EMPTY(link->next_arc))
+    _sc_storage_arcs_index_hub_get_link(hub, link->next_arc)->prev_arc = arc_addr;
+
+  hub->first_arcs[type_idx] = arc_addr;
+}
+
+void _sc_storage_arcs_index_hub_remove_arc(sc_storage_arcs_index_hub * hub, sc_storage_arcs_index_link * link)
+{
+  if (SC_ADDR_IS_NOT_EMPTY(link->prev_arc))
+    _sc_storage_arcs_index_hub_get_link(hub, link->prev_arc)->next_arc = link->next_arc;
+  else
+    hub->first_arcs[link->type_idx] = link->next_arc;
+
+  if (SC_ADDR_IS_NOT_EMPTY(link->next_arc))
+    _sc_storage_arcs_index_hub_get_link(hub, link->next_arc)->prev_arc = link->prev_arc;
+}
+
+void _sc_storage_arcs_index_hub_prepend_end_arc(
+    sc_storage_arcs_index_hub * hub,
+    sc_storage_arcs_index_link * link,
+    sc_addr arc_addr)
+{
+  link->prev_end_arc = SC_ADDR_EMPTY;
+  link->next_end_arc =
+      _sc_storage_arcs_index_addr(sc_hash_table_get(hub->end_arcs, _sc_storage_arcs_index_key(link->end)));
+
+  if (SC_ADDR_IS_NOT_EMPTY(link->next_end_arc))
+    _sc_storage_arcs_index_hub_get_link(hub, link->next_end_arc)->prev_end_arc = arc_addr;
+
+  sc_hash_table_insert(hub->end_arcs, _sc_storage_arcs_index_key(link->end), _sc_storage_arcs_index_key(arc_addr));
+}
+
+void _sc_storage_arcs_index_hub_remove_end_arc(sc_storage_arcs_index_hub * hub, sc_storage_arcs_index_link * link)
+{
+  if (SC_ADDR_IS_NOT_EMPTY(link->prev_end_arc))
+    _sc_storage_arcs_index_hub_get_link(hub, link->prev_end_arc)->next_end_arc = link->next_end_arc;
+  else if (SC_ADDR_IS_NOT_EMPTY(link->next_end_arc))
+    sc_hash_table_insert(
+        hub->end_arcs, _sc_storage_arcs_index_key(link->end), _sc_storage_arcs_index_key(link->next_end_arc));
+  else
+    sc_hash_table_remove(hub->end_arcs, _sc_storage_arcs_index_key(link->end));
+
+  if (SC_ADDR_IS_NOT_EMPTY(link->next_end_arc))
+    _sc_storage_arcs_index_hub_get_link(hub, link->next_end_arc)->prev_end_arc = link->prev_end_arc;
+}
+
+void sc_storage_arcs_index_build(sc_storage_arcs_index * index, sc_addr element_addr, sc_element * element)
+{
+  sc_storage_arcs_index_hub * hub = sc_mem_new(sc_storage_arcs_index_hub, 1);
+  hub->end_arcs = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  hub->links = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, g_free);
+
+  // sc-arcs are appended to chains, so chains keep order of the list of outgoing sc-connectors
+  sc_addr * last_arcs = null_ptr;
+  sc_uint32 last_arcs_count = 0;
+  sc_hash_table * last_end_arcs = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+
+  sc_addr arc_addr = element->first_out_arc;
+  while (SC_ADDR_IS_NOT_EMPTY(arc_addr))
+  {
+    sc_element * arc;
+    if (sc_storage_get_element_by_addr(arc_addr, &arc) != SC_RESULT_OK)
+      break;
+
+    sc_bool const is_edge = sc_type_has_subtype(arc->flags.type, sc_type_edge_common);
+    sc_addr const next_arc_addr = is_edge && SC_ADDR_IS_EQUAL(element_addr, arc->arc.end)
+                                      ? arc->arc.next_end_out_arc
+                                      : arc->arc.next_begin_out_arc;
+
+    if (is_edge == SC_FALSE)
+    {
+      sc_uint32 const type_idx = _sc_storage_arcs_index_hub_get_type_idx(hub, arc->flags.type);
+      if (type_idx == last_arcs_count)
+      {
+        last_arcs = sc_mem_realloc(last_arcs, last_arcs_count + 1, sizeof(sc_addr));
+        last_arcs[last_arcs_count++] = SC_ADDR_EMPTY;
+      }
+
+      sc_storage_arcs_index_link * link = sc_mem_new(sc_storage_arcs_index_link, 1);
+      link->prev_arc = last_arcs[type_idx];
+      link->next_arc = SC_ADDR_EMPTY;
+      link->type_idx = type_idx;
+
+      if (SC_ADDR_IS_EMPTY(link->prev_arc))
+        hub->first_arcs[type_idx] = arc_addr;
+      else
+        _sc_storage_arcs_index_hub_get_link(hub, link->prev_arc)->next_arc = arc_addr;
+
+      last_arcs[type_idx] = arc_addr;
+
+      link->end = arc->arc.end;
+      link->prev_end_arc =
+          _sc_storage_arcs_index_addr(sc_hash_table_get(last_end_arcs, _sc_storage_arcs_index_key(link->end)));
+      link->next_end_arc = SC_ADDR_EMPTY;
+
+      if (SC_ADDR_IS_EMPTY(link->prev_end_arc))
+        sc_hash_table_insert(
+            hub->end_arcs, _sc_storage_arcs_index_key(link->end), _sc_storage_arcs_index_key(arc_addr));
+      else
+        _sc_storage_arcs_index_hub_get_link(hub, link->prev_end_arc)->next_end_arc = arc_addr;
+
+      sc_hash_table_insert(last_end_arcs, _sc_storage_arcs_index_key(link->end), _sc_storage_arcs_index_key(arc_addr));
+      sc_hash_table_insert(hub->links, _sc_storage_arcs_index_key(arc_addr), link);
+    }
+
+    arc_addr = next_arc_addr;
+  }
+
+  sc_storage_arcs_index_hubs_shard * shard = _sc_storage_arcs_index_get_shard(index, element_addr);
+  sc_monitor_acquire_write(&shard->monitor);
+  sc_hash_table_insert(shard->hubs, _sc_storage_arcs_index_key(element_addr), hub);
+  sc_monitor_release_write(&shard->monitor);
+  element->flags.states |= SC_STATE_ARCS_INDEXED;
+
+  sc_hash_table_destroy(last_end_arcs);
+  sc_mem_free(last_arcs);
+}
+
+void sc_storage_arcs_index_remove_element(sc_storage_arcs_index * index, sc_addr element_addr)
+{
+  sc_storage_arcs_index_hubs_shard * shard = _sc_storage_arcs_index_get_shard(index, element_addr);
+  sc_monitor_acquire_write(&shard->monitor);
+  sc_hash_table_remove(shard->hubs, _sc_storage_arcs_index_key(element_addr));
+  sc_monitor_release_write(&shard->monitor);
+}
+
+void sc_storage_arcs_index_add_arc(
+    sc_storage_arcs_index * index,
+    sc_addr element_addr,
+    sc_addr arc_addr,
+    sc_type arc_type,
+    sc_addr arc_end_addr)
+{
+  sc_storage_arcs_index_hub * hub = _sc_storage_arcs_index_get_hub(index, element_addr);
+  if (hub == null_ptr)
+    return;
+
+  sc_storage_arcs_index_link * link = sc_mem_new(sc_storage_arcs_index_link, 1);
+  _sc_storage_arcs_index_hub_prepend_arc(hub, link, arc_addr, arc_type);
+  link->end = arc_end_addr;
+  _sc_storage_arcs_index_hub_prepend_end_arc(hub, link, arc_addr);
+  sc_hash_table_insert(hub->links, _sc_storage_arcs_index_key(arc_addr), link);
+}
+
+void sc_storage_arcs_index_remove_arc(sc_storage_arcs_index * index, sc_addr element_addr, sc_addr arc_addr)
+{
+  sc_storage_arcs_index_hub * hub = _sc_storage_arcs_index_get_hub(index, element_addr);
+  if (hub == null_ptr)
+    return;
+
+  sc_storage_arcs_index_link * link = _sc_storage_arcs_index_hub_get_link(hub, arc_addr);
+  if (link == null_ptr)
+    return;
+
+  _sc_storage_arcs_index_hub_remove_arc(hub, link);
+  _sc_storage_arcs_index_hub_remove_end_arc(hub, link);
+  sc_hash_table_remove(hub->links, _sc_storage_arcs_index_key(arc_addr));
+}
+
+void sc_storage_arcs_index_change_arc_type(
+    sc_storage_arcs_index * index,
+    sc_addr element_addr,
+    sc_addr arc_addr,
+    sc_type arc_type)
+{
+  sc_storage_arcs_index_hub * hub = _sc_storage_arcs_index_get_hub(index, element_addr);
+  if (hub == null_ptr)
+    return;
+
+  sc_storage_arcs_index_link * link = _sc_storage_arcs_index_hub_get_link(hub, arc_addr);
+  if (link == null_ptr || hub->types[link->type_idx] == arc_type)
+    return;
+
+  _sc_storage_arcs_index_hub_remove_arc(hub, link);
+  _sc_storage_arcs_index_hub_prepend_arc(hub, link, arc_addr, arc_type);
+}
+
+sc_addr sc_storage_arcs_index_get_next_arc(
+    sc_storage_arcs_index * index,
+    sc_addr element_addr,
+    sc_addr arc_addr,
+    sc_type arc_type)
+{
+  sc_addr next_arc_addr = SC_ADDR_EMPTY;
+
+  sc_storage_arcs_index_hub * hub = _sc_storage_arcs_index_get_hub(index, element_addr);
+  if (hub == null_ptr)
+    return next_arc_addr;
+
+  sc_uint32 type_idx = 0;
+  sc_storage_arcs_index_link * link =
+      SC_ADDR_IS_EMPTY(arc_addr) ? null_ptr : _sc_storage_arcs_index_hub_get_link(hub, arc_addr);
+  if (link != null_ptr)
+  {
+    if (sc_type_has_subtype(hub->types[link->type_idx], arc_type))
+      next_arc_addr = link->next_arc;
+    type_idx = link->type_idx + 1;
+  }
+
+  // chains of sc-arcs with other suitable sc-types are visited after the current one
+  while (SC_ADDR_IS_EMPTY(next_arc_addr) && type_idx < hub->types_count)
+  {
+    if (sc_type_has_subtype(hub->types[type_idx], arc_type))
+      next_arc_addr = hub->first_arcs[type_idx];
+    ++type_idx;
+  }
+
+  return next_arc_addr;
+}
+
+sc_addr sc_storage_arcs_index_get_next_arc_to_element(
+    sc_storage_arcs_index * index,
+    sc_addr element_addr,
+    sc_addr arc_end_addr,
+    sc_addr arc_addr)
+{
+  sc_storage_arcs_index_hub * hub = _sc_storage_arcs_index_get_hub(index, element_addr);
+  if (hub == null_ptr)
+    return SC_ADDR_EMPTY;
+
+  sc_addr next_arc_addr;
+  sc_storage_arcs_index_link * link =
+      SC_ADDR_IS_EMPTY(arc_addr) ? null_ptr : _sc_storage_arcs_index_hub_get_link(hub, arc_addr);
+  if (link != null_ptr)
+    next_arc_addr = link->next_end_arc;
+  else
+    next_arc_addr =
+        _sc_storage_arcs_index_addr(sc_hash_table_get(hub->end_arcs, _sc_storage_arcs_index_key(arc_end_addr)));
+
+  return next_arc_addr;
+}
@@ -0,0 +1,107 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_storage_arcs_index_h_
+#define _sc_storage_arcs_index_h_
+
+#include "sc_types.h"
+#include "sc_element.h"
+
+//! Count of outgoing sc-arcs of sc-element after which its outgoing sc-arcs are indexed by their sc-types.
+#define SC_STORAGE_ARCS_INDEX_MIN_ARCS_COUNT 1024
+
+/*! Secondary index of outgoing sc-arcs of sc-elements with a lot of outgoing sc-arcs (hubs). Outgoing sc-arcs of each
+ * hub are split into chains by their sc-types, so search of outgoing sc-arcs with specified sc-type visits only
+ * sc-arcs which sc-types include this sc-type, instead of all outgoing sc-connectors of the hub. Outgoing sc-arcs of
+ * each hub are also chained by their end sc-elements, so sc-arcs between the hub and the specified sc-element are
+ * found without visiting other sc-connectors of both of them. Sc-edges are not indexed, they are visited by lists of
+ * sc-connectors of sc-elements.
+ * @note Indexed hubs have state SC_STATE_ARCS_INDEXED. The index of hub isn't locked by itself: callers must acquire
+ * the monitor of sc-address of hub for writing to build the index and to add, remove or move sc-arcs in it, and for
+ * reading to find sc-arcs in it. So readers see the index consistent with the list of outgoing sc-connectors of the
+ * hub, and operations with different hubs don't wait for each other.
+ */
+typedef struct _sc_storage_arcs_index sc_storage_arcs_index;
+
+void sc_storage_arcs_index_initialize(sc_storage_arcs_index ** index);
+
+void sc_storage_arcs_index_shutdown(sc_storage_arcs_index * index);
+
+/*! Indexes all outgoing sc-arcs of the specified sc-element and marks it as indexed.
+ * @param index A pointer to sc-storage arcs index.
+ * @param element_addr A sc-address of sc-element.
+ * @param element A pointer to sc-element.
+ */
+void sc_storage_arcs_index_build(sc_storage_arcs_index * index, sc_addr element_addr, sc_element * element);
+
+/*! Removes index of outgoing sc-arcs of the specified sc-element, it is called when the sc-element is erased.
+ * @param index A pointer to sc-storage arcs index.
+ * @param element_addr A sc-address of sc-element.
+ */
+void sc_storage_arcs_index_remove_element(sc_storage_arcs_index * index, sc_addr element_addr);
+
+/*! Adds generated outgoing sc-arc of indexed sc-element to the index.
+ * @param index A pointer to sc-storage arcs index.
+ * @param element_addr A sc-address of begin sc-element of sc-arc.
+ * @param arc_addr A sc-address of sc-arc.
+ * @param arc_type A sc-type of sc-arc.
+ * @param arc_end_addr A sc-address of end sc-element of sc-arc.
+ */
+void sc_storage_arcs_index_add_arc(
+    sc_storage_arcs_index * index,
+    sc_addr element_addr,
+    sc_addr arc_addr,
+    sc_type arc_type,
+    sc_addr arc_end_addr);
+
+/*! Removes erased outgoing sc-arc of indexed sc-element from the index.
+ * @param index A pointer to sc-storage arcs index.
+ * @param element_addr A sc-address of begin sc-element of sc-arc.
+ * @param arc_addr A sc-address of sc-arc.
+ */
+void sc_storage_arcs_index_remove_arc(sc_storage_arcs_index * index, sc_addr element_addr, sc_addr arc_addr);
+
+/*! Moves outgoing sc-arc of sc-element to chain of its new sc-type if the sc-element is indexed.
+ * @param index A pointer to sc-storage arcs index.
+ * @param element_addr A sc-address of begin sc-element of sc-arc.
+ * @param arc_addr A sc-address of sc-arc.
+ * @param arc_type A new sc-type of sc-arc.
+ */
+void sc_storage_arcs_index_change_arc_type(
+    sc_storage_arcs_index * index,
+    sc_addr element_addr,
+    sc_addr arc_addr,
+    sc_type arc_type);
+
+/*! Gets next outgoing sc-arc of indexed sc-element which sc-type includes the specified sc-type.
+ * @param index A pointer to sc-storage arcs index.
+ * @param element_addr A sc-address of begin sc-element of sc-arcs.
+ * @param arc_addr A sc-address of previous found sc-arc. If it is empty or isn't indexed, then the first sc-arc is
+ * found.
+ * @param arc_type A sc-type of sc-arcs to find.
+ * @returns Returns sc-address of found sc-arc or empty sc-address if there are no more sc-arcs.
+ */
+sc_addr sc_storage_arcs_index_get_next_arc(
+    sc_storage_arcs_index * index,
+    sc_addr element_addr,
+    sc_addr arc_addr,
+    sc_type arc_type);
+
+/*! Gets next outgoing sc-arc of indexed sc-element which end is the specified sc-element.
+ * @param index A pointer to sc-storage arcs index.
+ * @param element_addr A sc-address of begin sc-element of sc-arcs.
+ * @param arc_end_addr A sc-address of end sc-element of sc-arcs.
+ * @param arc_addr A sc-address of previous found sc-arc. If it is empty or isn't indexed, then the first sc-arc is
+ * found.
+ * @returns Returns sc-address of found sc-arc or empty sc-address if there are no more sc-arcs.
+ */
+sc_addr sc_storage_arcs_index_get_next_arc_to_element(
+    sc_storage_arcs_index * index,
+    sc_addr element_addr,
+    sc_addr arc_end_addr,
+    sc_addr arc_addr);
+
+#endif  // _sc_storage_arcs_index_h_
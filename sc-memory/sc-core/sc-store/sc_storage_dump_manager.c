@@ -12,6 +12,7 @@
 #include "../sc_memory_private.h"
 
 #include "sc-base/sc_allocator.h"
+#include "sc-base/sc_metrics.h"
 
 typedef void (*sc_timed_callback)();
 typedef pthread_t sc_timer;
@@ -82,6 +83,22 @@ void _sc_storage_dump_statistics_timer()
       statistics.arc_count,
       (sc_float)statistics.arc_count / (sc_float)allElements * 100);
   sc_message("Total: %" PRIu64, allElements);
+
+  if (SC_METRICS_ENABLED == SC_FALSE)
+    return;
+
+  sc_metrics_stat metrics;
+  sc_metrics_get_stat(&metrics);
+  for (sc_uint32 metric = 0; metric < SC_METRICS_COUNT; ++metric)
+  {
+    sc_metric_stat const * metric_stat = &metrics.metrics[metric];
+    sc_message(
+        "%s: %" PRIu64 " operations, %" PRIu64 " us total, %f us average",
+        sc_metrics_get_name(metric),
+        metric_stat->count,
+        metric_stat->total_time,
+        metric_stat->count == 0 ? 0.0 : (sc_float)metric_stat->total_time / (sc_float)metric_stat->count);
+  }
 }
 
 void sc_storage_dump_manager_initialize(sc_storage_dump_manager ** manager, sc_memory_params const * params)
@@ -10,6 +10,8 @@
 #include "sc-base/sc_monitor_table.h"
 
 #include "sc_storage_dump_manager.h"
+#include "sc_storage_stat_manager.h"
+#include "sc_storage_arcs_index.h"
 #include "sc-event/sc_event_private.h"
 
 struct _sc_storage
@@ -24,8 +26,11 @@ struct _sc_storage
   sc_hash_table * processes_segments_table;
   sc_monitor processes_monitor;
   sc_storage_dump_manager * dump_manager;
+  sc_storage_stat_manager * stat_manager;
+  sc_storage_arcs_index * arcs_index;
   sc_event_emission_manager * events_emission_manager;
   sc_event_subscription_manager * events_subscription_manager;
+  sc_uint32 local_permissions_epoch;  ///< Version of local permissions, it is increased when they may be changed.
 };
 
 struct _sc_storage * sc_storage_get();
@@ -34,6 +39,17 @@ sc_event_emission_manager * sc_storage_get_event_emission_manager();
 
 sc_event_subscription_manager * sc_storage_get_event_subscription_manager();
 
+/*! Gets current version of local permissions of sc-memory contexts.
+ * @returns Returns version that is changed each time when local permissions or sc-structures with them may be changed.
+ * @note Results of local permissions checks are cached by sc-memory contexts until this version is changed.
+ */
+sc_uint32 sc_storage_get_local_permissions_epoch();
+
+/*! Invalidates all cached results of local permissions checks. It is called when permissions of users within
+ * sc-structures are changed or when sc-elements are added to or removed from permitted sc-structures.
+ */
+void sc_storage_invalidate_local_permissions();
+
 sc_element * sc_storage_allocate_new_element(sc_memory_context const * ctx, sc_addr * addr);
 
 void sc_storage_start_new_process();
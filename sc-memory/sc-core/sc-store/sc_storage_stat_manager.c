@@ -0,0 +1,175 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_storage_stat_manager.h"
+
+#include "sc-base/sc_allocator.h"
+#include "sc-base/sc_atomic.h"
+#include "sc-base/sc_monitor.h"
+#include "sc-base/sc_thread.h"
+
+#define SC_STORAGE_STAT_SHARDS_COUNT 8
+#define SC_STORAGE_STAT_TYPES_COUNT (1 << (sizeof(sc_type) * 8))
+#define SC_STORAGE_STAT_CACHE_LINE_SIZE 64
+
+// counters are pointer-sized to be updated by atomic operations, they can be negative in shards if sc-elements are
+// generated and erased by different threads
+typedef gssize sc_storage_stat_counter;
+
+#define _sc_storage_stat_counter_add(counter, value) sc_atomic_pointer_add(counter, value)
+#define _sc_storage_stat_counter_get(counter) ((sc_storage_stat_counter)sc_atomic_pointer_get(counter))
+
+typedef struct
+{
+  sc_storage_stat_counter node_count;
+  sc_storage_stat_counter link_count;
+  sc_storage_stat_counter arc_count;
+  // shards are placed in different cache lines
+  sc_char padding[SC_STORAGE_STAT_CACHE_LINE_SIZE - 3 * sizeof(sc_storage_stat_counter)];
+} sc_storage_stat_shard;
+
+struct _sc_storage_stat_manager
+{
+  sc_storage_stat_shard shards[SC_STORAGE_STAT_SHARDS_COUNT];
+  // counters of sc-types are split into shards too, shard counters are placed one after another
+  sc_storage_stat_counter * types_counts;
+  // sc-types which sc-elements have ever been counted, they are used to count sc-elements by sc-type without visiting
+  // all possible sc-types
+  sc_int32 * is_type_used;
+  sc_type * used_types;
+  sc_uint32 used_types_count;
+  sc_monitor used_types_monitor;
+};
+
+void sc_storage_stat_manager_initialize(sc_storage_stat_manager ** manager)
+{
+  *manager = sc_mem_new(sc_storage_stat_manager, 1);
+  (*manager)->types_counts =
+      sc_mem_new(sc_storage_stat_counter, SC_STORAGE_STAT_SHARDS_COUNT * SC_STORAGE_STAT_TYPES_COUNT);
+  (*manager)->is_type_used = sc_mem_new(sc_int32, SC_STORAGE_STAT_TYPES_COUNT);
+  (*manager)->used_types = sc_mem_new(sc_type, SC_STORAGE_STAT_TYPES_COUNT);
+  (*manager)->used_types_count = 0;
+  sc_monitor_init(&(*manager)->used_types_monitor);
+}
+
+void sc_storage_stat_manager_shutdown(sc_storage_stat_manager * manager)
+{
+  if (manager == null_ptr)
+    return;
+
+  sc_monitor_destroy(&manager->used_types_monitor);
+  sc_mem_free(manager->used_types);
+  sc_mem_free(manager->is_type_used);
+  sc_mem_free(manager->types_counts);
+  sc_mem_free(manager);
+}
+
+sc_uint32 _sc_storage_stat_manager_get_shard_idx()
+{
+  // threads are allocated in heap, so the lowest bits of their pointers are the same
+  return (GPOINTER_TO_UINT(sc_thread_self()) >> 6) % SC_STORAGE_STAT_SHARDS_COUNT;
+}
+
+void _sc_storage_stat_manager_use_type(sc_storage_stat_manager * manager, sc_type type)
+{
+  if (sc_atomic_int_get(&manager->is_type_used[type]) == SC_TRUE)
+    return;
+
+  sc_monitor_acquire_write(&manager->used_types_monitor);
+  if (sc_atomic_int_get(&manager->is_type_used[type]) == SC_FALSE)
+  {
+    manager->used_types[manager->used_types_count++] = type;
+    sc_atomic_int_set(&manager->is_type_used[type], SC_TRUE);
+  }
+  sc_monitor_release_write(&manager->used_types_monitor);
+}
+
+void _sc_storage_stat_manager_add(
+    sc_storage_stat_manager * manager,
+    sc_uint32 shard_idx,
+    sc_type type,
+    sc_storage_stat_counter value)
+{
+  sc_storage_stat_shard * shard = &manager->shards[shard_idx];
+  if (sc_type_has_subtype(type, sc_type_node))
+    _sc_storage_stat_counter_add(&shard->node_count, value);
+  else if (sc_type_has_subtype(type, sc_type_link))
+    _sc_storage_stat_counter_add(&shard->link_count, value);
+  else if (sc_type_has_subtype_in_mask(type, sc_type_arc_mask))
+    _sc_storage_stat_counter_add(&shard->arc_count, value);
+
+  _sc_storage_stat_counter_add(&manager->types_counts[shard_idx * SC_STORAGE_STAT_TYPES_COUNT + type], value);
+}
+
+void sc_storage_stat_manager_add_element(sc_storage_stat_manager * manager, sc_type type)
+{
+  _sc_storage_stat_manager_use_type(manager, type);
+  _sc_storage_stat_manager_add(manager, _sc_storage_stat_manager_get_shard_idx(), type, 1);
+}
+
+void sc_storage_stat_manager_remove_element(sc_storage_stat_manager * manager, sc_type type)
+{
+  _sc_storage_stat_manager_add(manager, _sc_storage_stat_manager_get_shard_idx(), type, -1);
+}
+
+void sc_storage_stat_manager_change_element_type(
+    sc_storage_stat_manager * manager,
+    sc_type old_type,
+    sc_type new_type)
+{
+  if (old_type == new_type)
+    return;
+
+  _sc_storage_stat_manager_use_type(manager, new_type);
+
+  sc_uint32 const shard_idx = _sc_storage_stat_manager_get_shard_idx();
+  _sc_storage_stat_counter_add(&manager->types_counts[shard_idx * SC_STORAGE_STAT_TYPES_COUNT + old_type], -1);
+  _sc_storage_stat_counter_add(&manager->types_counts[shard_idx * SC_STORAGE_STAT_TYPES_COUNT + new_type], 1);
+}
+
+sc_uint64 _sc_storage_stat_counter_to_count(sc_storage_stat_counter count)
+{
+  // sum of shards can be negative for a moment if sc-element is erased and counted before it is generated and counted
+  return count < 0 ? 0 : (sc_uint64)count;
+}
+
+void sc_storage_stat_manager_get_stat(sc_storage_stat_manager * manager, sc_stat * stat)
+{
+  sc_storage_stat_counter node_count = 0;
+  sc_storage_stat_counter link_count = 0;
+  sc_storage_stat_counter arc_count = 0;
+  for (sc_uint32 i = 0; i < SC_STORAGE_STAT_SHARDS_COUNT; ++i)
+  {
+    sc_storage_stat_shard * shard = &manager->shards[i];
+    node_count += _sc_storage_stat_counter_get(&shard->node_count);
+    link_count += _sc_storage_stat_counter_get(&shard->link_count);
+    arc_count += _sc_storage_stat_counter_get(&shard->arc_count);
+  }
+
+  stat->node_count = _sc_storage_stat_counter_to_count(node_count);
+  stat->link_count = _sc_storage_stat_counter_to_count(link_count);
+  stat->arc_count = _sc_storage_stat_counter_to_count(arc_count);
+}
+
+sc_uint64 sc_storage_stat_manager_get_elements_count_by_type(sc_storage_stat_manager * manager, sc_type type)
+{
+  sc_storage_stat_counter count = 0;
+
+  sc_monitor_acquire_read(&manager->used_types_monitor);
+  for (sc_uint32 i = 0; i < manager->used_types_count; ++i)
+  {
+    sc_type const used_type = manager->used_types[i];
+    if (sc_type_has_subtype(used_type, type) == SC_FALSE)
+      continue;
+
+    sc_storage_stat_counter * type_counts = &manager->types_counts[used_type];
+    for (sc_uint32 shard_idx = 0; shard_idx < SC_STORAGE_STAT_SHARDS_COUNT; ++shard_idx)
+      count += _sc_storage_stat_counter_get(&type_counts[shard_idx * SC_STORAGE_STAT_TYPES_COUNT]);
+  }
+  sc_monitor_release_read(&manager->used_types_monitor);
+
+  return _sc_storage_stat_counter_to_count(count);
+}
@@ -0,0 +1,58 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_storage_stat_manager_h_
+#define _sc_storage_stat_manager_h_
+
+#include "sc_types.h"
+
+/*! Counters of sc-elements by their kinds and sc-types. Counters are split into shards chosen by calling thread, so
+ * threads generating and erasing sc-elements don't contend for the same counters. Counts are summed over shards on
+ * read, so statistics doesn't depend on count of sc-elements in sc-memory.
+ */
+typedef struct _sc_storage_stat_manager sc_storage_stat_manager;
+
+void sc_storage_stat_manager_initialize(sc_storage_stat_manager ** manager);
+
+void sc_storage_stat_manager_shutdown(sc_storage_stat_manager * manager);
+
+/*! Counts the sc-element of the specified sc-type as generated.
+ * @param manager A pointer to sc-storage statistics manager.
+ * @param type A sc-type of generated sc-element.
+ */
+void sc_storage_stat_manager_add_element(sc_storage_stat_manager * manager, sc_type type);
+
+/*! Counts the sc-element of the specified sc-type as erased.
+ * @param manager A pointer to sc-storage statistics manager.
+ * @param type A sc-type of erased sc-element.
+ */
+void sc_storage_stat_manager_remove_element(sc_storage_stat_manager * manager, sc_type type);
+
+/*! Moves the sc-element from counter of its old sc-type to counter of its new sc-type.
+ * @param manager A pointer to sc-storage statistics manager.
+ * @param old_type A sc-type of sc-element before change.
+ * @param new_type A sc-type of sc-element after change.
+ */
+void sc_storage_stat_manager_change_element_type(
+    sc_storage_stat_manager * manager,
+    sc_type old_type,
+    sc_type new_type);
+
+/*! Gets counts of sc-nodes, sc-links and sc-connectors.
+ * @param manager A pointer to sc-storage statistics manager.
+ * @param stat A pointer to structure to store counts.
+ */
+void sc_storage_stat_manager_get_stat(sc_storage_stat_manager * manager, sc_stat * stat);
+
+/*! Gets count of sc-elements which sc-types include the specified sc-type.
+ * @param manager A pointer to sc-storage statistics manager.
+ * @param type A sc-type to count sc-elements with it.
+ * @returns Returns count of sc-elements, for example, count of sc-elements with sc-type `sc_type_node` is count of all
+ * sc-nodes.
+ */
+sc_uint64 sc_storage_stat_manager_get_elements_count_by_type(sc_storage_stat_manager * manager, sc_type type);
+
+#endif  // _sc_storage_stat_manager_h_
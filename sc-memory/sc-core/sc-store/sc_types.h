@@ -170,10 +170,10 @@ typedef sc_uint16 sc_type;
         | sc_type_node_abstract | sc_type_node_material)
 #  define sc_type_arc_mask (sc_type)(sc_type_arc_access | sc_type_arc_common | sc_type_edge_common)
 
-#  define sc_type_has_subtype(_type, _subtype) ((_type & _subtype) == _subtype)
-#  define sc_type_has_not_subtype(_type, _subtype) !sc_type_has_subtype(_type, _subtype)
-#  define sc_type_has_subtype_in_mask(_type, _mask) ((_type & _mask) != 0)
-#  define sc_type_has_not_subtype_in_mask(_type, _mask) !sc_type_has_subtype_in_mask(_type, _mask)
+#  define sc_type_has_subtype(_type, _subtype) (((_type) & (_subtype)) == (_subtype))
+#  define sc_type_has_not_subtype(_type, _subtype) (!sc_type_has_subtype(_type, _subtype))
+#  define sc_type_has_subtype_in_mask(_type, _mask) (((_type) & (_mask)) != 0)
+#  define sc_type_has_not_subtype_in_mask(_type, _mask) (!sc_type_has_subtype_in_mask(_type, _mask))
 
 #  define sc_type_is_structure_and_arc(_node_type, _arc_type) \
     (sc_type_has_subtype(_node_type, sc_type_node_struct) \
@@ -184,6 +184,7 @@ typedef sc_uint16 sc_states;
 #  define SC_STATE_REQUEST_DELETION 0x1
 #  define SC_STATE_IS_DELETABLE 0x200
 #  define SC_STATE_ELEMENT_EXIST 0x2
+#  define SC_STATE_ARCS_INDEXED 0x400
 
 #  define SC_ACCESS_LVL_MAX_VALUE 15
 #  define SC_ACCESS_LVL_MIN_VALUE 0
@@ -235,6 +236,18 @@ struct _sc_stat
   sc_uint64 link_count;  // amount of all sc-links stored in memory
 };
 
+// structure to store statistics of sc-events processing
+struct _sc_events_stat
+{
+  sc_uint32 queue_size;                // amount of sc-events waiting for processing or being processed
+  sc_uint32 max_queue_size;            // maximum amount of waiting sc-events, it is 0 if the queue is unbounded
+  sc_uint64 processed_events_count;    // amount of processed sc-events
+  sc_uint64 dropped_events_count;      // amount of sc-events dropped because the queue was full
+  sc_uint64 blocked_emissions_count;   // amount of times emitters waited because the queue was full
+  sc_uint64 events_wait_time;          // total time (in microseconds) sc-events waited in the queue
+  sc_uint64 events_run_time;           // total time (in microseconds) of sc-events processing
+};
+
 #endif
 
 typedef struct _sc_arc sc_arc;
@@ -253,3 +266,4 @@ typedef struct _sc_iterator5 sc_iterator5;
 typedef struct _sc_event_subscription sc_event_subscription;
 typedef enum _sc_result sc_result;
 typedef struct _sc_stat sc_stat;
+typedef struct _sc_events_stat sc_events_stat;
@@ -12,13 +12,198 @@
 
 #include "sc-store/sc-base/sc_allocator.h"
 #include "sc-store/sc-base/sc_message.h"
+#include "sc-store/sc-base/sc_monitor.h"
 
 #include "sc_memory_private.h"
+#include "sc_helper_private.h"
+#include "sc_memory_context_manager.h"
+#include "sc_memory_context_private.h"
+#include "sc_memory_context_permissions.h"
+#include "sc-store/sc_element.h"
 #include "sc-store/sc-container/sc-string/sc_string.h"
 
 sc_char ** keynodes_str = null_ptr;
 sc_addr * sc_keynodes = null_ptr;
 
+// system identifier -> sc_system_identifier_fiver of sc-element with this system identifier
+static sc_hash_table * system_identifiers_fivers = null_ptr;
+// sc-addr hash of sc-link or sc-arc of indexed fiver -> system identifier
+static sc_hash_table * system_identifiers_by_addrs = null_ptr;
+static sc_monitor system_identifiers_monitor;
+
+static void _sc_helper_system_identifiers_index_initialize()
+{
+  system_identifiers_fivers = sc_hash_table_init(g_str_hash, g_str_equal, g_free, g_free);
+  system_identifiers_by_addrs = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  sc_monitor_init(&system_identifiers_monitor);
+}
+
+static void _sc_helper_system_identifiers_index_shutdown()
+{
+  if (system_identifiers_fivers == null_ptr)
+    return;
+
+  sc_hash_table_destroy(system_identifiers_by_addrs);
+  system_identifiers_by_addrs = null_ptr;
+  sc_hash_table_destroy(system_identifiers_fivers);
+  system_identifiers_fivers = null_ptr;
+  sc_monitor_destroy(&system_identifiers_monitor);
+}
+
+//! Removes system identifier from index. It must be called under write lock of index.
+static void _sc_helper_system_identifiers_index_remove_locked(sc_char const * idtf)
+{
+  sc_system_identifier_fiver const * fiver = sc_hash_table_get(system_identifiers_fivers, idtf);
+  if (fiver == null_ptr)
+    return;
+
+  sc_hash_table_remove(system_identifiers_by_addrs, GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(fiver->addr2)));
+  sc_hash_table_remove(system_identifiers_by_addrs, GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(fiver->addr3)));
+  sc_hash_table_remove(system_identifiers_fivers, idtf);
+}
+
+static void _sc_helper_system_identifiers_index_insert(
+    sc_char const * data,
+    sc_uint32 len,
+    sc_system_identifier_fiver const * fiver)
+{
+  sc_char * idtf;
+  sc_str_cpy(idtf, data, len);
+  sc_system_identifier_fiver * indexed_fiver = sc_mem_new(sc_system_identifier_fiver, 1);
+  *indexed_fiver = *fiver;
+
+  sc_monitor_acquire_write(&system_identifiers_monitor);
+  _sc_helper_system_identifiers_index_remove_locked(idtf);
+  sc_hash_table_insert(system_identifiers_fivers, idtf, indexed_fiver);
+  // keys of fivers table live until their entries are removed together with these ones
+  sc_hash_table_insert(system_identifiers_by_addrs, GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(fiver->addr2)), idtf);
+  sc_hash_table_insert(system_identifiers_by_addrs, GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(fiver->addr3)), idtf);
+  sc_monitor_release_write(&system_identifiers_monitor);
+}
+
+void sc_helper_invalidate_system_identifier(sc_addr addr, sc_element const * element)
+{
+  if (system_identifiers_fivers == null_ptr)
+    return;
+
+  // fivers are indexed by their sc-links and sc-arcs with system identifiers, sc-arcs from nrel_system_identifier
+  // are resolved to the last ones
+  sc_type const type = element->flags.type;
+  sc_addr indexed_addr;
+  if (sc_type_has_subtype(type, sc_type_link) || sc_type_has_subtype(type, sc_type_arc_common))
+    indexed_addr = addr;
+  else if (
+      sc_type_has_subtype(type, sc_type_arc_access)
+      && SC_ADDR_IS_EQUAL(element->arc.begin, sc_keynodes[SC_KEYNODE_NREL_SYSTEM_IDENTIFIER]))
+    indexed_addr = element->arc.end;
+  else
+    return;
+
+  sc_pointer const key = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(indexed_addr));
+
+  sc_monitor_acquire_read(&system_identifiers_monitor);
+  sc_bool const is_indexed = sc_hash_table_get(system_identifiers_by_addrs, key) != null_ptr;
+  sc_monitor_release_read(&system_identifiers_monitor);
+  if (is_indexed == SC_FALSE)
+    return;
+
+  sc_monitor_acquire_write(&system_identifiers_monitor);
+  sc_char const * idtf = sc_hash_table_get(system_identifiers_by_addrs, key);
+  if (idtf != null_ptr)
+    _sc_helper_system_identifiers_index_remove_locked(idtf);
+  sc_monitor_release_write(&system_identifiers_monitor);
+}
+
+//! Checks if sc-memory context can find sc-link of fiver and read all its sc-elements, as search by sc-links does.
+static sc_bool _sc_helper_can_read_system_identifier_fiver(
+    sc_memory_context const * ctx,
+    sc_system_identifier_fiver const * fiver)
+{
+  sc_memory_context_manager * manager = sc_memory_get_context_manager();
+  if (_sc_memory_context_is_authenticated(manager, ctx) == SC_FALSE)
+    return SC_FALSE;
+
+  sc_addr const addrs[] = {fiver->addr1, fiver->addr2, fiver->addr3, fiver->addr4, fiver->addr5};
+  for (sc_uint32 i = 0; i < 5; ++i)
+  {
+    if (_sc_memory_context_check_local_and_global_permissions(manager, ctx, SC_CONTEXT_PERMISSIONS_READ, addrs[i])
+        == SC_FALSE)
+      return SC_FALSE;
+  }
+
+  return SC_TRUE;
+}
+
+/*! Finds system identifier in index. Entries are removed from index when their sc-elements are erased or content of
+ * their sc-links is changed, so found entries aren't checked by reading sc-memory.
+ * @returns SC_TRUE if entry is found and sc-memory context can read it.
+ */
+static sc_bool _sc_helper_system_identifiers_index_find(
+    sc_memory_context const * ctx,
+    sc_char const * data,
+    sc_uint32 len,
+    sc_system_identifier_fiver * out_fiver)
+{
+  sc_char * idtf;
+  sc_str_cpy(idtf, data, len);
+
+  sc_bool is_found = SC_FALSE;
+  sc_monitor_acquire_read(&system_identifiers_monitor);
+  sc_system_identifier_fiver const * indexed_fiver = sc_hash_table_get(system_identifiers_fivers, idtf);
+  if (indexed_fiver != null_ptr)
+  {
+    *out_fiver = *indexed_fiver;
+    is_found = SC_TRUE;
+  }
+  sc_monitor_release_read(&system_identifiers_monitor);
+  sc_mem_free(idtf);
+
+  // sc-memory context without read permissions gets the same result as search by sc-links contents gives to it
+  if (is_found && _sc_helper_can_read_system_identifier_fiver(ctx, out_fiver) == SC_FALSE)
+  {
+    sc_system_identifier_fiver_make_empty(out_fiver);
+    is_found = SC_FALSE;
+  }
+
+  return is_found;
+}
+
+/*! Fills index by all system identifiers in sc-memory. The first found sc-element is indexed for each system
+ * identifier, as the first found sc-element is returned by search of sc-links with system identifier content.
+ */
+static void _sc_helper_system_identifiers_index_fill(sc_memory_context const * ctx)
+{
+  sc_addr const nrel_system_identifier_addr = sc_keynodes[SC_KEYNODE_NREL_SYSTEM_IDENTIFIER];
+
+  sc_iterator3 * it = sc_iterator3_f_a_a_new(
+      ctx, nrel_system_identifier_addr, sc_type_arc_pos_const_perm, sc_type_arc_common | sc_type_const);
+  while (sc_iterator3_next(it))
+  {
+    sc_system_identifier_fiver fiver;
+    fiver.addr2 = sc_iterator3_value(it, 2);
+    fiver.addr4 = sc_iterator3_value(it, 1);
+    fiver.addr5 = nrel_system_identifier_addr;
+    if (sc_memory_get_arc_info(ctx, fiver.addr2, &fiver.addr1, &fiver.addr3) != SC_RESULT_OK)
+      continue;
+
+    sc_stream * stream = null_ptr;
+    if (sc_memory_get_link_content(ctx, fiver.addr3, &stream) != SC_RESULT_OK || stream == null_ptr)
+      continue;
+
+    sc_char * idtf = null_ptr;
+    sc_uint32 idtf_size = 0;
+    if (sc_stream_get_data(stream, &idtf, &idtf_size) && idtf != null_ptr
+        && sc_hash_table_get(system_identifiers_fivers, idtf) == null_ptr)
+      _sc_helper_system_identifiers_index_insert(idtf, idtf_size, &fiver);
+
+    sc_mem_free(idtf);
+    sc_stream_free(stream);
+  }
+  sc_iterator3_free(it);
+
+  sc_memory_info("Indexed system identifiers: %u", sc_hash_table_size(system_identifiers_fivers));
+}
+
 sc_result resolve_nrel_system_identifier(sc_memory_context const * ctx)
 {
   sc_stream * stream = sc_stream_memory_new(
@@ -109,20 +294,24 @@ void _destroy_keynodes_str()
   sc_mem_free(keynodes_str);
 }
 
-sc_result sc_helper_init(sc_memory_context * ctx)
+sc_result sc_helper_init(sc_memory_context const * ctx)
 {
   sc_memory_info("Initialize sc-helper");
 
   _init_keynodes_str();
 
   sc_keynodes = sc_mem_new(sc_addr, SC_KEYNODE_COUNT);
+  _sc_helper_system_identifiers_index_initialize();
 
   sc_result result = resolve_nrel_system_identifier(ctx);
   if (result != SC_RESULT_OK && result != SC_RESULT_NO)
     goto finish;
 
   if (result == SC_RESULT_OK)
+  {
+    _sc_helper_system_identifiers_index_fill(ctx);
     goto finish;
+  }
 
   sc_memory_info("Can't resolve nrel_system_identifier node. Create the last one");
 
@@ -155,6 +344,7 @@ void sc_helper_shutdown()
 {
   sc_memory_info("Shutdown sc-helper");
 
+  _sc_helper_system_identifiers_index_shutdown();
   sc_mem_free(sc_keynodes);
   _destroy_keynodes_str();
 }
@@ -211,6 +401,10 @@ sc_result sc_helper_find_element_by_system_identifier_ext(
   if (result != SC_RESULT_OK)
     goto error;
 
+  if (_sc_helper_system_identifiers_index_find(ctx, data, len, out_fiver))
+    goto error;
+
+  // system identifier may be set without sc-helper, so it is searched by sc-links contents
   sc_list * found_links;
   stream = sc_stream_memory_new(data, sizeof(sc_char) * len, SC_STREAM_FLAG_READ, SC_FALSE);
 
@@ -246,6 +440,7 @@ sc_result sc_helper_find_element_by_system_identifier_ext(
           sc_iterator5_value(it, 2),
           sc_iterator5_value(it, 3),
           sc_iterator5_value(it, 4)};
+      _sc_helper_system_identifiers_index_insert(data, len, out_fiver);
 
       sc_iterator5_free(it);
       sc_iterator_destroy(links_it);
@@ -324,9 +519,13 @@ sc_result sc_helper_set_system_identifier_ext(
   if (result != SC_RESULT_OK)
     goto error;
 
+  sc_system_identifier_fiver const fiver = {
+      addr, arc_addr, idtf_addr, arc_to_arc_addr, sc_keynodes[SC_KEYNODE_NREL_SYSTEM_IDENTIFIER]};
+  if (SC_ADDR_IS_NOT_EMPTY(arc_to_arc_addr))
+    _sc_helper_system_identifiers_index_insert(data, len, &fiver);
+
   if (out_fiver != null_ptr)
-    *out_fiver = (sc_system_identifier_fiver){
-        addr, arc_addr, idtf_addr, arc_to_arc_addr, sc_keynodes[SC_KEYNODE_NREL_SYSTEM_IDENTIFIER]};
+    *out_fiver = fiver;
 
 error:
   return result;
@@ -21,4 +21,10 @@ sc_result sc_helper_init(sc_memory_context const * ctx);
  */
 void sc_helper_shutdown();
 
+/*! Removes system identifier of sc-element from index of sc-helper if sc-element is sc-link, sc-arc or sc-arc from
+ * `nrel_system_identifier` of indexed system identifier.
+ * @remarks This function is called by sc-storage when sc-element is erased, its sc-type or content is changed.
+ */
+void sc_helper_invalidate_system_identifier(sc_addr addr, sc_element const * element);
+
 #endif
@@ -190,6 +190,11 @@ void sc_memory_context_pending_begin(sc_memory_context * ctx)
   _sc_memory_context_pending_begin(ctx);
 }
 
+void sc_memory_context_coalescing_pending_begin(sc_memory_context * ctx)
+{
+  _sc_memory_context_coalescing_pending_begin(ctx);
+}
+
 void sc_memory_context_pending_end(sc_memory_context * ctx)
 {
   _sc_memory_context_pending_end(ctx);
@@ -235,6 +240,23 @@ sc_bool sc_memory_is_element_ext(sc_memory_context const * ctx, sc_addr addr, sc
   return sc_storage_is_element(ctx, addr);
 }
 
+sc_result sc_memory_are_elements(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_uint32 count,
+    sc_bool * results)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  sc_storage_are_elements(ctx, addrs, count, results);
+  return SC_RESULT_OK;
+}
+
 sc_uint32 sc_memory_get_element_outgoing_arcs_count(sc_memory_context const * ctx, sc_addr addr, sc_result * result)
 {
   if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
@@ -291,6 +313,35 @@ sc_result sc_memory_element_free(sc_memory_context * ctx, sc_addr addr)
   return sc_storage_element_erase(ctx, addr);
 }
 
+sc_result sc_memory_elements_free(sc_memory_context * ctx, sc_addr const * addrs, sc_uint32 count)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  // without local permissions the result of checking is the same for all sc-elements
+  sc_bool const has_local_permissions = _sc_memory_context_has_local_permissions(memory->context_manager, ctx);
+  if (has_local_permissions == SC_FALSE
+      && _sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_ERASE)
+             == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_ERASE_PERMISSIONS;
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    if (has_local_permissions == SC_TRUE
+        && _sc_memory_context_check_local_and_global_permissions(
+               memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_ERASE, addrs[i])
+               == SC_FALSE)
+      return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_ERASE_PERMISSIONS;
+
+    if (_sc_memory_context_check_global_permissions_to_erase_permissions(
+            memory->context_manager, ctx, addrs[i], SC_CONTEXT_PERMISSIONS_TO_ERASE_PERMISSIONS)
+        == SC_FALSE)
+      return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_ERASE_PERMISSIONS;
+  }
+
+  return sc_storage_elements_erase(ctx, addrs, count);
+}
+
 sc_addr sc_memory_node_new(sc_memory_context const * ctx, sc_type type)
 {
   sc_result result;
@@ -330,6 +381,18 @@ sc_addr sc_memory_link_new_ext(sc_memory_context const * ctx, sc_type type, sc_r
   return sc_storage_link_new_ext(ctx, type, result);
 }
 
+sc_result sc_memory_nodes_and_links_new_ext(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_uint32 count,
+    sc_addr * addrs)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  return sc_storage_nodes_and_links_new_ext(ctx, types, count, addrs);
+}
+
 sc_addr sc_memory_arc_new(sc_memory_context const * ctx, sc_type type, sc_addr beg, sc_addr end)
 {
   sc_result result;
@@ -389,6 +452,41 @@ sc_result sc_memory_get_element_type(sc_memory_context const * ctx, sc_addr addr
   return sc_storage_get_element_type(ctx, addr, result);
 }
 
+sc_result sc_memory_get_elements_types(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_uint32 count,
+    sc_type * types)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  // without local permissions the result of checking is the same for all sc-elements
+  sc_bool const has_local_permissions = _sc_memory_context_has_local_permissions(memory->context_manager, ctx);
+  if (has_local_permissions == SC_FALSE
+      && _sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+             == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  sc_storage_get_elements_types(ctx, addrs, count, types);
+  if (has_local_permissions == SC_FALSE)
+    return SC_RESULT_OK;
+
+  sc_result result = SC_RESULT_OK;
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    if (_sc_memory_context_check_local_and_global_permissions(
+            memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ, addrs[i])
+        == SC_FALSE)
+    {
+      types[i] = 0;
+      result = SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+    }
+  }
+
+  return result;
+}
+
 sc_result sc_memory_change_element_subtype(sc_memory_context const * ctx, sc_addr addr, sc_type type)
 {
   if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
@@ -471,6 +569,50 @@ sc_result sc_memory_get_arc_info(sc_memory_context const * ctx, sc_addr addr, sc
   return result;
 }
 
+sc_result sc_memory_get_arcs_info(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_uint32 count,
+    sc_addr * begin_addrs,
+    sc_addr * end_addrs)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  // without local permissions the result of checking is the same for all sc-elements
+  sc_bool const has_local_permissions = _sc_memory_context_has_local_permissions(memory->context_manager, ctx);
+  if (has_local_permissions == SC_FALSE
+      && _sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+             == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  sc_storage_get_arcs_info(ctx, addrs, count, begin_addrs, end_addrs);
+  if (has_local_permissions == SC_FALSE)
+    return SC_RESULT_OK;
+
+  sc_result result = SC_RESULT_OK;
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    if (_sc_memory_context_check_local_and_global_permissions(
+            memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ, addrs[i])
+            == SC_FALSE
+        || (SC_ADDR_IS_NOT_EMPTY(begin_addrs[i])
+            && (_sc_memory_context_check_local_and_global_permissions(
+                    memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ, begin_addrs[i])
+                    == SC_FALSE
+                || _sc_memory_context_check_local_and_global_permissions(
+                       memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ, end_addrs[i])
+                       == SC_FALSE)))
+    {
+      begin_addrs[i] = SC_ADDR_EMPTY;
+      end_addrs[i] = SC_ADDR_EMPTY;
+      result = SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+    }
+  }
+
+  return result;
+}
+
 sc_result sc_memory_set_link_content(sc_memory_context const * ctx, sc_addr addr, sc_stream const * stream)
 {
   return sc_memory_set_link_content_ext(ctx, addr, stream, SC_TRUE);
@@ -613,6 +755,34 @@ sc_result sc_memory_stat(sc_memory_context const * ctx, sc_stat * stat)
   return sc_storage_get_elements_stat(stat);
 }
 
+sc_result sc_memory_get_elements_count_by_type(sc_memory_context const * ctx, sc_type type, sc_uint64 * count)
+{
+  *count = 0;
+
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  *count = sc_storage_get_elements_count_by_type(type);
+  return SC_RESULT_OK;
+}
+
+sc_result sc_memory_events_stat(sc_memory_context const * ctx, sc_events_stat * stat)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  sc_event_emission_manager_get_stat(sc_storage_get_event_emission_manager(), stat);
+  return SC_RESULT_OK;
+}
+
 sc_result sc_memory_save(sc_memory_context const * ctx)
 {
   if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
@@ -132,6 +132,21 @@ _SC_EXTERN sc_addr sc_memory_context_get_user_addr(sc_memory_context * ctx);
  */
 _SC_EXTERN void sc_memory_context_pending_begin(sc_memory_context * ctx);
 
+/*!
+ * @brief Starts events pending mode with coalescing of pending events for a context.
+ *
+ * In this mode, all new emitted events will be pending until `sc_memory_context_pending_end` is called. The same events
+ * (by subscription sc-element, event type and sc-connector) are pended once, events about sc-connectors generated and
+ * erased within the pending mode are cancelled, and events of sc-elements erased within the pending mode are dropped.
+ * Remaining events are emitted as one batch.
+ *
+ * @param ctx Pointer to the sc-memory context.
+ *
+ * @note Use this function for large transactions to keep memory and emission time of pending events bounded.
+ * @see sc_memory_context_pending_end
+ */
+_SC_EXTERN void sc_memory_context_coalescing_pending_begin(sc_memory_context * ctx);
+
 /*!
  * @brief Ends events pending mode for a context.
  *
@@ -214,6 +229,34 @@ _SC_EXTERN sc_bool sc_memory_is_element(sc_memory_context const * ctx, sc_addr a
  */
 _SC_EXTERN sc_bool sc_memory_is_element_ext(sc_memory_context const * ctx, sc_addr addr, sc_result * result);
 
+/*!
+ * @brief Checks if several sc-addrs represent valid sc-elements at once.
+ *
+ * This function checks sc-memory context once and reads sc-elements grouped by sc-segments, so each sc-segment is
+ * locked once. It is faster than checking sc-elements one by one by `sc_memory_is_element_ext`.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addrs A pointer to array of `count` sc-addrs to be checked.
+ * @param count A count of the specified sc-addrs.
+ * @param results [out] A pointer to array of `count` values to store SC_TRUE for sc-addrs of valid sc-elements and
+ * SC_FALSE for the other ones.
+ *
+ * @return Returns the result of the operation.
+ *
+ * @note This function is thread-safe.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context does not have read
+ * permissions.
+ */
+_SC_EXTERN sc_result sc_memory_are_elements(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_uint32 count,
+    sc_bool * results);
+
 /*!
  * @brief Frees the memory occupied by a sc-element and all connected elements.
  *
@@ -237,6 +280,32 @@ _SC_EXTERN sc_bool sc_memory_is_element_ext(sc_memory_context const * ctx, sc_ad
  */
 _SC_EXTERN sc_result sc_memory_element_free(sc_memory_context * ctx, sc_addr addr);
 
+/*!
+ * @brief Frees the memory occupied by several sc-elements and all connected elements at once.
+ *
+ * This function checks sc-memory context once, collects all sc-elements to be erased and unlinks them in one pass. It
+ * is faster than erasing sc-elements one by one by `sc_memory_element_free`, especially if the erased sc-elements are
+ * connected with each other, as in sc-structures.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addrs A pointer to array of `count` sc-addrs of sc-elements to be freed.
+ * @param count A count of the specified sc-addrs.
+ *
+ * @return Returns SC_RESULT_OK if the operation executed successfully. If the sc-memory context has no permissions to
+ * erase some of sc-elements, then none of sc-elements are erased.
+ *
+ * @note This function is thread-safe.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID Some of the specified sc-addrs are not valid. The other sc-elements are
+ * erased.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_ERASE_PERMISSIONS The specified sc-memory context does not have
+ * erase permissions.
+ */
+_SC_EXTERN sc_result sc_memory_elements_free(sc_memory_context * ctx, sc_addr const * addrs, sc_uint32 count);
+
 /*!
  * @brief Generates a new sc-node with the specified type.
  *
@@ -347,6 +416,34 @@ _SC_EXTERN sc_addr sc_memory_link_new2(sc_memory_context const * ctx, sc_type ty
  */
 _SC_EXTERN sc_addr sc_memory_link_new_ext(sc_memory_context const * ctx, sc_type type, sc_result * result);
 
+/*!
+ * @brief Generates several sc-nodes and sc-links with the specified types at once.
+ *
+ * This function checks sc-memory context once and generates all sc-elements in one pass. It is faster than generating
+ * sc-elements one by one by `sc_memory_node_new_ext` and `sc_memory_link_new_ext`.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param types Types of the new sc-elements. Types with sc-link subtype are used to generate sc-links, the other ones
+ * are used to generate sc-nodes.
+ * @param count A count of the new sc-elements.
+ * @param addrs [out] A pointer to array of `count` sc-addrs to store sc-addrs of the new sc-elements.
+ *
+ * @return Returns the result of the operation. If it isn't `SC_RESULT_OK`, then none of sc-elements are generated.
+ *
+ * @note This function is thread-safe.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ELEMENT_IS_NOT_NODE One of the specified sc-types is a sc-connector type.
+ * @retval SC_RESULT_ERROR_FULL_MEMORY Unable to allocate memory for the new sc-elements.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED The specified sc-memory context is not authenticated.
+ */
+_SC_EXTERN sc_result sc_memory_nodes_and_links_new_ext(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_uint32 count,
+    sc_addr * addrs);
+
 /*!
  * @brief Generates a new sc-connector between two sc-elements with the specified type.
  *
@@ -494,6 +591,35 @@ sc_memory_get_element_incoming_arcs_count(sc_memory_context const * ctx, sc_addr
  */
 _SC_EXTERN sc_result sc_memory_get_element_type(sc_memory_context const * ctx, sc_addr addr, sc_type * result);
 
+/*!
+ * @brief Retrieves types of several sc-elements at once.
+ *
+ * This function checks sc-memory context once and reads sc-elements grouped by sc-segments, so each sc-segment is
+ * locked once. It is faster than retrieving types one by one by `sc_memory_get_element_type`. Read permissions are
+ * checked for each sc-element only if the sc-memory context has local permissions.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addrs A pointer to array of `count` sc-addrs of sc-elements.
+ * @param count A count of the specified sc-addrs.
+ * @param types [out] A pointer to array of `count` sc-types to store types of the sc-elements. Types of sc-elements
+ * that don't exist or can't be read by the sc-memory context are set to 0.
+ *
+ * @return Returns the result of the operation.
+ *
+ * @note This function is thread-safe.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context does not have read
+ * permissions for some of sc-elements.
+ */
+_SC_EXTERN sc_result sc_memory_get_elements_types(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_uint32 count,
+    sc_type * types);
+
 /*!
  * @brief Changes the subtype of the specified sc-element.
  *
@@ -608,6 +734,37 @@ _SC_EXTERN sc_result sc_memory_get_arc_end(sc_memory_context const * ctx, sc_add
 _SC_EXTERN sc_result
 sc_memory_get_arc_info(sc_memory_context const * ctx, sc_addr addr, sc_addr * begin_addr, sc_addr * end_addr);
 
+/*!
+ * @brief Retrieves the begin and end sc-addrs of several sc-connectors at once.
+ *
+ * This function checks sc-memory context once and reads sc-connectors grouped by sc-segments, so each sc-segment is
+ * locked once. It is faster than retrieving incident sc-elements one by one by `sc_memory_get_arc_info`. Read
+ * permissions are checked for each sc-element only if the sc-memory context has local permissions.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addrs A pointer to array of `count` sc-addrs of sc-connectors.
+ * @param count A count of the specified sc-addrs.
+ * @param begin_addrs [out] A pointer to array of `count` sc-addrs to store begin sc-addrs of the sc-connectors.
+ * @param end_addrs [out] A pointer to array of `count` sc-addrs to store end sc-addrs of the sc-connectors.
+ *
+ * @return Returns the result of the operation. Begin and end sc-addrs of sc-elements that don't exist, aren't
+ * sc-connectors or can't be read by the sc-memory context are set to empty sc-addrs.
+ *
+ * @note This function is thread-safe.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context does not have read
+ * permissions for some of sc-elements.
+ */
+_SC_EXTERN sc_result sc_memory_get_arcs_info(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_uint32 count,
+    sc_addr * begin_addrs,
+    sc_addr * end_addrs);
+
 /*!
  * @brief Sets the content of the specified sc-link.
  *
@@ -820,6 +977,46 @@ _SC_EXTERN sc_result sc_memory_find_links_contents_by_content_substring(
  */
 _SC_EXTERN sc_result sc_memory_stat(sc_memory_context const * ctx, sc_stat * stat);
 
+/*!
+ * @brief Gets count of sc-elements which sc-types include the specified sc-type.
+ *
+ * Counts of sc-elements are maintained by sc-storage on generation and erasure of sc-elements, so this function doesn't
+ * visit sc-elements. It can be used to estimate selectivity of sc-types, for example, in sc-template search.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param type A sc-type to count sc-elements with it. For example, count of sc-elements with `sc_type_node` is count of
+ * all sc-nodes.
+ * @param count A pointer to count of sc-elements.
+ *
+ * @return Returns SC_RESULT_OK if the operation executed successfully.
+ *
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context does not have read
+ * permissions.
+ */
+_SC_EXTERN sc_result
+sc_memory_get_elements_count_by_type(sc_memory_context const * ctx, sc_type type, sc_uint64 * count);
+
+/*!
+ * @brief Retrieves statistics of sc-events processing.
+ *
+ * This function retrieves size of sc-events queue, amounts of processed and dropped sc-events, amount of times
+ * emitters waited for free space in the queue and total wait and run times of sc-events.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param stat Pointer to the `sc_events_stat` structure where the statistics will be stored.
+ *
+ * @return Returns the result of the operation. If successful, it returns SC_RESULT_OK.
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context does not have read
+ * permissions.
+ */
+_SC_EXTERN sc_result sc_memory_events_stat(sc_memory_context const * ctx, sc_events_stat * stat);
+
 /*!
  * @brief Saves the current state of the sc-storage to persistent storage.
  *
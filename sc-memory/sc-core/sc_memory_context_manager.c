@@ -18,20 +18,12 @@
 
 #include "sc-store/sc-base/sc_allocator.h"
 
-/*! Structure representing parameters for emitting a sc-event.
- * @note This structure holds the parameters required for emitting a sc-event in a memory context.
- */
-struct _sc_event_emit_params
-{
-  sc_addr subscription_addr;      ///< sc-address representing the subscription associated with the event.
-  sc_event_type event_type_addr;  ///< Type of the event to be emitted.
-  sc_addr connector_addr;         ///< sc-address representing the connector associated with the event.
-  sc_type connector_type;         ///< sc-type of the connector associated with the event.
-  sc_addr other_addr;             ///< sc-address representing the other element associated with the event.
-};
-
 #define SC_CONTEXT_FLAG_PENDING_EVENTS 0x1
 #define SC_CONTEXT_FLAG_BLOCKING_EVENTS 0x2
+#define SC_CONTEXT_FLAG_COALESCING_EVENTS 0x4
+
+#define SC_PENDING_ELEMENT_ERASED 0x1
+#define SC_PENDING_ELEMENT_CANCELLED 0x2
 
 #define SC_CONTEXT_PERMISSIONS_FULL 0xff
 
@@ -47,9 +39,10 @@ void _sc_memory_context_manager_initialize(sc_memory_context_manager ** manager,
   (*manager)->user_global_permissions = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
   sc_monitor_init(&(*manager)->user_global_permissions_monitor);
   (*manager)->basic_action_classes = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
-  (*manager)->user_local_permissions =
-      sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, (GDestroyNotify)g_hash_table_destroy);
+  (*manager)->user_local_permissions = sc_hash_table_init(
+      g_direct_hash, g_direct_equal, null_ptr, (GDestroyNotify)_sc_context_destroy_user_local_permissions);
   sc_monitor_init(&(*manager)->user_local_permissions_monitor);
+  (*manager)->retired_local_permissions = null_ptr;
 
   (*manager)->on_new_users_in_sets_events =
       sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, (GDestroyNotify)sc_event_subscription_destroy);
@@ -104,6 +97,7 @@ void _sc_memory_context_manager_shutdown(sc_memory_context_manager * manager)
 
   sc_monitor_destroy(&manager->user_local_permissions_monitor);
   sc_hash_table_destroy(manager->user_local_permissions);
+  _sc_context_destroy_all_retired_local_permissions(manager);
 
   sc_hash_table_destroy(manager->basic_action_classes);
 
@@ -132,8 +126,14 @@ sc_memory_context * _sc_memory_context_new_impl(sc_memory_context_manager * mana
   ctx->user_addr = SC_ADDR_IS_EMPTY(user_addr) ? _sc_memory_context_manager_generate_guest_user(manager) : user_addr;
   ctx->ref_count = 0;
   ctx->global_permissions = _sc_context_get_user_global_permissions(ctx->user_addr);
-  ctx->local_permissions = _sc_context_get_user_local_permissions(ctx->user_addr);
+  ctx->local_permissions = _sc_context_resolve_user_local_permissions(manager, ctx->user_addr);
   ctx->pend_events = null_ptr;
+  ctx->pend_events_table = null_ptr;
+  ctx->pend_erased_elements = null_ptr;
+  ctx->pend_elements_events = null_ptr;
+  ctx->local_permissions_cache = null_ptr;
+  ctx->local_permissions_cache_epoch = 0;
+  sc_monitor_init(&ctx->local_permissions_cache_monitor);
 
   sc_hash_table_insert(
       manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)), (sc_pointer)ctx);
@@ -207,6 +207,16 @@ void _sc_memory_context_free_impl(sc_memory_context_manager * manager, sc_memory
     goto error;
 
   sc_monitor_destroy(&ctx->monitor);
+  if (ctx->pend_events_table != null_ptr)
+    sc_hash_table_destroy(ctx->pend_events_table);
+  if (ctx->pend_erased_elements != null_ptr)
+    sc_hash_table_destroy(ctx->pend_erased_elements);
+  if (ctx->pend_elements_events != null_ptr)
+    sc_hash_table_destroy(ctx->pend_elements_events);
+  _sc_context_release_user_local_permissions(manager, ctx->local_permissions);
+  if (ctx->local_permissions_cache != null_ptr)
+    sc_hash_table_destroy(ctx->local_permissions_cache);
+  sc_monitor_destroy(&ctx->local_permissions_cache_monitor);
   sc_hash_table_remove(manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)));
   --manager->context_count;
 
@@ -231,52 +241,235 @@ sc_bool _sc_memory_context_are_events_pending(sc_memory_context const * ctx)
   return result;
 }
 
-void _sc_memory_context_pend_event(
+#define PENDING_TABLE_KEY(__Addr) GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(__Addr))
+
+static guint _sc_event_emit_params_hash_func(gconstpointer pointer)
+{
+  sc_event_emit_params const * params = pointer;
+  guint hash = SC_ADDR_LOCAL_TO_INT(params->subscription_addr);
+  hash = hash * 31 + SC_ADDR_LOCAL_TO_INT(params->event_type_addr);
+  hash = hash * 31 + SC_ADDR_LOCAL_TO_INT(params->connector_addr);
+  return hash;
+}
+
+static gboolean _sc_event_emit_params_equal_func(gconstpointer a, gconstpointer b)
+{
+  sc_event_emit_params const * params = a;
+  sc_event_emit_params const * other_params = b;
+  return SC_ADDR_IS_EQUAL(params->subscription_addr, other_params->subscription_addr)
+         && SC_ADDR_IS_EQUAL(params->event_type_addr, other_params->event_type_addr)
+         && SC_ADDR_IS_EQUAL(params->connector_addr, other_params->connector_addr);
+}
+
+static sc_bool _sc_memory_context_is_generate_event(sc_event_type event_type_addr)
+{
+  return SC_ADDR_IS_EQUAL(event_type_addr, sc_event_after_generate_connector_addr)
+         || SC_ADDR_IS_EQUAL(event_type_addr, sc_event_after_generate_outgoing_arc_addr)
+         || SC_ADDR_IS_EQUAL(event_type_addr, sc_event_after_generate_incoming_arc_addr)
+         || SC_ADDR_IS_EQUAL(event_type_addr, sc_event_after_generate_edge_addr);
+}
+
+static sc_bool _sc_memory_context_is_erase_event(sc_event_type event_type_addr)
+{
+  return SC_ADDR_IS_EQUAL(event_type_addr, sc_event_before_erase_connector_addr)
+         || SC_ADDR_IS_EQUAL(event_type_addr, sc_event_before_erase_outgoing_arc_addr)
+         || SC_ADDR_IS_EQUAL(event_type_addr, sc_event_before_erase_incoming_arc_addr)
+         || SC_ADDR_IS_EQUAL(event_type_addr, sc_event_before_erase_edge_addr)
+         || SC_ADDR_IS_EQUAL(event_type_addr, sc_event_before_erase_element_addr);
+}
+
+/*! Cancels pending event with specified key if it exists.
+ * @returns Returns SC_TRUE, if pending event was found and cancelled.
+ */
+static sc_bool _sc_memory_context_cancel_pending_event(
+    sc_memory_context * ctx,
+    sc_addr subscription_addr,
+    sc_event_type event_type_addr,
+    sc_addr connector_addr)
+{
+  sc_event_emit_params key;
+  key.subscription_addr = subscription_addr;
+  key.event_type_addr = event_type_addr;
+  key.connector_addr = connector_addr;
+
+  sc_event_emit_params * params = sc_hash_table_get(ctx->pend_events_table, &key);
+  if (params == null_ptr)
+    return SC_FALSE;
+
+  params->is_cancelled = SC_TRUE;
+  sc_hash_table_remove(ctx->pend_events_table, &key);
+  return SC_TRUE;
+}
+
+/*! Cancels all pending events about generation of the sc-connector between specified sc-elements.
+ * @returns Returns SC_TRUE, if the sc-connector was generated within the pending events block.
+ */
+static sc_bool _sc_memory_context_cancel_pending_generate_events(
+    sc_memory_context * ctx,
+    sc_addr connector_addr,
+    sc_addr begin_addr,
+    sc_addr end_addr)
+{
+  sc_bool is_generated = SC_FALSE;
+  is_generated |=
+      _sc_memory_context_cancel_pending_event(ctx, begin_addr, sc_event_after_generate_connector_addr, connector_addr);
+  is_generated |=
+      _sc_memory_context_cancel_pending_event(ctx, end_addr, sc_event_after_generate_connector_addr, connector_addr);
+  is_generated |= _sc_memory_context_cancel_pending_event(
+      ctx, begin_addr, sc_event_after_generate_outgoing_arc_addr, connector_addr);
+  is_generated |=
+      _sc_memory_context_cancel_pending_event(ctx, end_addr, sc_event_after_generate_incoming_arc_addr, connector_addr);
+  is_generated |=
+      _sc_memory_context_cancel_pending_event(ctx, begin_addr, sc_event_after_generate_edge_addr, connector_addr);
+  is_generated |=
+      _sc_memory_context_cancel_pending_event(ctx, end_addr, sc_event_after_generate_edge_addr, connector_addr);
+  return is_generated;
+}
+
+static void _sc_memory_context_element_pending_events_destroy(sc_pointer events)
+{
+  sc_hash_table_list_destroy(events);
+}
+
+/*! Cancels pending events (except erase events) of the sc-element erased within the pending events block. There is no
+ * sense to notify subscribers about changes of sc-elements that will not exist after pending events emission.
+ */
+static void _sc_memory_context_cancel_pending_element_events(sc_memory_context * ctx, sc_addr element_addr)
+{
+  sc_hash_table_list * events = sc_hash_table_get(ctx->pend_elements_events, PENDING_TABLE_KEY(element_addr));
+  for (sc_hash_table_list * item = events; item != null_ptr; item = item->next)
+  {
+    sc_event_emit_params * params = item->data;
+    if (params->is_cancelled)
+      continue;
+
+    params->is_cancelled = SC_TRUE;
+    if (sc_hash_table_get(ctx->pend_events_table, params) == params)
+      sc_hash_table_remove(ctx->pend_events_table, params);
+  }
+  sc_hash_table_remove(ctx->pend_elements_events, PENDING_TABLE_KEY(element_addr));
+}
+
+/*! Coalesces the event with events pended before it.
+ * @returns Returns SC_RESULT_OK, if the event should be pended, SC_RESULT_NO, if the event is cancelled and its
+ * sc-element can be erased immediately, and SC_RESULT_ERROR, if the same event has already been pended.
+ */
+static sc_result _sc_memory_context_coalesce_event(sc_memory_context * ctx, sc_event_emit_params const * params)
+{
+  if (_sc_memory_context_is_generate_event(params->event_type_addr))
+  {
+    // sc-address of the sc-connector can be reused after it was erased within pending events block
+    sc_hash_table_remove(ctx->pend_erased_elements, PENDING_TABLE_KEY(params->connector_addr));
+  }
+  else if (_sc_memory_context_is_erase_event(params->event_type_addr))
+  {
+    sc_bool const is_element_event = SC_ADDR_IS_EQUAL(params->event_type_addr, sc_event_before_erase_element_addr);
+    sc_addr const element_addr = is_element_event ? params->subscription_addr : params->connector_addr;
+    sc_uint32 const state =
+        GPOINTER_TO_UINT(sc_hash_table_get(ctx->pend_erased_elements, PENDING_TABLE_KEY(element_addr)));
+    if (state == SC_PENDING_ELEMENT_CANCELLED)
+      return SC_RESULT_NO;
+
+    _sc_memory_context_cancel_pending_element_events(ctx, element_addr);
+
+    // sc-connector that is generated and erased within the same pending events block is not visible for anyone
+    if (!is_element_event
+        && _sc_memory_context_cancel_pending_generate_events(
+            ctx, params->connector_addr, params->subscription_addr, params->other_addr))
+    {
+      sc_hash_table_insert(
+          ctx->pend_erased_elements, PENDING_TABLE_KEY(element_addr), GUINT_TO_POINTER(SC_PENDING_ELEMENT_CANCELLED));
+      return SC_RESULT_NO;
+    }
+
+    sc_hash_table_insert(
+        ctx->pend_erased_elements, PENDING_TABLE_KEY(element_addr), GUINT_TO_POINTER(SC_PENDING_ELEMENT_ERASED));
+  }
+
+  if (sc_hash_table_get(ctx->pend_events_table, params) != null_ptr)
+    return SC_RESULT_ERROR;
+
+  return SC_RESULT_OK;
+}
+
+sc_result _sc_memory_context_pend_event(
     sc_memory_context const * ctx,
     sc_event_type event_type_addr,
     sc_addr subscription_addr,
     sc_addr connector_addr,
     sc_type connector_type,
-    sc_addr other_addr)
+    sc_addr other_addr,
+    sc_event_do_after_callback callback,
+    sc_addr event_addr)
 {
+  sc_memory_context * context = (sc_memory_context *)ctx;
+
   sc_event_emit_params * params = sc_mem_new(sc_event_emit_params, 1);
   params->event_type_addr = event_type_addr;
   params->subscription_addr = subscription_addr;
   params->connector_addr = connector_addr;
   params->connector_type = connector_type;
   params->other_addr = other_addr;
+  params->callback = callback;
+  params->event_addr = event_addr;
+  params->is_cancelled = SC_FALSE;
+
+  sc_result result = SC_RESULT_OK;
+
+  sc_monitor_acquire_write(&context->monitor);
+  if (context->flags & SC_CONTEXT_FLAG_COALESCING_EVENTS)
+  {
+    result = _sc_memory_context_coalesce_event(context, params);
+    if (result != SC_RESULT_OK)
+    {
+      sc_monitor_release_write(&context->monitor);
+      sc_mem_free(params);
+      // the same event is already pended, so it is considered as emitted
+      return result == SC_RESULT_ERROR ? SC_RESULT_OK : result;
+    }
+
+    sc_hash_table_insert(context->pend_events_table, params, params);
+
+    if (!_sc_memory_context_is_erase_event(event_type_addr))
+    {
+      sc_pointer const element_key = PENDING_TABLE_KEY(subscription_addr);
+      sc_hash_table_list * element_events = sc_hash_table_get(context->pend_elements_events, element_key);
+      sc_hash_table_steal(context->pend_elements_events, element_key);
+      sc_hash_table_insert(
+          context->pend_elements_events, element_key, sc_hash_table_list_prepend(element_events, params));
+    }
+  }
+  context->pend_events = g_slist_prepend(context->pend_events, params);
+  sc_monitor_release_write(&context->monitor);
 
-  sc_monitor_acquire_write((sc_monitor *)&ctx->monitor);
-  ((sc_memory_context *)ctx)->pend_events = sc_hash_table_list_append(ctx->pend_events, params);
-  sc_monitor_release_write((sc_monitor *)&ctx->monitor);
+  return result;
 }
 
-void _sc_memory_context_emit_events(sc_memory_context const * ctx)
+static void _sc_memory_context_emit_pending_events(sc_memory_context const * ctx, sc_hash_table_list * events)
 {
-  GSList * item = null_ptr;
-  sc_event_emit_params * event_params = null_ptr;
+  // Emit all saved events in order of their pending
+  events = g_slist_reverse(events);
+  sc_event_emit_batch_impl(ctx, events);
 
-  // Emit all saved events
-  while (ctx->pend_events)
+  while (events != null_ptr)
   {
-    item = ctx->pend_events;
-    event_params = (sc_event_emit_params *)item->data;
-
-    sc_event_emit_impl(
-        ctx,
-        event_params->subscription_addr,
-        event_params->event_type_addr,
-        event_params->connector_addr,
-        event_params->connector_type,
-        event_params->other_addr,
-        null_ptr,
-        SC_ADDR_EMPTY);
-    sc_mem_free(event_params);
-
-    ((sc_memory_context *)ctx)->pend_events = sc_hash_table_list_remove_sublist(ctx->pend_events, ctx->pend_events);
+    sc_mem_free(events->data);
+    events = sc_hash_table_list_remove_sublist(events, events);
   }
 }
 
+void _sc_memory_context_emit_events(sc_memory_context const * ctx)
+{
+  sc_memory_context * context = (sc_memory_context *)ctx;
+
+  sc_monitor_acquire_write(&context->monitor);
+  sc_hash_table_list * events = context->pend_events;
+  context->pend_events = null_ptr;
+  sc_monitor_release_write(&context->monitor);
+
+  _sc_memory_context_emit_pending_events(ctx, events);
+}
+
 void _sc_memory_context_pending_begin(sc_memory_context * ctx)
 {
   sc_monitor_acquire_write(&ctx->monitor);
@@ -284,12 +477,48 @@ void _sc_memory_context_pending_begin(sc_memory_context * ctx)
   sc_monitor_release_write(&ctx->monitor);
 }
 
+void _sc_memory_context_coalescing_pending_begin(sc_memory_context * ctx)
+{
+  sc_monitor_acquire_write(&ctx->monitor);
+  ctx->flags |= SC_CONTEXT_FLAG_PENDING_EVENTS | SC_CONTEXT_FLAG_COALESCING_EVENTS;
+  if (ctx->pend_events_table == null_ptr)
+    ctx->pend_events_table =
+        sc_hash_table_init(_sc_event_emit_params_hash_func, _sc_event_emit_params_equal_func, null_ptr, null_ptr);
+  if (ctx->pend_erased_elements == null_ptr)
+    ctx->pend_erased_elements = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  if (ctx->pend_elements_events == null_ptr)
+    ctx->pend_elements_events = sc_hash_table_init(
+        g_direct_hash, g_direct_equal, null_ptr, _sc_memory_context_element_pending_events_destroy);
+  sc_monitor_release_write(&ctx->monitor);
+}
+
 void _sc_memory_context_pending_end(sc_memory_context * ctx)
 {
   sc_monitor_acquire_write(&ctx->monitor);
-  ctx->flags &= ~SC_CONTEXT_FLAG_PENDING_EVENTS;
-  _sc_memory_context_emit_events(ctx);
+  ctx->flags &= ~(SC_CONTEXT_FLAG_PENDING_EVENTS | SC_CONTEXT_FLAG_COALESCING_EVENTS);
+
+  sc_hash_table_list * events = ctx->pend_events;
+  ctx->pend_events = null_ptr;
+
+  if (ctx->pend_events_table != null_ptr)
+  {
+    sc_hash_table_destroy(ctx->pend_events_table);
+    ctx->pend_events_table = null_ptr;
+  }
+  if (ctx->pend_erased_elements != null_ptr)
+  {
+    sc_hash_table_destroy(ctx->pend_erased_elements);
+    ctx->pend_erased_elements = null_ptr;
+  }
+  if (ctx->pend_elements_events != null_ptr)
+  {
+    sc_hash_table_destroy(ctx->pend_elements_events);
+    ctx->pend_elements_events = null_ptr;
+  }
   sc_monitor_release_write(&ctx->monitor);
+
+  // Events are emitted outside the context monitor, because erase callbacks of events use this context
+  _sc_memory_context_emit_pending_events(ctx, events);
 }
 
 sc_bool _sc_memory_context_are_events_blocking(sc_memory_context const * ctx)
@@ -13,9 +13,11 @@
 
 #include "sc-store/sc-base/sc_message.h"
 #include "sc-store/sc-base/sc_monitor.h"
+#include "sc-store/sc-event/sc_event_queue.h"
 
 typedef struct _sc_memory_context_manager sc_memory_context_manager;
 typedef struct _sc_event_emit_params sc_event_emit_params;
+typedef struct _sc_user_local_permissions sc_user_local_permissions;
 
 extern sc_memory_context * s_memory_default_ctx;
 
@@ -98,6 +100,15 @@ sc_bool _sc_memory_context_are_events_pending(sc_memory_context const * ctx);
  */
 void _sc_memory_context_pending_begin(sc_memory_context * ctx);
 
+/*! Function that marks the beginning of a pending events block with coalescing of pending events in a sc-memory
+ * context.
+ * @param ctx Pointer to the sc-memory context for which the pending events block begins.
+ * @note Within this block the same events (by subscription sc-element, event type and sc-connector) are pended once,
+ * events about sc-connectors generated and erased within the block are cancelled, and events of sc-elements erased
+ * within the block are dropped. All remaining events are emitted as one batch at the end of the block.
+ */
+void _sc_memory_context_coalescing_pending_begin(sc_memory_context * ctx);
+
 /*! Function that marks the end of a pending events block in a sc-memory context, emitting pending events.
  * @param ctx Pointer to the sc-memory context for which the pending events block ends.
  * @note This function marks the end of a pending events block in the sc-memory context, emitting all pending events.
@@ -111,15 +122,21 @@ void _sc_memory_context_pending_end(sc_memory_context * ctx);
  * @param connector_addr sc-address representing the sc-connector associated with the event.
  * @param connector_type sc-type representing the sc-connector associated with the event.
  * @param other_addr sc-address representing the other sc-element associated with the event.
+ * @param callback A pointer function that is executed after the execution of a function that was called on the
+ * emitted event.
+ * @param event_addr An argument of callback.
+ * @returns Returns SC_RESULT_OK, if the event is pended, and SC_RESULT_NO, if the event is cancelled by coalescing.
  * @note This function adds an event to the pending events list in the sc-memory context, to be emitted later.
  */
-void _sc_memory_context_pend_event(
+sc_result _sc_memory_context_pend_event(
     sc_memory_context const * ctx,
     sc_event_type event_type_addr,
     sc_addr subscription_addr,
     sc_addr connector_addr,
     sc_type connector_type,
-    sc_addr other_addr);
+    sc_addr other_addr,
+    sc_event_do_after_callback callback,
+    sc_addr event_addr);
 
 /*! Function that emits pending events in a sc-memory context.
  * @param ctx Pointer to the sc-memory context for which pending events are emitted.
@@ -10,9 +10,14 @@
 
 #include "sc-store/sc_storage_private.h"
 #include "sc-store/sc_iterator3.h"
+#include "sc-store/sc-base/sc_atomic.h"
+#include "sc-store/sc-base/sc_allocator.h"
 #include "sc_helper.h"
 #include "sc_keynodes.h"
 
+//! Maximum number of cached results of local permissions checks per sc-memory context.
+#define SC_CONTEXT_LOCAL_PERMISSIONS_CACHE_MAX_SIZE 65536
+
 typedef void (*sc_users_permissions_updater)(sc_memory_context_manager *, sc_addr, sc_addr, sc_addr);
 typedef void (*sc_users_updater)(sc_memory_context_manager *, sc_addr, sc_addr, sc_addr, sc_users_permissions_updater);
 typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_addr, sc_addr, sc_users_updater);
@@ -24,11 +29,7 @@ typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_ad
  * @return None.
  */
 #define _sc_context_add_context_global_permissions(_context, _adding_permissions) \
-  ({ \
-    sc_monitor_acquire_write(&(_context)->monitor); \
-    (_context)->global_permissions |= (_adding_permissions); \
-    sc_monitor_release_write(&(_context)->monitor); \
-  })
+  sc_atomic_int_or(&(_context)->global_permissions, _adding_permissions)
 
 /**
  * @brief Removes global permissions (within the knowledge base) from a given sc-memory context.
@@ -37,11 +38,7 @@ typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_ad
  * @return None.
  */
 #define _sc_context_remove_context_global_permissions(_context, _removing_permissions) \
-  ({ \
-    sc_monitor_acquire_write(&(_context)->monitor); \
-    (_context)->global_permissions &= ~(_removing_permissions); \
-    sc_monitor_release_write(&(_context)->monitor); \
-  })
+  sc_atomic_int_and(&(_context)->global_permissions, ~(sc_uint32)(_removing_permissions))
 
 /**
  * @brief Checks if a given subset of permissions is present in the permission.
@@ -52,13 +49,18 @@ typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_ad
 #define sc_context_has_permissions_subset(_permissions, _permissions_subset) \
   ((_permissions) & (_permissions_subset)) == _permissions_subset
 
-//! Gets sc-memory context global permissions.
+//! Gets sc-memory context global permissions. They are changed atomically, so readers don't lock the context.
 #define _sc_context_get_context_global_permissions(_context) \
+  ((sc_permissions)sc_atomic_int_get(&(_context)->global_permissions))
+
+//! Gets the current snapshot of sc-memory context local permissions. Snapshots are immutable, so they are read without
+//! locks between start and end of reading of local permissions.
+#define _sc_context_get_context_local_permissions(_context) \
   ({ \
-    sc_monitor_acquire_read((sc_monitor *)&(_context)->monitor); \
-    sc_permissions const _context_permissions = (_context)->global_permissions; \
-    sc_monitor_release_read((sc_monitor *)&(_context)->monitor); \
-    _context_permissions; \
+    sc_user_local_permissions * _user_local_permissions = sc_atomic_pointer_get(&(_context)->local_permissions); \
+    _user_local_permissions == null_ptr \
+        ? null_ptr \
+        : (sc_hash_table *)sc_atomic_pointer_get(&_user_local_permissions->permissions); \
   })
 
 /**
@@ -117,106 +119,309 @@ typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_ad
       _sc_context_remove_context_global_permissions(ctx, _removing_permissions); \
   })
 
-/**
- * @brief Adds local permissions (within sc-structure) for a specific user in the context manager.
- * @param _user_addr sc-address of the user.
- * @param _adding_permissions Permissions to be added.
- * @return None.
+/*! Structure representing a thread that reads local permissions of users. Records are reused by new threads after
+ * their threads end, so they are never destroyed and checks of permissions don't lock them.
  */
-#define _sc_context_add_user_local_permissions(_user_addr, _adding_permissions, _structure_addr) \
-  ({ \
-    sc_monitor_acquire_write(&manager->user_local_permissions_monitor); \
-    sc_hash_table * structures_permissions_table = \
-        sc_hash_table_get(manager->user_local_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr))); \
-    sc_permissions _user_permissions = 0; \
-    if (structures_permissions_table == null_ptr) \
-    { \
-      structures_permissions_table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr); \
-      sc_hash_table_insert( \
-          manager->user_local_permissions, \
-          GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr)), \
-          structures_permissions_table); \
-    } \
-    else \
-      _user_permissions = (sc_uint64)sc_hash_table_get( \
-          structures_permissions_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_structure_addr))); \
-    _user_permissions |= (_adding_permissions); \
-    sc_hash_table_insert( \
-        structures_permissions_table, \
-        GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_structure_addr)), \
-        GINT_TO_POINTER(_user_permissions)); \
-    sc_monitor_release_write(&manager->user_local_permissions_monitor); \
-  })
+typedef struct _sc_local_permissions_reader
+{
+  sc_uint32 epoch;    ///< Epoch of local permissions in which the thread started reading or 0 if it doesn't read them.
+  sc_uint32 depth;    ///< Depth of nested readings in the thread. It is changed only by the thread.
+  sc_uint32 is_used;  ///< Whether the record belongs to an alive thread.
+  struct _sc_local_permissions_reader * next;  ///< Next record of threads.
+} sc_local_permissions_reader;
+
+/*! Structure representing replaced snapshot of local permissions or local permissions of a user without sc-memory
+ * contexts and local permissions.
+ */
+typedef struct _sc_retired_local_permissions
+{
+  sc_pointer data;         ///< Pointer to the retired snapshot or local permissions of the user.
+  GDestroyNotify destroy;  ///< Function that destroys data.
+  sc_uint32 epoch;         ///< Epoch of local permissions in which data was retired.
+} sc_retired_local_permissions;
 
-/**
- * @brief Removes local permissions (within sc-structure) for a specific user in the context manager.
- * @param _user_addr sc-address of the user.
- * @param _removing_permissions Permissions to be removed.
- * @return None.
+//! List of records of threads which have ever read local permissions.
+static sc_local_permissions_reader * local_permissions_readers = null_ptr;
+//! Epoch of reading local permissions. It is incremented when local permissions are retired.
+static sc_uint32 local_permissions_readers_epoch = 1;
+
+static void _sc_context_free_local_permissions_reader(sc_pointer data)
+{
+  sc_local_permissions_reader * reader = data;
+  sc_atomic_int_set(&reader->is_used, SC_FALSE);
+}
+
+//! Record of the current thread in the list of records of threads reading local permissions.
+static GPrivate local_permissions_reader_key = G_PRIVATE_INIT(_sc_context_free_local_permissions_reader);
+
+/*! Function that gets a record of the current thread for reading local permissions. The thread takes a record of an
+ * ended thread or adds a new record to the list of records.
+ * @returns Returns a pointer to the record of the current thread.
  */
-#define _sc_context_remove_user_local_permissions(_user_addr, _removing_permissions, _structure_addr) \
-  ({ \
-    sc_monitor_acquire_write(&manager->user_local_permissions_monitor); \
-    sc_hash_table * structures_permissions_table = \
-        sc_hash_table_get(manager->user_local_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr))); \
-    sc_permissions _user_permissions = 0; \
-    if (structures_permissions_table != null_ptr) \
-    { \
-      _user_permissions = (sc_uint64)sc_hash_table_get( \
-          structures_permissions_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_structure_addr))); \
-      _user_permissions &= ~(_removing_permissions); \
-      sc_hash_table_insert( \
-          structures_permissions_table, \
-          GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_structure_addr)), \
-          GINT_TO_POINTER(_user_permissions)); \
-    } \
-    sc_monitor_release_write(&manager->user_local_permissions_monitor); \
-  })
+static sc_local_permissions_reader * _sc_context_get_local_permissions_reader(void)
+{
+  sc_local_permissions_reader * reader = g_private_get(&local_permissions_reader_key);
+  if (reader != null_ptr)
+    return reader;
 
-/**
- * @brief Adds local permissions (within sc-structure) to a given sc-memory context.
- * @param _context Pointer to the sc-memory context.
- * @param _adding_permissions Permissions to be added.
- * @return None.
+  for (reader = sc_atomic_pointer_get(&local_permissions_readers); reader != null_ptr; reader = reader->next)
+  {
+    if (sc_atomic_int_compare_and_exchange(&reader->is_used, SC_FALSE, SC_TRUE))
+      break;
+  }
+
+  if (reader == null_ptr)
+  {
+    reader = sc_mem_new(sc_local_permissions_reader, 1);
+    reader->is_used = SC_TRUE;
+    do
+      reader->next = sc_atomic_pointer_get(&local_permissions_readers);
+    while (!sc_atomic_pointer_compare_and_exchange(&local_permissions_readers, reader->next, reader));
+  }
+
+  g_private_set(&local_permissions_reader_key, reader);
+  return reader;
+}
+
+/*! Function that starts reading of local permissions of users in the current thread. Snapshots replaced during reading
+ * aren't destroyed until it ends.
+ * @note The thread publishes the current epoch only in its own record, so concurrent checks of permissions don't
+ * change shared memory.
  */
-#define _sc_context_add_context_local_permissions(_context, _adding_permissions, _structure_addr) \
-  ({ \
-    _sc_context_add_user_local_permissions((_context)->user_addr, _adding_permissions, _structure_addr); \
-    if ((_context)->local_permissions == null_ptr) \
-    { \
-      sc_monitor_acquire_write(&manager->user_local_permissions_monitor); \
-      (_context)->local_permissions = sc_hash_table_get( \
-          manager->user_local_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT((_context)->user_addr))); \
-      sc_monitor_release_write(&manager->user_local_permissions_monitor); \
-    } \
-  })
+static void _sc_context_start_reading_local_permissions(void)
+{
+  sc_local_permissions_reader * reader = _sc_context_get_local_permissions_reader();
+  if (reader->depth++ == 0)
+    sc_atomic_int_set(&reader->epoch, sc_atomic_int_get(&local_permissions_readers_epoch));
+}
 
-/**
- * @brief Removes local permissions (within sc-structure) from a given sc-memory context.
- * @param _context Pointer to the sc-memory context.
- * @param _removing_permissions Permissions to be removed.
- * @return None.
+//! Function that ends reading of local permissions of users in the current thread.
+static void _sc_context_end_reading_local_permissions(void)
+{
+  sc_local_permissions_reader * reader = g_private_get(&local_permissions_reader_key);
+  if (--reader->depth == 0)
+    sc_atomic_int_set(&reader->epoch, 0);
+}
+
+/*! Function that destroys retired local permissions which can't be read by any check of permissions.
+ * @param manager Pointer to the sc-memory context manager.
+ * @note It is called when the monitor of users local permissions is acquired for writing. Data retired in some epoch is
+ * replaced before the epoch is incremented, so checks that started reading in later epochs load only newer data. Data
+ * retired in epochs less than the least epoch of reading threads is destroyed.
+ */
+static void _sc_context_destroy_retired_local_permissions(sc_memory_context_manager * manager)
+{
+  sc_uint32 min_epoch = sc_atomic_int_get(&local_permissions_readers_epoch);
+  for (sc_local_permissions_reader * reader = sc_atomic_pointer_get(&local_permissions_readers); reader != null_ptr;
+       reader = reader->next)
+  {
+    sc_uint32 const epoch = sc_atomic_int_get(&reader->epoch);
+    if (epoch != 0 && epoch < min_epoch)
+      min_epoch = epoch;
+  }
+
+  // Retired data is prepended, so the list is ordered by epochs descending
+  sc_hash_table_list * previous = null_ptr;
+  sc_hash_table_list * item = manager->retired_local_permissions;
+  while (item != null_ptr && ((sc_retired_local_permissions *)item->data)->epoch >= min_epoch)
+  {
+    previous = item;
+    item = item->next;
+  }
+
+  if (previous == null_ptr)
+    manager->retired_local_permissions = null_ptr;
+  else
+    previous->next = null_ptr;
+
+  for (sc_hash_table_list * destroyed_item = item; destroyed_item != null_ptr; destroyed_item = destroyed_item->next)
+  {
+    sc_retired_local_permissions * retired = destroyed_item->data;
+    retired->destroy(retired->data);
+    sc_mem_free(retired);
+  }
+  sc_hash_table_list_destroy(item);
+}
+
+static void _sc_context_destroy_local_permissions_snapshot(sc_pointer data)
+{
+  sc_hash_table_destroy(data);
+}
+
+/*! Function that retires replaced local permissions. They are destroyed when all checks of permissions that could read
+ * them end.
+ * @param manager Pointer to the sc-memory context manager.
+ * @param data Pointer to the replaced snapshot or local permissions of the user.
+ * @param destroy Function that destroys data.
+ * @note It is called when the monitor of users local permissions is acquired for writing and after data is replaced.
  */
-#define _sc_context_remove_context_local_permissions(_context, _removing_permissions, _structure_addr) \
-  _sc_context_remove_user_local_permissions((_context)->user_addr, _removing_permissions, _structure_addr)
+static void _sc_context_retire_local_permissions(
+    sc_memory_context_manager * manager,
+    sc_pointer data,
+    GDestroyNotify destroy)
+{
+  sc_retired_local_permissions * retired = sc_mem_new(sc_retired_local_permissions, 1);
+  retired->data = data;
+  retired->destroy = destroy;
+  retired->epoch = sc_atomic_int_get(&local_permissions_readers_epoch);
+  sc_atomic_int_inc(&local_permissions_readers_epoch);
+
+  manager->retired_local_permissions = sc_hash_table_list_prepend(manager->retired_local_permissions, retired);
+  _sc_context_destroy_retired_local_permissions(manager);
+}
+
+void _sc_context_destroy_all_retired_local_permissions(sc_memory_context_manager * manager)
+{
+  for (sc_hash_table_list * item = manager->retired_local_permissions; item != null_ptr; item = item->next)
+  {
+    sc_retired_local_permissions * retired = item->data;
+    retired->destroy(retired->data);
+    sc_mem_free(retired);
+  }
+  sc_hash_table_list_destroy(manager->retired_local_permissions);
+  manager->retired_local_permissions = null_ptr;
+}
+
+static sc_user_local_permissions * _sc_context_new_user_local_permissions(
+    sc_memory_context_manager * manager,
+    sc_addr user_addr)
+{
+  sc_user_local_permissions * user_local_permissions = sc_mem_new(sc_user_local_permissions, 1);
+  user_local_permissions->user_addr = user_addr;
+  user_local_permissions->permissions = null_ptr;
+  user_local_permissions->ref_count = 0;
+  sc_hash_table_insert(
+      manager->user_local_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(user_addr)), user_local_permissions);
+  return user_local_permissions;
+}
+
+sc_user_local_permissions * _sc_context_resolve_user_local_permissions(
+    sc_memory_context_manager * manager,
+    sc_addr user_addr)
+{
+  sc_monitor_acquire_write(&manager->user_local_permissions_monitor);
+
+  sc_user_local_permissions * user_local_permissions =
+      sc_hash_table_get(manager->user_local_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(user_addr)));
+  if (user_local_permissions == null_ptr)
+    user_local_permissions = _sc_context_new_user_local_permissions(manager, user_addr);
+  ++user_local_permissions->ref_count;
+
+  sc_monitor_release_write(&manager->user_local_permissions_monitor);
+
+  return user_local_permissions;
+}
+
+void _sc_context_release_user_local_permissions(
+    sc_memory_context_manager * manager,
+    sc_user_local_permissions * user_local_permissions)
+{
+  if (user_local_permissions == null_ptr)
+    return;
+
+  sc_monitor_acquire_write(&manager->user_local_permissions_monitor);
+
+  --user_local_permissions->ref_count;
+  if (user_local_permissions->ref_count == 0 && user_local_permissions->permissions == null_ptr)
+  {
+    // Checks in other threads may still read it by the re-bound sc-memory context, so it is destroyed later
+    sc_hash_table_steal(
+        manager->user_local_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(user_local_permissions->user_addr)));
+    _sc_context_retire_local_permissions(
+        manager, user_local_permissions, (GDestroyNotify)_sc_context_destroy_user_local_permissions);
+  }
+
+  sc_monitor_release_write(&manager->user_local_permissions_monitor);
+}
+
+void _sc_context_destroy_user_local_permissions(sc_user_local_permissions * user_local_permissions)
+{
+  if (user_local_permissions->permissions != null_ptr)
+    sc_hash_table_destroy(user_local_permissions->permissions);
+  sc_mem_free(user_local_permissions);
+}
+
+/*! Function that updates local permissions (within sc-structure) of a specific user in the context manager.
+ * @param manager Pointer to the sc-memory context manager.
+ * @param user_addr sc-address of the user.
+ * @param structure_addr sc-address of the sc-structure.
+ * @param adding_permissions Permissions to be added.
+ * @param removing_permissions Permissions to be removed.
+ * @note Local permissions of a user are an immutable snapshot shared by all sc-memory contexts of the user. Its changed
+ * copy replaces it, so checks of permissions only load a pointer to the current snapshot. Replaced snapshots may be
+ * still read by concurrent checks, so they are destroyed when all checks that could read them end.
+ */
+void _sc_context_update_user_local_permissions(
+    sc_memory_context_manager * manager,
+    sc_addr user_addr,
+    sc_addr structure_addr,
+    sc_permissions adding_permissions,
+    sc_permissions removing_permissions)
+{
+  sc_pointer const user_key = GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(user_addr));
+  sc_pointer const structure_key = GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(structure_addr));
+
+  sc_monitor_acquire_write(&manager->user_local_permissions_monitor);
+
+  sc_user_local_permissions * user_local_permissions = sc_hash_table_get(manager->user_local_permissions, user_key);
+  sc_hash_table * permissions_table =
+      user_local_permissions == null_ptr ? null_ptr : user_local_permissions->permissions;
+  if (permissions_table == null_ptr && adding_permissions == 0)
+    goto result;
+
+  if (user_local_permissions == null_ptr)
+    user_local_permissions = _sc_context_new_user_local_permissions(manager, user_addr);
+
+  sc_hash_table * new_permissions_table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  if (permissions_table != null_ptr)
+  {
+    sc_hash_table_iterator iterator;
+    sc_pointer key, value;
+    sc_hash_table_iterator_init(&iterator, permissions_table);
+    while (sc_hash_table_iterator_next(&iterator, &key, &value))
+      sc_hash_table_insert(new_permissions_table, key, value);
+  }
+
+  sc_permissions user_permissions = (sc_uint64)sc_hash_table_get(new_permissions_table, structure_key);
+  user_permissions = (user_permissions | adding_permissions) & ~removing_permissions;
+  sc_hash_table_insert(new_permissions_table, structure_key, GINT_TO_POINTER(user_permissions));
+  sc_atomic_pointer_set(&user_local_permissions->permissions, new_permissions_table);
+
+  if (permissions_table != null_ptr)
+    _sc_context_retire_local_permissions(manager, permissions_table, _sc_context_destroy_local_permissions_snapshot);
+
+result:
+  sc_monitor_release_write(&manager->user_local_permissions_monitor);
+
+  sc_storage_invalidate_local_permissions();
+}
+
+/*! Function that starts reading of local permissions of a specific user in the context manager.
+ * @param manager Pointer to the sc-memory context manager.
+ * @param user_addr sc-address of the user.
+ * @returns Returns the current snapshot of local permissions of the user or null_ptr if there are no ones. It is valid
+ * until reading of local permissions is ended.
+ */
+static sc_hash_table * _sc_context_start_reading_user_local_permissions(
+    sc_memory_context_manager * manager,
+    sc_addr user_addr)
+{
+  _sc_context_start_reading_local_permissions();
+
+  sc_monitor_acquire_read(&manager->user_local_permissions_monitor);
+  sc_user_local_permissions * user_local_permissions =
+      sc_hash_table_get(manager->user_local_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(user_addr)));
+  sc_hash_table * permissions = user_local_permissions == null_ptr ? null_ptr : user_local_permissions->permissions;
+  sc_monitor_release_read(&manager->user_local_permissions_monitor);
+
+  return permissions;
+}
 
 #define _sc_context_add_local_permissions(_user_addr, _adding_permissions, _structure_addr) \
-  ({ \
-    sc_memory_context * ctx = _sc_memory_context_get_impl(manager, _user_addr); \
-    if (ctx == null_ptr) \
-      _sc_context_add_user_local_permissions(user_addr, _adding_permissions, _structure_addr); \
-    else \
-      _sc_context_add_context_local_permissions(ctx, _adding_permissions, _structure_addr); \
-  })
+  _sc_context_update_user_local_permissions(manager, _user_addr, _structure_addr, _adding_permissions, 0)
 
 #define _sc_context_remove_local_permissions(_user_addr, _removing_permissions, _structure_addr) \
-  ({ \
-    sc_memory_context * ctx = _sc_memory_context_get_impl(manager, _user_addr); \
-    if (ctx == null_ptr) \
-      _sc_context_remove_user_local_permissions(user_addr, _removing_permissions, _structure_addr); \
-    else \
-      _sc_context_remove_context_local_permissions(ctx, _removing_permissions, _structure_addr); \
-  })
+  _sc_context_update_user_local_permissions(manager, _user_addr, _structure_addr, 0, _removing_permissions)
 
 sc_addr _sc_memory_context_manager_generate_guest_user(sc_memory_context_manager * manager)
 {
@@ -254,9 +459,12 @@ sc_result _sc_memory_context_manager_on_identified_user(
 
   sc_hash_table_remove(manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)));
 
+  sc_user_local_permissions * quest_user_local_permissions = ctx->local_permissions;
   ctx->user_addr = identified_user_addr;
-  ctx->global_permissions = _sc_context_get_user_global_permissions(ctx->user_addr);
-  ctx->local_permissions = _sc_context_get_user_local_permissions(ctx->user_addr);
+  sc_atomic_int_set(&ctx->global_permissions, _sc_context_get_user_global_permissions(ctx->user_addr));
+  sc_atomic_pointer_set(
+      &ctx->local_permissions, _sc_context_resolve_user_local_permissions(manager, ctx->user_addr));
+  _sc_context_release_user_local_permissions(manager, quest_user_local_permissions);
 
   sc_hash_table_insert(
       manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)), (sc_pointer)ctx);
@@ -398,7 +606,7 @@ sc_result _sc_memory_context_manager_on_new_user_in_users_set(
   sc_permissions const global_permissions = _sc_context_get_user_global_permissions(users_set_addr);
   _sc_context_add_global_permissions(user_addr, global_permissions);
 
-  sc_hash_table * local_permissions = _sc_context_get_user_local_permissions(users_set_addr);
+  sc_hash_table * local_permissions = _sc_context_start_reading_user_local_permissions(manager, users_set_addr);
   if (local_permissions == null_ptr)
     goto end;
 
@@ -416,6 +624,8 @@ sc_result _sc_memory_context_manager_on_new_user_in_users_set(
 
 end:
 {
+  _sc_context_end_reading_local_permissions();
+
   // Remove all negative sc-arcs
   sc_iterator3 * it3 =
       sc_iterator3_f_a_f_new(s_memory_default_ctx, event->subscription_addr, sc_type_arc_neg_const_temp, user_addr);
@@ -447,7 +657,7 @@ sc_result _sc_memory_context_manager_on_remove_user_from_users_set(
   sc_permissions const global_permissions = _sc_context_get_user_global_permissions(users_set_addr);
   _sc_context_remove_global_permissions(user_addr, global_permissions);
 
-  sc_hash_table * local_permissions = _sc_context_get_user_local_permissions(users_set_addr);
+  sc_hash_table * local_permissions = _sc_context_start_reading_user_local_permissions(manager, users_set_addr);
   if (local_permissions == null_ptr)
     goto end;
 
@@ -464,6 +674,7 @@ sc_result _sc_memory_context_manager_on_remove_user_from_users_set(
   }
 
 end:
+  _sc_context_end_reading_local_permissions();
   sc_memory_arc_new(s_memory_default_ctx, sc_type_arc_neg_const_temp, users_set_addr, user_addr);
 
   return SC_RESULT_OK;
@@ -872,14 +1083,14 @@ sc_result _sc_memory_context_manager_on_new_user_or_users_set_action_class_withi
   sc_memory_context_manager * manager = sc_event_subscription_get_data(event);
 
   // Only positive access sc-arcs can be used
-  if (sc_type_has_subtype_in_mask(connector_type, sc_type_arc_pos_const))
+  if (sc_type_has_subtype(connector_type, sc_type_arc_pos_const))
   {
     _sc_memory_context_manager_add_user_action_class_within_structure(
         manager, connector_addr, arc_to_arc_between_action_class_and_structure_addr, updater);
     return SC_RESULT_NO;
   }
 
-  if (sc_type_has_subtype_in_mask(connector_type, sc_type_arc_neg_const))
+  if (sc_type_has_subtype(connector_type, sc_type_arc_neg_const))
   {
     _sc_memory_context_manager_remove_user_action_class_within_structure(
         manager, connector_addr, arc_to_arc_between_action_class_and_structure_addr, updater);
@@ -1270,21 +1481,20 @@ sc_bool _sc_memory_context_check_if_has_permitted_structure(
   if (_sc_memory_context_check_system(manager, ctx))
     return SC_TRUE;
 
-  sc_bool result = SC_FALSE;
+  _sc_context_start_reading_local_permissions();
 
-  sc_monitor_acquire_read((sc_monitor *)&ctx->monitor);
-  sc_hash_table * permissions_table = ctx->local_permissions;
+  sc_bool result = SC_FALSE;
+  sc_hash_table * permissions_table = _sc_context_get_context_local_permissions(ctx);
 
   // If element is permitted structure
-  if (permissions_table == null_ptr)
-    goto result;
-
-  sc_permissions permissions =
-      (sc_uint64)sc_hash_table_get(permissions_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(element_addr)));
-  result = sc_context_has_permissions_subset(permissions, action_class_permissions);
+  if (permissions_table != null_ptr)
+  {
+    sc_permissions const permissions =
+        (sc_uint64)sc_hash_table_get(permissions_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(element_addr)));
+    result = sc_context_has_permissions_subset(permissions, action_class_permissions);
+  }
 
-result:
-  sc_monitor_release_read((sc_monitor *)&ctx->monitor);
+  _sc_context_end_reading_local_permissions();
 
   return result;
 }
@@ -1296,6 +1506,72 @@ result:
     _result; \
   })
 
+sc_bool _sc_memory_context_has_local_permissions(sc_memory_context_manager * manager, sc_memory_context const * ctx)
+{
+  if (_sc_memory_context_check_system(manager, ctx))
+    return SC_FALSE;
+
+  _sc_context_start_reading_local_permissions();
+  sc_bool const result = _sc_context_get_context_local_permissions(ctx) != null_ptr;
+  _sc_context_end_reading_local_permissions();
+
+  return result;
+}
+
+//! Makes a key of the local permissions cache from sc-address of a checked sc-element and checked permissions.
+#define _sc_context_local_permissions_cache_key(_element_addr, _permissions) \
+  ((sc_pointer)(((sc_uint64)(_permissions) << 32) | SC_ADDR_LOCAL_TO_INT(_element_addr)))
+
+/*! Function that gets a cached result of local permissions check for a sc-element.
+ * @param ctx Pointer to the sc-memory context in which the check is performed.
+ * @param cache_key Key made from sc-address of the checked sc-element and checked permissions.
+ * @param epoch Current version of local permissions.
+ * @returns Returns the cached result or SC_RESULT_ERROR if there is no result for the current version of local
+ * permissions.
+ */
+static sc_result _sc_memory_context_get_cached_local_permissions(
+    sc_memory_context const * ctx,
+    sc_pointer cache_key,
+    sc_uint32 epoch)
+{
+  sc_result result = SC_RESULT_ERROR;
+
+  sc_monitor_acquire_read((sc_monitor *)&ctx->local_permissions_cache_monitor);
+  if (ctx->local_permissions_cache != null_ptr && ctx->local_permissions_cache_epoch == epoch)
+    result = (sc_result)GPOINTER_TO_INT(sc_hash_table_get(ctx->local_permissions_cache, cache_key));
+  sc_monitor_release_read((sc_monitor *)&ctx->local_permissions_cache_monitor);
+
+  return result;
+}
+
+/*! Function that caches a result of local permissions check for a sc-element. Results cached for other versions of
+ * local permissions are dropped.
+ * @param ctx Pointer to the sc-memory context in which the check is performed.
+ * @param cache_key Key made from sc-address of the checked sc-element and checked permissions.
+ * @param epoch Version of local permissions for which the check is performed.
+ * @param result Result of the check.
+ */
+static void _sc_memory_context_cache_local_permissions(
+    sc_memory_context const * ctx,
+    sc_pointer cache_key,
+    sc_uint32 epoch,
+    sc_result result)
+{
+  sc_memory_context * context = (sc_memory_context *)ctx;
+
+  sc_monitor_acquire_write(&context->local_permissions_cache_monitor);
+  if (context->local_permissions_cache == null_ptr)
+    context->local_permissions_cache = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  else if (
+      context->local_permissions_cache_epoch != epoch
+      || sc_hash_table_size(context->local_permissions_cache) >= SC_CONTEXT_LOCAL_PERMISSIONS_CACHE_MAX_SIZE)
+    sc_hash_table_remove_all(context->local_permissions_cache);
+
+  context->local_permissions_cache_epoch = epoch;
+  sc_hash_table_insert(context->local_permissions_cache, cache_key, GINT_TO_POINTER(result));
+  sc_monitor_release_write(&context->local_permissions_cache_monitor);
+}
+
 sc_result _sc_memory_context_check_local_permissions(
     sc_memory_context_manager * manager,
     sc_memory_context const * ctx,
@@ -1305,13 +1581,23 @@ sc_result _sc_memory_context_check_local_permissions(
   if (_sc_memory_context_check_system(manager, ctx))
     return SC_RESULT_OK;
 
-  sc_result result = SC_RESULT_UNKNOWN;
+  // the version is got before checking, so results of checks that overlap with changes of permissions are not reused
+  sc_uint32 const epoch = sc_storage_get_local_permissions_epoch();
+  sc_pointer const cache_key = _sc_context_local_permissions_cache_key(element_addr, action_class_permissions);
+  sc_result result = _sc_memory_context_get_cached_local_permissions(ctx, cache_key, epoch);
+  if (result != SC_RESULT_ERROR)
+    return result;
+
+  result = SC_RESULT_UNKNOWN;
 
-  sc_monitor_acquire_read((sc_monitor *)&ctx->monitor);
-  sc_hash_table * permissions_table = ctx->local_permissions;
+  _sc_context_start_reading_local_permissions();
 
+  sc_hash_table * permissions_table = _sc_context_get_context_local_permissions(ctx);
   if (permissions_table == null_ptr)
-    goto result;
+  {
+    _sc_context_end_reading_local_permissions();
+    return result;
+  }
 
   sc_iterator3 * it3 = sc_iterator3_a_a_f_new(
       s_memory_default_ctx, sc_type_node | sc_type_const | sc_type_node_struct, sc_type_arc_pos_const, element_addr);
@@ -1327,8 +1613,9 @@ sc_result _sc_memory_context_check_local_permissions(
   }
   sc_iterator3_free(it3);
 
-result:
-  sc_monitor_release_read((sc_monitor *)&ctx->monitor);
+  _sc_context_end_reading_local_permissions();
+
+  _sc_memory_context_cache_local_permissions(ctx, cache_key, epoch, result);
 
   return result;
 }
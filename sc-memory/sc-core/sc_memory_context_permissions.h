@@ -32,6 +32,8 @@
     if (_element != null_ptr) \
       _element->flags.states |= _permissions; \
     sc_monitor_release_write(_monitor); \
+    if (((_permissions) & SC_CONTEXT_PERMITTED_STRUCTURE) == SC_CONTEXT_PERMITTED_STRUCTURE) \
+      sc_storage_invalidate_local_permissions(); \
   })
 
 //! Gets permissions of a specific sc-memory element.
@@ -56,14 +58,35 @@
     permissions; \
   })
 
-#define _sc_context_get_user_local_permissions(_user_addr) \
-  ({ \
-    sc_monitor_acquire_read(&manager->user_local_permissions_monitor); \
-    sc_hash_table * permissions = \
-        sc_hash_table_get(manager->user_local_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr))); \
-    sc_monitor_release_read(&manager->user_local_permissions_monitor); \
-    permissions; \
-  })
+/*! Function that gets local permissions of a user shared by all sc-memory contexts of the user and binds a new
+ * sc-memory context to them.
+ * @param manager Pointer to the sc-memory context manager.
+ * @param user_addr sc-address of the user.
+ * @returns Returns a pointer to local permissions of the user.
+ */
+sc_user_local_permissions * _sc_context_resolve_user_local_permissions(
+    sc_memory_context_manager * manager,
+    sc_addr user_addr);
+
+/*! Function that unbinds a sc-memory context from local permissions of its user. Local permissions of a user that has
+ * neither sc-memory contexts nor local permissions are destroyed when all checks that could read them end.
+ * @param manager Pointer to the sc-memory context manager.
+ * @param user_local_permissions Pointer to local permissions of the user.
+ */
+void _sc_context_release_user_local_permissions(
+    sc_memory_context_manager * manager,
+    sc_user_local_permissions * user_local_permissions);
+
+/*! Function that destroys local permissions of a user.
+ * @param user_local_permissions Pointer to local permissions of the user.
+ */
+void _sc_context_destroy_user_local_permissions(sc_user_local_permissions * user_local_permissions);
+
+/*! Function that destroys all retired local permissions regardless of checks reading them.
+ * @param manager Pointer to the sc-memory context manager.
+ * @note It is called on shutdown of the sc-memory context manager, when there are no checks of permissions.
+ */
+void _sc_context_destroy_all_retired_local_permissions(sc_memory_context_manager * manager);
 
 sc_addr _sc_memory_context_manager_generate_guest_user(sc_memory_context_manager * manager);
 
@@ -120,6 +143,15 @@ sc_bool _sc_memory_context_check_if_has_permitted_structure(
     sc_permissions action_class_permissions,
     sc_addr element_addr);
 
+/*! Function that checks if a memory context has local permissions for any sc-structure.
+ * @param manager Pointer to the sc-memory context manager.
+ * @param ctx Pointer to the sc-memory context in which the check is performed.
+ * @returns Returns SC_TRUE if permissions of the context can depend on sc-elements, otherwise SC_FALSE.
+ * @note If this function returns SC_FALSE, then checking of local and global permissions for any sc-element is
+ * equal to checking of global permissions only. It is used to check permissions once for batches of sc-elements.
+ */
+sc_bool _sc_memory_context_has_local_permissions(sc_memory_context_manager * manager, sc_memory_context const * ctx);
+
 /*! Function that checks local permissions for a given element within a specific memory context.
  * @param manager Pointer to the sc-memory context manager.
  * @param ctx Pointer to the sc-memory context in which the check is performed.
@@ -9,6 +9,7 @@
 
 #include "sc-store/sc_types.h"
 #include "sc-store/sc-base/sc_monitor.h"
+#include "sc-store/sc-event/sc_event_queue.h"
 
 /*! Structure representing a memory context manager.
  * @note This structure manages memory contexts and user authentications in the sc-memory.
@@ -42,6 +43,10 @@ struct _sc_memory_context_manager
   sc_hash_table * user_local_permissions;
   ///< Monitor for synchronizing access to the hash table storing local permissions within sc-structures.
   sc_monitor user_local_permissions_monitor;
+  ///< List of replaced snapshots of users local permissions and local permissions of users which have neither sc-memory
+  ///< contexts nor local permissions. They may be read by concurrent checks of permissions, so they are destroyed when
+  ///< all checks that could read them end.
+  sc_hash_table_list * retired_local_permissions;
   sc_event_subscription * on_new_user_action_class_within_sc_structure;
   sc_event_subscription * on_new_users_set_action_class_within_sc_structure;
   sc_event_subscription * on_remove_user_action_class_within_sc_structure;
@@ -70,6 +75,34 @@ struct _sc_memory_context_manager
   sc_bool user_mode;  ///< Boolean indicating whether the system is in user mode (SC_TRUE) or not (SC_FALSE).
 };
 
+/*! Structure representing local permissions (within sc-structures) of a user.
+ * @note It is shared by all sc-memory contexts of the user, so changes of local permissions of the user are seen by
+ * all of them. Local permissions are an immutable snapshot. Its changed copy replaces it atomically, so checks of
+ * permissions only load a pointer to the current snapshot.
+ */
+struct _sc_user_local_permissions
+{
+  sc_addr user_addr;            ///< sc-address of the user.
+  sc_hash_table * permissions;  ///< Current snapshot of local permissions by sc-structures. It is null if the user
+                                ///< has never had local permissions.
+  sc_uint32 ref_count;          ///< Number of sc-memory contexts of the user.
+};
+
+/*! Structure representing parameters for emitting a sc-event.
+ * @note This structure holds the parameters required for emitting a sc-event in a memory context.
+ */
+struct _sc_event_emit_params
+{
+  sc_addr subscription_addr;            ///< sc-address representing the subscription associated with the event.
+  sc_event_type event_type_addr;        ///< Type of the event to be emitted.
+  sc_addr connector_addr;               ///< sc-address representing the connector associated with the event.
+  sc_type connector_type;               ///< sc-type of the connector associated with the event.
+  sc_addr other_addr;                   ///< sc-address representing the other element associated with the event.
+  sc_event_do_after_callback callback;  ///< A pointer to function that is executed after the event is processed.
+  sc_addr event_addr;                   ///< An argument of callback.
+  sc_bool is_cancelled;                 ///< Boolean indicating whether the event was cancelled within pending block.
+};
+
 /*! Structure representing a memory context.
  * @note This structure represents a memory context associated with a specific user in the sc-memory.
  */
@@ -77,11 +110,23 @@ struct _sc_memory_context
 {
   sc_addr user_addr;                  ///< sc-address representing the user associated with the sc-memory context.
   sc_uint32 ref_count;                ///< Reference count to manage the number of references to the sc-memory context.
-  sc_permissions global_permissions;  ///< Global permissions within the knowledge base.
-  sc_hash_table * local_permissions;  ///< Local permissions within sc-structures.
+  sc_uint32 global_permissions;       ///< Global permissions within the knowledge base. They are changed atomically.
+  struct _sc_user_local_permissions * local_permissions;  ///< Local permissions within sc-structures shared by all
+                                                         ///< sc-memory contexts of the user.
   sc_uint8 flags;                     ///< Flags indicating the state of the sc-memory context.
-  sc_hash_table_list * pend_events;   ///< List of pending events to be emitted in the sc-memory context.
+  sc_hash_table_list * pend_events;   ///< List of pending events to be emitted in the sc-memory context (in reverse
+                                      ///< order).
+  sc_hash_table * pend_events_table;  ///< Table of pending events by their keys (subscription sc-element, event type,
+                                      ///< sc-connector). It is used only if pending events are coalesced.
+  sc_hash_table * pend_erased_elements;  ///< Table of sc-elements erased within pending events block. It is used only
+                                         ///< if pending events are coalesced.
+  sc_hash_table * pend_elements_events;  ///< Table of lists of pending events (except erase events) by their
+                                         ///< subscription sc-elements. It is used only if pending events are coalesced.
   sc_monitor monitor;                 ///< Monitor for synchronizing access to the sc-memory context.
+  sc_hash_table * local_permissions_cache;  ///< Cache of local permissions checks results by checked sc-elements and
+                                            ///< permissions. It is valid only for `local_permissions_cache_epoch`.
+  sc_uint32 local_permissions_cache_epoch;  ///< Version of local permissions for which the cache is filled.
+  sc_monitor local_permissions_cache_monitor;  ///< Monitor for synchronizing access to the local permissions cache.
 };
 
 /*!
@@ -19,6 +19,8 @@ void sc_memory_params_clear(sc_memory_params * params)
   params->max_loaded_segments = DEFAULT_MAX_LOADED_SEGMENTS;
   params->limit_max_threads_by_max_physical_cores = DEFAULT_LIMIT_MAX_THREADS_BY_MAX_PHYSICAL_CORES;
   params->max_events_and_agents_threads = DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS;
+  params->max_events_queue_size = DEFAULT_MAX_EVENTS_QUEUE_SIZE;
+  params->events_queue_overflow_mode = DEFAULT_EVENTS_QUEUE_OVERFLOW_MODE;
 
   params->dump_memory = SC_TRUE;
   params->save_period = params->dump_memory_period = DEFAULT_DUMP_MEMORY_PERIOD;  // seconds
@@ -14,6 +14,8 @@
 #define DEFAULT_LIMIT_MAX_THREADS_BY_MAX_PHYSICAL_CORES SC_TRUE
 #define DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS 32
 #define DEFAULT_MIN_EVENTS_AND_AGENTS_THREADS 1
+#define DEFAULT_MAX_EVENTS_QUEUE_SIZE 0
+#define DEFAULT_EVENTS_QUEUE_OVERFLOW_MODE SC_EVENTS_QUEUE_OVERFLOW_BLOCK
 #define DEFAULT_DUMP_MEMORY SC_TRUE
 #define DEFAULT_DUMP_MEMORY_PERIOD 32000
 #define DEFAULT_DUMP_MEMORY_STATISTICS SC_TRUE
@@ -27,6 +29,14 @@
 #define DEFAULT_TERM_SEPARATORS " _"
 #define DEFAULT_SEARCH_BY_SUBSTRING SC_TRUE
 
+/*! Enumeration of modes of handling sc-events when the sc-events queue is full.
+ */
+typedef enum
+{
+  SC_EVENTS_QUEUE_OVERFLOW_BLOCK,  ///< Emitters of sc-events wait until the queue has free space.
+  SC_EVENTS_QUEUE_OVERFLOW_DROP,   ///< New sc-events are dropped and counted.
+} sc_events_queue_overflow_mode;
+
 /*! Structure representing parameters for configuring the sc-memory.
  * @note This structure holds various configuration parameters that control the behavior of the sc-memory.
  */
@@ -45,6 +55,9 @@ typedef struct
   ///< Boolean indicating whether sc-memory limit `max_events_and_agents_threads` by maximum physical core number.
   sc_bool limit_max_threads_by_max_physical_cores;
   sc_uint32 max_events_and_agents_threads;  ///< Maximum number of threads for events and agents processing.
+  ///< Maximum number of sc-events waiting for processing. By default, it is 0 and the queue is unbounded.
+  sc_uint32 max_events_queue_size;
+  sc_events_queue_overflow_mode events_queue_overflow_mode;  ///< Mode of handling sc-events when the queue is full.
 
   sc_uint32 save_period;    ///< Period (in seconds) for automatic saving of sc-memory state (deprecated in 0.9.0).
   sc_uint32 update_period;  ///< Period (in seconds) for dumping statistics of sc-memory state (deprecated in 0.9.0).
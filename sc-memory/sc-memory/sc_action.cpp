@@ -16,6 +16,7 @@ ScAction::ScAction(ScAgentContext * context, ScAddr const & actionAddr) noexcept
   , m_context(context)
   , m_resultAddr(ScAddr::Empty)
   , m_actionClassAddr(ScAddr::Empty)
+  , m_isSuspended(false)
 {
 }
 
@@ -170,15 +171,105 @@ bool ScAction::InitiateAndWait(sc_uint32 maxCustomerWaitingTime) noexcept(false)
         "Not able to initiate and wait action " << GetActionPrettyString() << GetActionClassPrettyString()
                                                 << " because it had already been finished.");
 
-  auto wait = std::shared_ptr<ScWaiterActionFinished>(new ScWaiterActionFinished(*m_context, *this));
-  wait->SetOnWaitStartDelegate(
-      [this, &maxCustomerWaitingTime]()
+  sc_uint64 waiterId;
+  std::future<bool> future = ScActionFinishedDispatcher::Register(*this, maxCustomerWaitingTime, waiterId);
+  InitiateWithWaiter(maxCustomerWaitingTime, waiterId);
+  if (future.wait_for(std::chrono::milliseconds(maxCustomerWaitingTime)) == std::future_status::ready)
+    return future.get();
+
+  ScActionFinishedDispatcher::Unregister(*this, waiterId);
+  return false;
+}
+
+std::future<bool> ScAction::InitiateAsync(sc_uint32 maxCustomerWaitingTime) noexcept(false)
+{
+  if (IsInitiated())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to initiate action " << GetActionPrettyString() << GetActionClassPrettyString()
+                                       << " asynchronously because it had already been initiated.");
+
+  if (IsFinished())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to initiate action " << GetActionPrettyString() << GetActionClassPrettyString()
+                                       << " asynchronously because it had already been finished.");
+
+  sc_uint64 waiterId;
+  std::future<bool> future = ScActionFinishedDispatcher::Register(*this, maxCustomerWaitingTime, waiterId);
+  InitiateWithWaiter(maxCustomerWaitingTime, waiterId);
+  return future;
+}
+
+ScAction & ScAction::InitiateAndThen(
+    ContinuationFunc const & continuation,
+    sc_uint32 maxCustomerWaitingTime) noexcept(false)
+{
+  if (IsInitiated())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to initiate action " << GetActionPrettyString() << GetActionClassPrettyString()
+                                       << " with continuation because it had already been initiated.");
+
+  if (IsFinished())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to initiate action " << GetActionPrettyString() << GetActionClassPrettyString()
+                                       << " with continuation because it had already been finished.");
+
+  // Context of this action may be destroyed before the action is finished, so continuation gets its own context.
+  ScAddr const actionAddr = *this;
+  ScAddr const userAddr = m_context->GetUser();
+  sc_uint64 const waiterId = ScActionFinishedDispatcher::Register(
+      actionAddr,
+      maxCustomerWaitingTime,
+      [actionAddr, userAddr, continuation](bool)
       {
-        if (!m_context->IsElement(GetMaxCustomerWaitingTimeLink()))
-          GenerateMaxCustomerWaitingTime(maxCustomerWaitingTime);
-        m_context->GenerateConnector(ScType::EdgeAccessConstPosPerm, ScKeynodes::action_initiated, *this);
+        ScAgentContext context{userAddr};
+        ScAction action = context.ConvertToAction(actionAddr);
+        continuation(context, action);
       });
-  return wait->Wait(maxCustomerWaitingTime);
+  InitiateWithWaiter(maxCustomerWaitingTime, waiterId);
+  return *this;
+}
+
+ScResult ScAction::Suspend() noexcept(false)
+{
+  if (!IsInitiated())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to suspend action " << GetActionPrettyString() << GetActionClassPrettyString()
+                                      << " because it had not been initiated yet.");
+
+  if (IsFinished())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to suspend action " << GetActionPrettyString() << GetActionClassPrettyString()
+                                      << " because it had already been finished.");
+
+  m_isSuspended = true;
+  return SC_RESULT_OK;
+}
+
+bool ScAction::IsSuspended() const noexcept
+{
+  return m_isSuspended;
+}
+
+void ScAction::InitiateWithWaiter(sc_uint32 maxCustomerWaitingTime, sc_uint64 waiterId)
+{
+  // Waiter is registered before the action is initiated, so finish of the action can't be missed.
+  try
+  {
+    if (!m_context->IsElement(GetMaxCustomerWaitingTimeLink()))
+      GenerateMaxCustomerWaitingTime(maxCustomerWaitingTime);
+    m_context->GenerateConnector(ScType::EdgeAccessConstPosPerm, ScKeynodes::action_initiated, *this);
+  }
+  catch (...)
+  {
+    ScActionFinishedDispatcher::Unregister(*this, waiterId);
+    throw;
+  }
 }
 
 ScAction & ScAction::Initiate() noexcept(false)
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <functional>
+#include <future>
 #include <string>
 #include <utility>
 
@@ -26,6 +28,8 @@ class _SC_EXTERN ScAction final : public ScAddr
   friend class ScAgentBuilder;
 
 public:
+  using ContinuationFunc = std::function<void(class ScAgentContext & context, ScAction & action)>;
+
   /*!
    * @brief Gets class of the action.
    *
@@ -137,6 +141,63 @@ public:
    */
   _SC_EXTERN bool InitiateAndWait(sc_uint32 maxCustomerWaitingTime = 5000u) noexcept(false);
 
+  /*!
+   * @brief Initiates the action and returns a future of its finish without blocking the calling thread.
+   * @param maxCustomerWaitingTime Wait time (in milliseconds) of action being finished. By default, it
+   * equals to 5000 milliseconds.
+   *
+   * This method adds max customer waiting time in millisecond to knowledge base if action does not have max customer
+   * waiting time in milliseconds. The returned future is resolved with true when the action is finished. It is
+   * resolved with false if the action is not finished in max customer waiting time.
+   *
+   * @code
+   * std::future<bool> future = action.InitiateAsync(1000u);
+   * // ...
+   * if (future.wait_for(std::chrono::milliseconds(1000u)) == std::future_status::ready && future.get())
+   *   // The action is finished.
+   * @endcode
+   *
+   * @return A future resolved with true if the action has been finished, otherwise false.
+   * @throws utils::ExceptionInvalidState if the action is already initiated or finished.
+   */
+  _SC_EXTERN std::future<bool> InitiateAsync(sc_uint32 maxCustomerWaitingTime = 5000u) noexcept(false);
+
+  /*!
+   * @brief Initiates the action and calls continuation when it is finished.
+   * @param continuation A function to call when the action is finished or max customer waiting time is expired. It
+   * gets the action converted in a new agent context with the same user, so it may be called after the context of
+   * this object has been destroyed. Use `IsFinished` to check whether the action has been finished in time.
+   * @param maxCustomerWaitingTime Wait time (in milliseconds) of action being finished. By default, it
+   * equals to 5000 milliseconds.
+   *
+   * Unlike `InitiateAndWait`, this method does not block the calling thread. Together with `Suspend` it allows agents
+   * to perform sub-actions without occupying a thread of sc-events processing while sub-actions are performed.
+   *
+   * @code
+   * ScResult MyAgent::DoProgram(ScAction & action)
+   * {
+   *   ScAddr const & actionAddr = action;
+   *   m_context.GenerateAction(MyKeynodes::my_sub_action_class)
+   *       .InitiateAndThen(
+   *           [actionAddr](ScAgentContext & context, ScAction & subAction)
+   *           {
+   *             ScAction action = context.ConvertToAction(actionAddr);
+   *             if (subAction.IsFinishedSuccessfully())
+   *               action.FinishSuccessfully();
+   *             else
+   *               action.FinishUnsuccessfully();
+   *           });
+   *   return action.Suspend();
+   * }
+   * @endcode
+   *
+   * @return Reference to the current ScAction object.
+   * @throws utils::ExceptionInvalidState if the action is already initiated or finished.
+   */
+  _SC_EXTERN ScAction & InitiateAndThen(
+      ContinuationFunc const & continuation,
+      sc_uint32 maxCustomerWaitingTime = 5000u) noexcept(false);
+
   /*!
    * @brief Gets sc-link with max customer waiting time of an action in milliseconds.
    * @return ScAddr of sc-link containing max customer waiting time in milliseconds if found, empty ScAddr otherwise.
@@ -201,10 +262,29 @@ public:
    */
   _SC_EXTERN ScResult FinishWithError() noexcept(false);
 
+  /*!
+   * @brief Leaves the action not finished after agent program returns.
+   *
+   * Call this method for the action passed to `DoProgram` and return its result if the action will be finished
+   * later, for example, in continuation of `InitiateAndThen`. The agent releases its thread and result condition of
+   * the agent is not checked.
+   *
+   * @return Result of the operation.
+   * @throws utils::ExceptionInvalidState if the action is not initiated or already finished.
+   */
+  _SC_EXTERN ScResult Suspend() noexcept(false);
+
+  /*!
+   * @brief Checks if the action is suspended by `Suspend`.
+   * @return True if the action is suspended, false otherwise.
+   */
+  _SC_EXTERN bool IsSuspended() const noexcept;
+
 protected:
   class ScAgentContext * m_context;  ///< Context of the agent.
   ScAddr m_resultAddr;               ///< Result structure of the action.
   mutable ScAddr m_actionClassAddr;  ///< Class of the action.
+  bool m_isSuspended;                ///< Whether the action is left not finished after agent program returns.
 
   /*!
    * @brief Constructor for ScAction.
@@ -280,6 +360,13 @@ private:
    * @param maxCustomerWaitingTime Time in milliseconds that customer will wait for this action to finish.
    */
   void GenerateMaxCustomerWaitingTime(sc_uint32 maxCustomerWaitingTime) const;
+
+  /*!
+   * @brief Initiates the action after its waiter has been registered.
+   * @param maxCustomerWaitingTime Wait time (in milliseconds) of action being finished.
+   * @param waiterId Identifier of the registered waiter. It is unregistered if the action can't be initiated.
+   */
+  void InitiateWithWaiter(sc_uint32 maxCustomerWaitingTime, sc_uint64 waiterId);
 };
 
 #include "sc_action.tpp"
@@ -9,6 +9,7 @@
 #include <algorithm>
 
 #include "sc_event_subscription.hpp"
+#include "sc_template_subscription.hpp"
 
 #include "sc_action.hpp"
 #include "sc_keynodes.hpp"
@@ -87,6 +88,15 @@ std::shared_ptr<ScWaiter> ScAgentContext::CreateConditionWaiter(
   return CreateConditionWaiter(eventClassAddr, subscriptionElementAddr, {}, checkCallback);
 }
 
+std::shared_ptr<ScTemplateSubscription> ScAgentContext::CreateTemplateSubscription(
+    ScTemplate && templateToWatch,
+    std::function<void(ScTemplateResultItem const &)> const & onConstructionGenerated,
+    std::function<void(ScTemplateResultItem const &)> const & onConstructionErased) noexcept(false)
+{
+  return std::shared_ptr<ScTemplateSubscription>(
+      new ScTemplateSubscription(*this, std::move(templateToWatch), onConstructionGenerated, onConstructionErased));
+}
+
 ScAction ScAgentContext::GenerateAction(ScAddr const & actionClassAddr) noexcept(false)
 {
   if (!IsElement(actionClassAddr))
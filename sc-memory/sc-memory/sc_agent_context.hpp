@@ -17,6 +17,7 @@ class ScEventSubscription;
 template <class TScEvent>
 class ScElementaryEventSubscription;
 class ScWaiter;
+class ScTemplateSubscription;
 class ScActionInitiatedAgent;
 
 /*!
@@ -209,6 +210,37 @@ public:
       ScAddr const & subscriptionElementAddr,
       std::function<bool(TScEvent const &)> const & checkCallback) noexcept(false);
 
+  /*!
+   * @brief Generates subscription that keeps sc-constructions found by sc-template up to date.
+   *
+   * Sc-constructions are searched by sc-template once, after that they are updated by sc-events of generation and
+   * erasure of sc-connectors incident to sc-elements fixed in sc-template. Callbacks aren't called for sc-constructions
+   * found when subscription is generated.
+   *
+   * @param templateToWatch An object of `ScTemplate` to search sc-constructions by it. Each triple of it must have
+   * fixed source or target sc-element.
+   * @param onConstructionGenerated A callback function that will be called when new sc-construction is found.
+   * @param onConstructionErased An optional callback function that will be called when found sc-construction is
+   * erased.
+   * @return A shared pointer to generated `ScTemplateSubscription`.
+   * @throws utils::ExceptionInvalidParams If sc-template has triple without fixed source and target sc-elements.
+   *
+   * @code
+   * ScTemplate templ;
+   * templ.Triple(setAddr, ScType::EdgeAccessVarPosPerm, ScType::NodeVar >> "_element");
+   * auto const subscription = context.CreateTemplateSubscription(
+   *     std::move(templ),
+   *     [](ScTemplateResultItem const & item)
+   *     {
+   *       // `item["_element"]` was added to set
+   *     });
+   * @endcode
+   */
+  _SC_EXTERN std::shared_ptr<ScTemplateSubscription> CreateTemplateSubscription(
+      ScTemplate && templateToWatch,
+      std::function<void(ScTemplateResultItem const &)> const & onConstructionGenerated,
+      std::function<void(ScTemplateResultItem const &)> const & onConstructionErased = {}) noexcept(false);
+
   /*!
    * @brief Subscribes agent class to specified sc-events.
    * @tparam TScAgent An agent class to be subscribed to the event.
@@ -421,6 +421,12 @@ std::function<void(typename TScAgent::TEventType const &)> ScAgentManager<TScAge
       return PostCallback();
     }
 
+    if (action.IsSuspended())
+    {
+      SC_LOG_INFO("Agent `" << agentName << "` suspended performing action.");
+      return PostCallback();
+    }
+
     if (result == SC_RESULT_OK)
       SC_LOG_INFO("Agent `" << agentName << "` finished performing action successfully.");
     else if (result == SC_RESULT_NO)
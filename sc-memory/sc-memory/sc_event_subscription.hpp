@@ -18,6 +18,13 @@
 class _SC_EXTERN ScEventSubscription : public ScObject
 {
 public:
+  struct ScEventSubscriptionStatistics
+  {
+    sc_uint64 m_processedEventsCount;  ///< Amount of processed sc-events.
+    sc_uint64 m_eventsWaitTime;        ///< Total time (in microseconds) sc-events waited in the queue.
+    sc_uint64 m_eventsRunTime;         ///< Total time (in microseconds) of sc-events processing.
+  };
+
   _SC_EXTERN ~ScEventSubscription() noexcept override;
 
   _SC_EXTERN virtual void RemoveDelegate() noexcept = 0;
@@ -37,6 +44,8 @@ class _SC_EXTERN ScElementaryEventSubscription final : public ScEventSubscriptio
   template <class TScAgent>
   friend class ScAgentManager;
   friend class ScMemoryJsonEventsHandler;
+  friend class ScActionFinishedDispatcher;
+  friend class ScTemplateSubscription;
 
   SC_DISALLOW_COPY_AND_MOVE(ScElementaryEventSubscription);
 
@@ -50,6 +59,21 @@ public:
 
   _SC_EXTERN void RemoveDelegate() noexcept override;
 
+  /*!
+   * @brief Sets ordered delivery of sc-events for this subscription.
+   * @param isOrderedDelivery If it is true, then sc-events of this subscription are processed one by one in order of
+   * their emission together with sc-events of other subscriptions with ordered delivery of the same subscription
+   * sc-element, so the delegate is never called concurrently. Sc-events of other sc-elements are still processed in
+   * parallel.
+   */
+  _SC_EXTERN void SetOrderedDelivery(bool isOrderedDelivery) noexcept;
+
+  /*!
+   * @brief Gets statistics of sc-events processing by this subscription.
+   * @return Amount of processed sc-events and their total wait and run times.
+   */
+  _SC_EXTERN ScEventSubscriptionStatistics GetStatistics() const noexcept;
+
 protected:
   explicit _SC_EXTERN ScElementaryEventSubscription(
       ScMemoryContext const & context,
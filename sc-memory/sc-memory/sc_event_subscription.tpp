@@ -62,6 +62,28 @@ void ScElementaryEventSubscription<TScEvent>::RemoveDelegate() noexcept
   m_delegate = DelegateFunc();
 }
 
+template <class TScEvent>
+void ScElementaryEventSubscription<TScEvent>::SetOrderedDelivery(bool isOrderedDelivery) noexcept
+{
+  if (m_event_subscription)
+    sc_event_subscription_set_ordered_delivery(m_event_subscription, isOrderedDelivery);
+}
+
+template <class TScEvent>
+ScEventSubscription::ScEventSubscriptionStatistics ScElementaryEventSubscription<TScEvent>::GetStatistics()
+    const noexcept
+{
+  sc_event_subscription_stat stat{};
+  if (m_event_subscription)
+    sc_event_subscription_get_stat(m_event_subscription, &stat);
+
+  ScEventSubscriptionStatistics statistics{};
+  statistics.m_processedEventsCount = stat.processed_events_count;
+  statistics.m_eventsWaitTime = stat.events_wait_time;
+  statistics.m_eventsRunTime = stat.events_run_time;
+  return statistics;
+}
+
 template <class TScEvent>
 sc_result ScElementaryEventSubscription<TScEvent>::Handle(
     sc_event_subscription const * event_subscription,
@@ -6,6 +6,8 @@
 
 #include "sc_event_wait.hpp"
 
+#include "sc_memory.hpp"
+
 ScWaiter::Impl::Impl() noexcept = default;
 ScWaiter::Impl::~Impl() noexcept = default;
 
@@ -79,3 +81,199 @@ bool ScWaiterActionFinished::OnEvent(ScEventAfterGenerateIncomingArc<ScType::Edg
 {
   return event.GetArcSourceElement() == ScKeynodes::action_finished;
 }
+
+std::mutex ScActionFinishedDispatcher::ms_mutex;
+std::condition_variable ScActionFinishedDispatcher::ms_condition;
+std::thread ScActionFinishedDispatcher::ms_expirationThread;
+bool ScActionFinishedDispatcher::ms_isShutDown = false;
+std::unique_ptr<ScElementaryEventSubscription<ScActionFinishedDispatcher::EventType>>
+    ScActionFinishedDispatcher::ms_subscription;
+ScAddrToValueUnorderedMap<ScActionFinishedDispatcher::Waiters> ScActionFinishedDispatcher::ms_waiters;
+ScActionFinishedDispatcher::Clock::time_point ScActionFinishedDispatcher::ms_earliestDeadline =
+    ScActionFinishedDispatcher::Clock::time_point::max();
+sc_uint64 ScActionFinishedDispatcher::ms_lastWaiterId = 0;
+
+sc_uint64 ScActionFinishedDispatcher::Register(
+    ScAddr const & actionAddr,
+    sc_uint32 timeout_ms,
+    CallbackFunc const & callback)
+{
+  std::lock_guard<std::mutex> lock(ms_mutex);
+
+  // Waiters registered during shutdown are resolved as unfinished by it, so subscription isn't created again.
+  if (ms_subscription == nullptr && !ms_isShutDown)
+  {
+    ms_subscription.reset(new ScElementaryEventSubscription<EventType>(
+        *ScMemory::ms_globalContext, ScKeynodes::action_finished, &ScActionFinishedDispatcher::OnActionFinished));
+    ms_expirationThread = std::thread(&ScActionFinishedDispatcher::ExpireWaiters);
+  }
+
+  Clock::time_point const deadline = Clock::now() + std::chrono::milliseconds(timeout_ms);
+  if (deadline < ms_earliestDeadline)
+  {
+    ms_earliestDeadline = deadline;
+    ms_condition.notify_one();
+  }
+
+  sc_uint64 const waiterId = ++ms_lastWaiterId;
+  ms_waiters[actionAddr].push_back({waiterId, callback, deadline});
+  return waiterId;
+}
+
+std::future<bool> ScActionFinishedDispatcher::Register(
+    ScAddr const & actionAddr,
+    sc_uint32 timeout_ms,
+    sc_uint64 & waiterId)
+{
+  auto promise = std::make_shared<std::promise<bool>>();
+  waiterId = Register(
+      actionAddr,
+      timeout_ms,
+      [promise](bool isFinished)
+      {
+        promise->set_value(isFinished);
+      });
+  return promise->get_future();
+}
+
+void ScActionFinishedDispatcher::Unregister(ScAddr const & actionAddr, sc_uint64 waiterId)
+{
+  std::lock_guard<std::mutex> lock(ms_mutex);
+
+  auto const it = ms_waiters.find(actionAddr);
+  if (it == ms_waiters.cend())
+    return;
+
+  Waiters & waiters = it->second;
+  waiters.remove_if(
+      [waiterId](Waiter const & waiter)
+      {
+        return waiter.m_id == waiterId;
+      });
+  if (waiters.empty())
+    ms_waiters.erase(it);
+}
+
+void ScActionFinishedDispatcher::Resolve(ScAddr const & actionAddr, bool isFinished)
+{
+  Waiters waiters;
+  {
+    std::lock_guard<std::mutex> lock(ms_mutex);
+
+    auto const it = ms_waiters.find(actionAddr);
+    if (it == ms_waiters.cend())
+      return;
+
+    waiters = std::move(it->second);
+    ms_waiters.erase(it);
+  }
+
+  CallCallbacks(waiters, isFinished);
+}
+
+void ScActionFinishedDispatcher::Shutdown()
+{
+  std::unique_ptr<ScElementaryEventSubscription<EventType>> subscription;
+  std::thread expirationThread;
+  {
+    std::lock_guard<std::mutex> lock(ms_mutex);
+    subscription = std::move(ms_subscription);
+    expirationThread = std::move(ms_expirationThread);
+    ms_isShutDown = true;
+    ms_condition.notify_one();
+  }
+
+  if (expirationThread.joinable())
+    expirationThread.join();
+
+  // Subscription is destroyed out of the lock, because its delegate can wait for the lock.
+  subscription.reset();
+
+  ScAddrToValueUnorderedMap<Waiters> waiters;
+  {
+    std::lock_guard<std::mutex> lock(ms_mutex);
+    waiters = std::move(ms_waiters);
+    ms_waiters.clear();
+    ms_earliestDeadline = Clock::time_point::max();
+    ms_isShutDown = false;
+  }
+
+  for (auto & [_, actionWaiters] : waiters)
+    CallCallbacks(actionWaiters, false);
+}
+
+void ScActionFinishedDispatcher::OnActionFinished(EventType const & event)
+{
+  Resolve(event.GetArcTargetElement(), true);
+}
+
+void ScActionFinishedDispatcher::ExpireWaiters()
+{
+  std::unique_lock<std::mutex> lock(ms_mutex);
+  while (!ms_isShutDown)
+  {
+    if (ms_earliestDeadline == Clock::time_point::max())
+      ms_condition.wait(lock);
+    else
+      ms_condition.wait_until(lock, ms_earliestDeadline);
+
+    if (ms_isShutDown)
+      break;
+
+    Waiters waiters = ExtractExpiredWaiters(Clock::now());
+    if (waiters.empty())
+      continue;
+
+    lock.unlock();
+    CallCallbacks(waiters, false);
+    lock.lock();
+  }
+}
+
+ScActionFinishedDispatcher::Waiters ScActionFinishedDispatcher::ExtractExpiredWaiters(Clock::time_point const & now)
+{
+  Waiters expiredWaiters;
+  if (now < ms_earliestDeadline)
+    return expiredWaiters;
+
+  ms_earliestDeadline = Clock::time_point::max();
+  for (auto it = ms_waiters.begin(); it != ms_waiters.end();)
+  {
+    Waiters & waiters = it->second;
+    for (auto waiterIt = waiters.begin(); waiterIt != waiters.end();)
+    {
+      auto const nextWaiterIt = std::next(waiterIt);
+      if (waiterIt->m_deadline <= now)
+        expiredWaiters.splice(expiredWaiters.end(), waiters, waiterIt);
+      else if (waiterIt->m_deadline < ms_earliestDeadline)
+        ms_earliestDeadline = waiterIt->m_deadline;
+      waiterIt = nextWaiterIt;
+    }
+
+    if (waiters.empty())
+      it = ms_waiters.erase(it);
+    else
+      ++it;
+  }
+
+  return expiredWaiters;
+}
+
+void ScActionFinishedDispatcher::CallCallbacks(Waiters & waiters, bool isFinished)
+{
+  for (Waiter & waiter : waiters)
+  {
+    try
+    {
+      waiter.m_callback(isFinished);
+    }
+    catch (utils::ScException const & exception)
+    {
+      SC_LOG_ERROR("Not able to call callback of waited action, because error was occurred. " << exception.Message());
+    }
+    catch (std::exception const & exception)
+    {
+      SC_LOG_ERROR("Not able to call callback of waited action, because error was occurred. " << exception.what());
+    }
+  }
+}
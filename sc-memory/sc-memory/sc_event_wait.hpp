@@ -8,7 +8,11 @@
 
 #include <condition_variable>
 #include <chrono>
+#include <future>
+#include <list>
+#include <memory>
 #include <mutex>
+#include <thread>
 #include <utility>
 
 #include "sc_event_subscription.hpp"
@@ -183,4 +187,98 @@ private:
   bool OnEvent(ScEventAfterGenerateIncomingArc<ScType::EdgeAccessConstPosPerm> const & event) override;
 };
 
+/*!
+ * @class ScActionFinishedDispatcher
+ * @brief Routes finishes of actions to registered callbacks.
+ *
+ * The dispatcher holds a single sc-event subscription to generation of outgoing sc-arcs from `action_finished`
+ * and calls callbacks registered for finished actions. It is used instead of a separate `ScWaiterActionFinished`
+ * per waited action so that waiting for an action does not subscribe and unsubscribe sc-events each time.
+ * Callbacks of actions not finished in time are called with false from the expiration thread of the dispatcher.
+ *
+ * @note The subscription is created in the global sc-memory context, so finishes of actions are routed to waiters
+ * without checking read permissions of their callers. Waiters only get whether the action is finished; callers read
+ * the action and its result in their own contexts with their own permissions.
+ */
+class _SC_EXTERN ScActionFinishedDispatcher final
+{
+  friend class ScAction;
+  friend class ScMemory;
+
+  using EventType = ScEventAfterGenerateOutgoingArc<ScType::EdgeAccessConstPosPerm>;
+  using Clock = std::chrono::steady_clock;
+
+public:
+  using CallbackFunc = std::function<void(bool isFinished)>;
+
+private:
+  struct Waiter
+  {
+    sc_uint64 m_id;                ///< Identifier of the waiter used to unregister it.
+    CallbackFunc m_callback;       ///< Callback called with true when action is finished and false on expiration.
+    Clock::time_point m_deadline;  ///< Time after which the callback is called with false.
+  };
+
+  using Waiters = std::list<Waiter>;
+
+protected:
+  /*!
+   * @brief Registers callback for finish of the action.
+   * @param actionAddr An address of the action to wait.
+   * @param timeout_ms Time (in milliseconds) after which the callback is called with false.
+   * @param callback A callback to call when the action is finished or waiting time is expired.
+   * @return Identifier of the registered waiter used to unregister it.
+   */
+  static sc_uint64 Register(ScAddr const & actionAddr, sc_uint32 timeout_ms, CallbackFunc const & callback);
+
+  /*!
+   * @brief Registers promise for finish of the action.
+   * @param actionAddr An address of the action to wait.
+   * @param timeout_ms Time (in milliseconds) after which the promise is resolved with false.
+   * @param waiterId Identifier of the registered waiter used to unregister it.
+   * @return A future resolved with true when the action is finished.
+   */
+  static std::future<bool> Register(ScAddr const & actionAddr, sc_uint32 timeout_ms, sc_uint64 & waiterId);
+
+  /*!
+   * @brief Unregisters waiter of the action if its callback has not been called yet.
+   * @param actionAddr An address of the waited action.
+   * @param waiterId Identifier of the waiter returned by `Register`.
+   */
+  static void Unregister(ScAddr const & actionAddr, sc_uint64 waiterId);
+
+  /*!
+   * @brief Calls callbacks of all waiters of the action with the given value.
+   * @param actionAddr An address of the action.
+   * @param isFinished A value to call callbacks with.
+   */
+  static void Resolve(ScAddr const & actionAddr, bool isFinished);
+
+  /*!
+   * @brief Destroys the sc-event subscription, stops the expiration thread and calls all remaining callbacks with
+   * false.
+   */
+  static void Shutdown();
+
+private:
+  static void OnActionFinished(EventType const & event);
+
+  /// Expires waiters with reached deadlines until the dispatcher is shut down.
+  static void ExpireWaiters();
+
+  /// Extracts waiters with reached deadlines. Must be called under `ms_mutex`.
+  static Waiters ExtractExpiredWaiters(Clock::time_point const & now);
+
+  static void CallCallbacks(Waiters & waiters, bool isFinished);
+
+  static std::mutex ms_mutex;
+  static std::condition_variable ms_condition;
+  static std::thread ms_expirationThread;
+  static bool ms_isShutDown;
+  static std::unique_ptr<ScElementaryEventSubscription<EventType>> ms_subscription;
+  static ScAddrToValueUnorderedMap<Waiters> ms_waiters;
+  static Clock::time_point ms_earliestDeadline;
+  static sc_uint64 ms_lastWaiterId;
+};
+
 #include "sc_event_wait.tpp"
@@ -7,78 +7,112 @@
 #include "sc_iterator.hpp"
 #include "sc_memory.hpp"
 
+namespace
+{
+sc_iterator_param ToIteratorParam(sc_addr const & addr)
+{
+  sc_iterator_param param;
+  param.is_type = SC_FALSE;
+  param.addr = addr;
+  return param;
+}
+
+sc_iterator_param ToIteratorParam(sc_type const & type)
+{
+  sc_iterator_param param;
+  param.is_type = SC_TRUE;
+  param.type = type;
+  return param;
+}
+}  // namespace
+
 template <>
-sc_iterator3 * CreateIterator3<sc_addr, sc_type, sc_addr>(
+bool InitializeIterator3<sc_addr, sc_type, sc_addr>(
+    sc_iterator3 & iterator,
     ScMemoryContext const & context,
     sc_addr const & p1,
     sc_type const & p2,
     sc_addr const & p3)
 {
-  return sc_iterator3_f_a_f_new(*context, p1, p2, p3);
+  return sc_iterator3_init(
+      &iterator, *context, sc_iterator3_f_a_f, ToIteratorParam(p1), ToIteratorParam(p2), ToIteratorParam(p3));
 }
 
 template <>
-sc_iterator3 * CreateIterator3<sc_addr, sc_type, sc_type>(
+bool InitializeIterator3<sc_addr, sc_type, sc_type>(
+    sc_iterator3 & iterator,
     ScMemoryContext const & context,
     sc_addr const & p1,
     sc_type const & p2,
     sc_type const & p3)
 {
-  return sc_iterator3_f_a_a_new(*context, p1, p2, p3);
+  return sc_iterator3_init(
+      &iterator, *context, sc_iterator3_f_a_a, ToIteratorParam(p1), ToIteratorParam(p2), ToIteratorParam(p3));
 }
 
 template <>
-sc_iterator3 * CreateIterator3<sc_addr, sc_addr, sc_type>(
+bool InitializeIterator3<sc_addr, sc_addr, sc_type>(
+    sc_iterator3 & iterator,
     ScMemoryContext const & context,
     sc_addr const & p1,
     sc_addr const & p2,
     sc_type const & p3)
 {
-  return sc_iterator3_f_f_a_new(*context, p1, p2, p3);
+  return sc_iterator3_init(
+      &iterator, *context, sc_iterator3_f_f_a, ToIteratorParam(p1), ToIteratorParam(p2), ToIteratorParam(p3));
 }
 
 template <>
-sc_iterator3 * CreateIterator3<sc_type, sc_type, sc_addr>(
+bool InitializeIterator3<sc_type, sc_type, sc_addr>(
+    sc_iterator3 & iterator,
     ScMemoryContext const & context,
     sc_type const & p1,
     sc_type const & p2,
     sc_addr const & p3)
 {
-  return sc_iterator3_a_a_f_new(*context, p1, p2, p3);
+  return sc_iterator3_init(
+      &iterator, *context, sc_iterator3_a_a_f, ToIteratorParam(p1), ToIteratorParam(p2), ToIteratorParam(p3));
 }
 
 template <>
-sc_iterator3 * CreateIterator3<sc_type, sc_addr, sc_addr>(
+bool InitializeIterator3<sc_type, sc_addr, sc_addr>(
+    sc_iterator3 & iterator,
     ScMemoryContext const & context,
     sc_type const & p1,
     sc_addr const & p2,
     sc_addr const & p3)
 {
-  return sc_iterator3_a_f_f_new(*context, p1, p2, p3);
+  return sc_iterator3_init(
+      &iterator, *context, sc_iterator3_a_f_f, ToIteratorParam(p1), ToIteratorParam(p2), ToIteratorParam(p3));
 }
 
 template <>
-sc_iterator3 * CreateIterator3<sc_type, sc_addr, sc_type>(
+bool InitializeIterator3<sc_type, sc_addr, sc_type>(
+    sc_iterator3 & iterator,
     ScMemoryContext const & context,
     sc_type const & p1,
     sc_addr const & p2,
     sc_type const & p3)
 {
-  return sc_iterator3_a_f_a_new(*context, p1, p2, p3);
+  return sc_iterator3_init(
+      &iterator, *context, sc_iterator3_a_f_a, ToIteratorParam(p1), ToIteratorParam(p2), ToIteratorParam(p3));
 }
 
 template <>
-sc_iterator3 * CreateIterator3<sc_addr, sc_addr, sc_addr>(
+bool InitializeIterator3<sc_addr, sc_addr, sc_addr>(
+    sc_iterator3 & iterator,
     ScMemoryContext const & context,
     sc_addr const & p1,
     sc_addr const & p2,
     sc_addr const & p3)
 {
-  return sc_iterator3_f_f_f_new(*context, p1, p2, p3);
+  return sc_iterator3_init(
+      &iterator, *context, sc_iterator3_f_f_f, ToIteratorParam(p1), ToIteratorParam(p2), ToIteratorParam(p3));
 }
 
 template <>
-sc_iterator5 * CreateIterator5<sc_addr, sc_type, sc_type, sc_type, sc_type>(
+bool InitializeIterator5<sc_addr, sc_type, sc_type, sc_type, sc_type>(
+    sc_iterator5 & iterator,
     ScMemoryContext const & context,
     sc_addr const & p1,
     sc_type const & p2,
@@ -86,11 +120,20 @@ sc_iterator5 * CreateIterator5<sc_addr, sc_type, sc_type, sc_type, sc_type>(
     sc_type const & p4,
     sc_type const & p5)
 {
-  return sc_iterator5_f_a_a_a_a_new(*context, p1, p2, p3, p4, p5);
+  return sc_iterator5_init(
+      &iterator,
+      *context,
+      sc_iterator5_f_a_a_a_a,
+      ToIteratorParam(p1),
+      ToIteratorParam(p2),
+      ToIteratorParam(p3),
+      ToIteratorParam(p4),
+      ToIteratorParam(p5));
 }
 
 template <>
-sc_iterator5 * CreateIterator5<sc_addr, sc_type, sc_addr, sc_type, sc_type>(
+bool InitializeIterator5<sc_addr, sc_type, sc_addr, sc_type, sc_type>(
+    sc_iterator5 & iterator,
     ScMemoryContext const & context,
     sc_addr const & p1,
     sc_type const & p2,
@@ -98,11 +141,20 @@ sc_iterator5 * CreateIterator5<sc_addr, sc_type, sc_addr, sc_type, sc_type>(
     sc_type const & p4,
     sc_type const & p5)
 {
-  return sc_iterator5_f_a_f_a_a_new(*context, p1, p2, p3, p4, p5);
+  return sc_iterator5_init(
+      &iterator,
+      *context,
+      sc_iterator5_f_a_f_a_a,
+      ToIteratorParam(p1),
+      ToIteratorParam(p2),
+      ToIteratorParam(p3),
+      ToIteratorParam(p4),
+      ToIteratorParam(p5));
 }
 
 template <>
-sc_iterator5 * CreateIterator5<sc_addr, sc_type, sc_addr, sc_type, sc_addr>(
+bool InitializeIterator5<sc_addr, sc_type, sc_addr, sc_type, sc_addr>(
+    sc_iterator5 & iterator,
     ScMemoryContext const & context,
     sc_addr const & p1,
     sc_type const & p2,
@@ -110,11 +162,20 @@ sc_iterator5 * CreateIterator5<sc_addr, sc_type, sc_addr, sc_type, sc_addr>(
     sc_type const & p4,
     sc_addr const & p5)
 {
-  return sc_iterator5_f_a_f_a_f_new(*context, p1, p2, p3, p4, p5);
+  return sc_iterator5_init(
+      &iterator,
+      *context,
+      sc_iterator5_f_a_f_a_f,
+      ToIteratorParam(p1),
+      ToIteratorParam(p2),
+      ToIteratorParam(p3),
+      ToIteratorParam(p4),
+      ToIteratorParam(p5));
 }
 
 template <>
-sc_iterator5 * CreateIterator5<sc_addr, sc_type, sc_type, sc_type, sc_addr>(
+bool InitializeIterator5<sc_addr, sc_type, sc_type, sc_type, sc_addr>(
+    sc_iterator5 & iterator,
     ScMemoryContext const & context,
     sc_addr const & p1,
     sc_type const & p2,
@@ -122,11 +183,20 @@ sc_iterator5 * CreateIterator5<sc_addr, sc_type, sc_type, sc_type, sc_addr>(
     sc_type const & p4,
     sc_addr const & p5)
 {
-  return sc_iterator5_f_a_a_a_f_new(*context, p1, p2, p3, p4, p5);
+  return sc_iterator5_init(
+      &iterator,
+      *context,
+      sc_iterator5_f_a_a_a_f,
+      ToIteratorParam(p1),
+      ToIteratorParam(p2),
+      ToIteratorParam(p3),
+      ToIteratorParam(p4),
+      ToIteratorParam(p5));
 }
 
 template <>
-sc_iterator5 * CreateIterator5<sc_type, sc_type, sc_addr, sc_type, sc_addr>(
+bool InitializeIterator5<sc_type, sc_type, sc_addr, sc_type, sc_addr>(
+    sc_iterator5 & iterator,
     ScMemoryContext const & context,
     sc_type const & p1,
     sc_type const & p2,
@@ -134,11 +204,20 @@ sc_iterator5 * CreateIterator5<sc_type, sc_type, sc_addr, sc_type, sc_addr>(
     sc_type const & p4,
     sc_addr const & p5)
 {
-  return sc_iterator5_a_a_f_a_f_new(*context, p1, p2, p3, p4, p5);
+  return sc_iterator5_init(
+      &iterator,
+      *context,
+      sc_iterator5_a_a_f_a_f,
+      ToIteratorParam(p1),
+      ToIteratorParam(p2),
+      ToIteratorParam(p3),
+      ToIteratorParam(p4),
+      ToIteratorParam(p5));
 }
 
 template <>
-sc_iterator5 * CreateIterator5<sc_type, sc_type, sc_addr, sc_type, sc_type>(
+bool InitializeIterator5<sc_type, sc_type, sc_addr, sc_type, sc_type>(
+    sc_iterator5 & iterator,
     ScMemoryContext const & context,
     sc_type const & p1,
     sc_type const & p2,
@@ -146,11 +225,20 @@ sc_iterator5 * CreateIterator5<sc_type, sc_type, sc_addr, sc_type, sc_type>(
     sc_type const & p4,
     sc_type const & p5)
 {
-  return sc_iterator5_a_a_f_a_a_new(*context, p1, p2, p3, p4, p5);
+  return sc_iterator5_init(
+      &iterator,
+      *context,
+      sc_iterator5_a_a_f_a_a,
+      ToIteratorParam(p1),
+      ToIteratorParam(p2),
+      ToIteratorParam(p3),
+      ToIteratorParam(p4),
+      ToIteratorParam(p5));
 }
 
 template <>
-sc_iterator5 * CreateIterator5<sc_type, sc_type, sc_type, sc_type, sc_addr>(
+bool InitializeIterator5<sc_type, sc_type, sc_type, sc_type, sc_addr>(
+    sc_iterator5 & iterator,
     ScMemoryContext const & context,
     sc_type const & p1,
     sc_type const & p2,
@@ -158,5 +246,13 @@ sc_iterator5 * CreateIterator5<sc_type, sc_type, sc_type, sc_type, sc_addr>(
     sc_type const & p4,
     sc_addr const & p5)
 {
-  return sc_iterator5_a_a_a_a_f_new(*context, p1, p2, p3, p4, p5);
+  return sc_iterator5_init(
+      &iterator,
+      *context,
+      sc_iterator5_a_a_a_a_f,
+      ToIteratorParam(p1),
+      ToIteratorParam(p2),
+      ToIteratorParam(p3),
+      ToIteratorParam(p4),
+      ToIteratorParam(p5));
 }
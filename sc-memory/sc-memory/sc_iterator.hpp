@@ -11,6 +11,11 @@
 
 #include "sc_utils.hpp"
 
+extern "C"
+{
+#include "sc-core/sc-store/sc_iterator.h"
+}
+
 class ScMemoryContext;
 
 /*!
@@ -70,8 +75,90 @@ public:
     return Get(idx);
   }
 
+  /*!
+   * @brief Input iterator over found constructions. It moves the iterator to the next construction on increment.
+   */
+  class ConstructionIterator
+  {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::array<ScAddr, tripleSize>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type const *;
+    using reference = value_type const &;
+
+    ConstructionIterator() = default;
+
+    explicit ConstructionIterator(ScIterator const * iterator);
+
+    reference operator*() const
+    {
+      return m_construction;
+    }
+
+    pointer operator->() const
+    {
+      return &m_construction;
+    }
+
+    ConstructionIterator & operator++();
+
+    bool operator==(ConstructionIterator const & other) const
+    {
+      return m_iterator == other.m_iterator;
+    }
+
+    bool operator!=(ConstructionIterator const & other) const
+    {
+      return m_iterator != other.m_iterator;
+    }
+
+  private:
+    ScIterator const * m_iterator = nullptr;  ///< Iterator is null if there are no more constructions.
+    value_type m_construction;
+  };
+
+  /*!
+   * @brief Moves the iterator to the first construction and returns input iterator over found constructions.
+   *
+   * It allows to use the iterator in range-based for loop. The iterator can be traversed only once.
+   *
+   * @code
+   * for (auto const & [sourceAddr, arcAddr, targetAddr] : context.Iterate(setAddr, ScType::EdgeAccessConstPosPerm,
+   * ScType::Unknown))
+   * {
+   *   // Process found triple.
+   * }
+   * @endcode
+   */
+  _SC_EXTERN ConstructionIterator begin() const;
+
+  /*!
+   * @brief Returns input iterator which points after the last found construction.
+   */
+  _SC_EXTERN ConstructionIterator end() const;
+
 protected:
-  IterType * m_iterator = nullptr;
+  ScIterator() = default;
+
+  /*!
+   * @brief Copies state of another iterator. Copied iterator points to its own storage of iterator in sc-core and
+   * continues iteration from the same construction independently of another one.
+   *
+   * @param other Another iterator.
+   */
+  ScIterator(ScIterator const & other);
+
+  /*!
+   * @brief Copies state of another iterator. Copied iterator points to its own storage of iterator in sc-core.
+   *
+   * @param other Another iterator.
+   * @return Reference to this instance.
+   */
+  ScIterator & operator=(ScIterator const & other);
+
+  IterType * m_iterator = nullptr;  ///< Iterator is null if it is not valid, otherwise it points to `m_storage`.
+  IterType m_storage;  ///< Storage of iterator in sc-core, it doesn't allocate memory for iterator.
   size_t m_tripleSize = tripleSize;
 
   static sc_type Convert(sc_type const & s);
@@ -12,10 +12,16 @@ extern "C"
 }
 
 template <typename P1, typename P2, typename P3>
-sc_iterator3 * CreateIterator3(ScMemoryContext const & context, P1 const & p1, P2 const & p2, P3 const & p3);
+bool InitializeIterator3(
+    sc_iterator3 & iterator,
+    ScMemoryContext const & context,
+    P1 const & p1,
+    P2 const & p2,
+    P3 const & p3);
 
 template <typename P1, typename P2, typename P3, typename P4, typename P5>
-sc_iterator5 * CreateIterator5(
+bool InitializeIterator5(
+    sc_iterator5 & iterator,
     ScMemoryContext const & context,
     P1 const & p1,
     P2 const & p2,
@@ -49,6 +55,57 @@ sc_type ScIterator<IterType, tripleSize>::Convert(ScType const & type)
   return *type;
 }
 
+template <typename IterType, sc_uint8 tripleSize>
+ScIterator<IterType, tripleSize>::ScIterator(ScIterator const & other)
+  : m_iterator(other.m_iterator ? &m_storage : nullptr)
+  , m_storage(other.m_storage)
+  , m_tripleSize(other.m_tripleSize)
+{
+}
+
+template <typename IterType, sc_uint8 tripleSize>
+ScIterator<IterType, tripleSize> & ScIterator<IterType, tripleSize>::operator=(ScIterator const & other)
+{
+  if (this == &other)
+    return *this;
+
+  m_storage = other.m_storage;
+  m_iterator = other.m_iterator ? &m_storage : nullptr;
+  m_tripleSize = other.m_tripleSize;
+  return *this;
+}
+
+template <typename IterType, sc_uint8 tripleSize>
+typename ScIterator<IterType, tripleSize>::ConstructionIterator ScIterator<IterType, tripleSize>::begin() const
+{
+  return ConstructionIterator(this);
+}
+
+template <typename IterType, sc_uint8 tripleSize>
+typename ScIterator<IterType, tripleSize>::ConstructionIterator ScIterator<IterType, tripleSize>::end() const
+{
+  return ConstructionIterator();
+}
+
+template <typename IterType, sc_uint8 tripleSize>
+ScIterator<IterType, tripleSize>::ConstructionIterator::ConstructionIterator(ScIterator const * iterator)
+  : m_iterator(iterator)
+{
+  ++(*this);
+}
+
+template <typename IterType, sc_uint8 tripleSize>
+typename ScIterator<IterType, tripleSize>::ConstructionIterator &
+ScIterator<IterType, tripleSize>::ConstructionIterator::operator++()
+{
+  if (m_iterator->Next())
+    m_construction = m_iterator->Get();
+  else
+    m_iterator = nullptr;
+
+  return *this;
+}
+
 // ---------------------------
 
 template <typename ParamType1, typename ParamType2, typename ParamType3>
@@ -58,7 +115,8 @@ ScIterator3<ParamType1, ParamType2, ParamType3>::ScIterator3(
     ParamType2 const & p2,
     ParamType3 const & p3)
 {
-  m_iterator = CreateIterator3(context, Convert(p1), Convert(p2), Convert(p3));
+  if (InitializeIterator3(m_storage, context, Convert(p1), Convert(p2), Convert(p3)))
+    m_iterator = &m_storage;
 }
 
 template <typename ParamType1, typename ParamType2, typename ParamType3>
@@ -68,7 +126,8 @@ ScIterator3<ParamType1, ParamType2, ParamType3>::~ScIterator3()
 }
 
 template <typename ParamType1, typename ParamType2, typename ParamType3>
-ScIterator3<ParamType1, ParamType2, ParamType3>::ScIterator3(ScIterator3 const &)
+ScIterator3<ParamType1, ParamType2, ParamType3>::ScIterator3(ScIterator3 const & other)
+  : ScIterator<sc_iterator3, 3>(other)
 {
 }
 
@@ -76,18 +135,14 @@ template <typename ParamType1, typename ParamType2, typename ParamType3>
 ScIterator3<ParamType1, ParamType2, ParamType3> & ScIterator3<ParamType1, ParamType2, ParamType3>::operator=(
     ScIterator3 const & other)
 {
-  TakeOwnership(other);
+  ScIterator<sc_iterator3, 3>::operator=(other);
   return *this;
 }
 
 template <typename ParamType1, typename ParamType2, typename ParamType3>
 void ScIterator3<ParamType1, ParamType2, ParamType3>::Destroy()
 {
-  if (m_iterator)
-  {
-    sc_iterator3_free(m_iterator);
-    m_iterator = nullptr;
-  }
+  m_iterator = nullptr;
 }
 
 template <typename ParamType1, typename ParamType2, typename ParamType3>
@@ -155,7 +210,8 @@ ScIterator5<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5>::ScItera
     ParamType4 const & p4,
     ParamType5 const & p5)
 {
-  m_iterator = CreateIterator5(context, Convert(p1), Convert(p2), Convert(p3), Convert(p4), Convert(p5));
+  if (InitializeIterator5(m_storage, context, Convert(p1), Convert(p2), Convert(p3), Convert(p4), Convert(p5)))
+    m_iterator = &m_storage;
 }
 
 template <typename ParamType1, typename ParamType2, typename ParamType3, typename ParamType4, typename ParamType5>
@@ -167,11 +223,7 @@ ScIterator5<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5>::~ScIter
 template <typename ParamType1, typename ParamType2, typename ParamType3, typename ParamType4, typename ParamType5>
 void ScIterator5<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5>::Destroy()
 {
-  if (m_iterator)
-  {
-    sc_iterator5_free(m_iterator);
-    m_iterator = nullptr;
-  }
+  m_iterator = nullptr;
 }
 
 template <typename ParamType1, typename ParamType2, typename ParamType3, typename ParamType4, typename ParamType5>
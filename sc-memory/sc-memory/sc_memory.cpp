@@ -7,6 +7,7 @@
 #include "sc_memory.hpp"
 
 #include "sc_keynodes.hpp"
+#include "sc_event_wait.hpp"
 #include "sc_utils.hpp"
 #include "sc_stream.hpp"
 
@@ -20,6 +21,7 @@ extern "C"
 #include "sc-core/sc_memory_context_permissions.h"
 #include "sc-core/sc_memory_headers.h"
 #include "sc-core/sc_helper.h"
+#include "sc-core/sc-store/sc-base/sc_metrics.h"
 }
 
 SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_BEGIN
@@ -59,6 +61,15 @@ void _logPrintHandler(sc_char const *, GLogLevelFlags log_level, sc_char const *
 
 #define CHECK_CONTEXT SC_CHECK(IsValid(), "Used context is invalid. Make sure that it's initialized.")
 
+std::vector<sc_addr> ToRealAddrs(std::vector<ScAddr> const & addrs)
+{
+  std::vector<sc_addr> realAddrs;
+  realAddrs.reserve(addrs.size());
+  for (ScAddr const & addr : addrs)
+    realAddrs.push_back(*addr);
+  return realAddrs;
+}
+
 }  // namespace
 
 // ------------------
@@ -95,6 +106,7 @@ bool ScMemory::IsInitialized()
 
 bool ScMemory::Shutdown(bool saveState /* = true */)
 {
+  ScActionFinishedDispatcher::Shutdown();
   ScKeynodes::Shutdown(ms_globalContext);
 
   utils::ScLog::SetUp("Console", "", "Info");
@@ -120,6 +132,27 @@ void ScMemory::LogUnmute()
   utils::ScLog::GetInstance()->SetMuted(false);
 }
 
+ScMemory::ScMetrics ScMemory::GetMetrics()
+{
+  ScMetrics metrics;
+  if (!SC_METRICS_ENABLED)
+    return metrics;
+
+  sc_metrics_stat stat;
+  sc_metrics_get_stat(&stat);
+
+  for (sc_uint32 metric = 0; metric < SC_METRICS_COUNT; ++metric)
+  {
+    sc_metric_stat const & metricStat = stat.metrics[metric];
+    metrics[sc_metrics_get_name((sc_metric)metric)] = {
+        metricStat.count,
+        metricStat.total_time,
+        {std::cbegin(metricStat.histogram), std::cend(metricStat.histogram)}};
+  }
+
+  return metrics;
+}
+
 // ---------------
 
 ScMemoryContext::ScMemoryContext() noexcept
@@ -197,6 +230,12 @@ void ScMemoryContext::BeginEventsPending()
   sc_memory_context_pending_begin(m_context);
 }
 
+void ScMemoryContext::BeginEventsCoalescingPending()
+{
+  CHECK_CONTEXT;
+  sc_memory_context_coalescing_pending_begin(m_context);
+}
+
 void ScMemoryContext::EndEventsPending()
 {
   CHECK_CONTEXT;
@@ -275,6 +314,32 @@ size_t ScMemoryContext::GetElementEdgesAndOutgoingArcsCount(ScAddr const & eleme
   return count;
 }
 
+std::vector<bool> ScMemoryContext::AreElements(std::vector<ScAddr> const & elementAddrs) const
+{
+  CHECK_CONTEXT;
+
+  std::vector<sc_addr> const addrs = ToRealAddrs(elementAddrs);
+  std::vector<sc_bool> areElements(addrs.size());
+  sc_result const result = sc_memory_are_elements(m_context, addrs.data(), addrs.size(), areElements.data());
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to check sc-elements because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to check sc-elements because sc-memory context hasn't read permissions.");
+
+  default:
+    break;
+  }
+
+  return {areElements.cbegin(), areElements.cend()};
+}
+
 size_t ScMemoryContext::GetElementOutputArcsCount(ScAddr const & elementAddr) const
 {
   return GetElementEdgesAndOutgoingArcsCount(elementAddr);
@@ -344,6 +409,36 @@ bool ScMemoryContext::EraseElement(ScAddr const & elementAddr)
   return result == SC_RESULT_OK;
 }
 
+bool ScMemoryContext::EraseElements(std::vector<ScAddr> const & elementAddrs)
+{
+  CHECK_CONTEXT;
+
+  std::vector<sc_addr> const addrs = ToRealAddrs(elementAddrs);
+  sc_result const result = sc_memory_elements_free(m_context, addrs.data(), addrs.size());
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to erase sc-elements because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_ERASE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to erase sc-elements because sc-memory context hasn't erase permissions.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_ERASE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to erase sc-elements because sc-memory context hasn't permissions to erase permissions.");
+
+  default:
+    break;
+  }
+
+  return result == SC_RESULT_OK;
+}
+
 ScAddr ScMemoryContext::GenerateNode(ScType const & nodeType)
 {
   CHECK_CONTEXT;
@@ -372,6 +467,33 @@ ScAddr ScMemoryContext::GenerateNode(ScType const & nodeType)
   return nodeAddr;
 }
 
+void ScMemoryContext::GenerateNodesAndLinks(std::vector<sc_type> const & types, std::vector<sc_addr> & addrs)
+{
+  CHECK_CONTEXT;
+
+  addrs.resize(types.size());
+  sc_result const result = sc_memory_nodes_and_links_new_ext(m_context, types.data(), types.size(), addrs.data());
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_ELEMENT_IS_NOT_NODE:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Specified types must be sc-node or sc-link types. You should provide any of ScType::Node... or "
+        "ScType::Link... values as types.");
+
+  case SC_RESULT_ERROR_FULL_MEMORY:
+    SC_THROW_EXCEPTION(utils::ExceptionCritical, "Not able to create sc-elements because sc-memory is full.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to create sc-elements because sc-memory context is not authorized.");
+
+  default:
+    break;
+  }
+}
+
 ScAddr ScMemoryContext::CreateNode(ScType const & nodeType)
 {
   return GenerateNode(nodeType);
@@ -492,6 +614,31 @@ ScType ScMemoryContext::GetElementType(ScAddr const & elementAddr) const
   return ScType{elementType};
 }
 
+std::vector<ScType> ScMemoryContext::GetElementTypes(std::vector<ScAddr> const & elementAddrs) const
+{
+  CHECK_CONTEXT;
+
+  std::vector<sc_addr> const addrs = ToRealAddrs(elementAddrs);
+  std::vector<sc_type> elementTypes(addrs.size());
+  sc_result const result = sc_memory_get_elements_types(m_context, addrs.data(), addrs.size(), elementTypes.data());
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to get sc-types because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to get sc-types because sc-memory context hasn't read permissions.");
+
+  default:
+    break;
+  }
+
+  return {elementTypes.cbegin(), elementTypes.cend()};
+}
+
 bool ScMemoryContext::SetElementSubtype(ScAddr const & elementAddr, ScType newSubtype)
 {
   CHECK_CONTEXT;
@@ -634,6 +781,40 @@ std::tuple<ScAddr, ScAddr> ScMemoryContext::GetConnectorIncidentElements(ScAddr
   return {firstIncidentElementAddr, secondIncidentElementAddr};
 }
 
+std::vector<std::tuple<ScAddr, ScAddr>> ScMemoryContext::GetConnectorsIncidentElements(
+    std::vector<ScAddr> const & connectorAddrs) const
+{
+  CHECK_CONTEXT;
+
+  std::vector<sc_addr> const addrs = ToRealAddrs(connectorAddrs);
+  std::vector<sc_addr> firstIncidentElementAddrs(addrs.size());
+  std::vector<sc_addr> secondIncidentElementAddrs(addrs.size());
+  sc_result const result = sc_memory_get_arcs_info(
+      m_context, addrs.data(), addrs.size(), firstIncidentElementAddrs.data(), secondIncidentElementAddrs.data());
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get incident sc-elements because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get incident sc-elements because sc-memory context hasn't read permissions.");
+
+  default:
+    break;
+  }
+
+  std::vector<std::tuple<ScAddr, ScAddr>> incidentElements;
+  incidentElements.reserve(addrs.size());
+  for (size_t i = 0; i < addrs.size(); ++i)
+    incidentElements.emplace_back(firstIncidentElementAddrs[i], secondIncidentElementAddrs[i]);
+  return incidentElements;
+}
+
 bool ScMemoryContext::GetEdgeInfo(
     ScAddr const & connectorAddr,
     ScAddr & outFirstIncidentElementAddr,
@@ -1184,10 +1365,13 @@ ScTemplate::Result ScMemoryContext::HelperGenTemplate(
   return ScTemplate::Result(true);
 }
 
-ScTemplate::Result ScMemoryContext::SearchByTemplate(ScTemplate const & templateToFind, ScTemplateSearchResult & result)
+ScTemplate::Result ScMemoryContext::SearchByTemplate(
+    ScTemplate const & templateToFind,
+    ScTemplateSearchResult & result,
+    ScTemplateSearchOptions const & options)
 {
   CHECK_CONTEXT;
-  return templateToFind.Search(*this, result);
+  return templateToFind.Search(*this, result, options);
 }
 
 ScTemplate::Result ScMemoryContext::HelperSearchTemplate(
@@ -1201,10 +1385,11 @@ void ScMemoryContext::SearchByTemplate(
     ScTemplate const & templateToFind,
     ScTemplateSearchResultCallback const & callback,
     ScTemplateSearchResultFilterCallback const & filterCallback,
-    ScTemplateSearchResultCheckCallback const & checkCallback)
+    ScTemplateSearchResultCheckCallback const & checkCallback,
+    ScTemplateSearchOptions const & options)
 {
   CHECK_CONTEXT;
-  templateToFind.Search(*this, callback, filterCallback, checkCallback);
+  templateToFind.Search(*this, callback, filterCallback, checkCallback, options);
 }
 
 void ScMemoryContext::HelperSearchTemplate(
@@ -1236,10 +1421,11 @@ void ScMemoryContext::SearchByTemplateInterruptibly(
     ScTemplate const & templateToFind,
     ScTemplateSearchResultCallbackWithRequest const & callback,
     ScTemplateSearchResultFilterCallback const & filterCallback,
-    ScTemplateSearchResultCheckCallback const & checkCallback)
+    ScTemplateSearchResultCheckCallback const & checkCallback,
+    ScTemplateSearchOptions const & options)
 {
   CHECK_CONTEXT;
-  templateToFind.Search(*this, callback, filterCallback, checkCallback);
+  templateToFind.Search(*this, callback, filterCallback, checkCallback, options);
 }
 
 void ScMemoryContext::HelperSmartSearchTemplate(
@@ -1267,6 +1453,29 @@ void ScMemoryContext::HelperSmartSearchTemplate(
   SearchByTemplateInterruptibly(templateToFind, callback, checkCallback);
 }
 
+std::string ScMemoryContext::ExplainSearchByTemplate(ScTemplate const & templateToFind)
+{
+  CHECK_CONTEXT;
+  return templateToFind.ExplainSearch(*this);
+}
+
+ScTemplateSearchCursor ScMemoryContext::CreateTemplateSearchCursor(
+    ScTemplate const & templateToFind,
+    size_t offset,
+    size_t limit)
+{
+  CHECK_CONTEXT;
+  return templateToFind.CreateSearchCursor(*this, offset, limit);
+}
+
+void ScMemoryContext::SearchByTemplates(
+    std::vector<ScTemplate const *> const & templatesToFind,
+    std::vector<ScTemplateSearchResult> & results)
+{
+  CHECK_CONTEXT;
+  ScTemplate::SearchBatch(*this, templatesToFind, results);
+}
+
 void ScMemoryContext::BuildTemplate(
     ScTemplate & resultTemplate,
     ScAddr const & translatableTemplateAddr,
@@ -1332,9 +1541,70 @@ ScMemoryContext::ScMemoryStatistics ScMemoryContext::CalculateStatistics() const
   }
 
   ScMemoryStatistics statistics{};
-  statistics.m_connectorsNum = uint32_t(stat.arc_count);
-  statistics.m_linksNum = uint32_t(stat.link_count);
-  statistics.m_nodesNum = uint32_t(stat.node_count);
+  statistics.m_connectorsNum = stat.arc_count;
+  statistics.m_linksNum = stat.link_count;
+  statistics.m_nodesNum = stat.node_count;
+
+  return statistics;
+}
+
+size_t ScMemoryContext::GetElementsCountByType(ScType const & type) const
+{
+  CHECK_CONTEXT;
+
+  sc_uint64 count = 0;
+  sc_result const result = sc_memory_get_elements_count_by_type(m_context, *type, &count);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get count of sc-elements by sc-type because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get count of sc-elements by sc-type because sc-memory context hasn't read permissions.");
+
+  default:
+    break;
+  }
+
+  return count;
+}
+
+ScMemoryContext::ScEventsStatistics ScMemoryContext::CalculateEventsStatistics() const
+{
+  CHECK_CONTEXT;
+
+  sc_events_stat stat;
+  sc_result const result = sc_memory_events_stat(m_context, &stat);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get sc-events statistics because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get sc-events statistics because sc-memory context hasn't read permissions.");
+
+  default:
+    break;
+  }
+
+  ScEventsStatistics statistics{};
+  statistics.m_queueSize = stat.queue_size;
+  statistics.m_maxQueueSize = stat.max_queue_size;
+  statistics.m_processedEventsCount = stat.processed_events_count;
+  statistics.m_droppedEventsCount = stat.dropped_events_count;
+  statistics.m_blockedEmissionsCount = stat.blocked_emissions_count;
+  statistics.m_eventsWaitTime = stat.events_wait_time;
+  statistics.m_eventsRunTime = stat.events_run_time;
 
   return statistics;
 }
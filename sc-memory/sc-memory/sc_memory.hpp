@@ -12,6 +12,10 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "sc_addr.hpp"
 #include "sc_type.hpp"
 
@@ -38,6 +42,15 @@ class ScMemory
   friend class ScMemoryContext;
 
 public:
+  struct ScMetric
+  {
+    sc_uint64 m_count;                   ///< Amount of measured operations.
+    sc_uint64 m_totalTime;               ///< Total time (in microseconds) of measured operations.
+    std::vector<sc_uint64> m_histogram;  ///< Amounts of operations by buckets of their latencies.
+  };
+
+  using ScMetrics = std::map<std::string, ScMetric>;
+
   static std::string ms_configPath;
 
   /*!
@@ -75,6 +88,25 @@ public:
   _SC_EXTERN static void LogMute();
   _SC_EXTERN static void LogUnmute();
 
+  /*!
+   * @brief Gets counters and latency histograms of hot operations of sc-memory.
+   *
+   * Metrics are collected for allocation and erasure of sc-elements, creation and steps of sc-iterators, waiting for
+   * monitors, reading and writing of sc-links contents in fs-memory, waiting and processing of sc-events and phases of
+   * search by sc-templates. The first bucket of histogram counts operations lasted less than 1 microsecond, the bucket
+   * i counts operations lasted from 2^(i-1) to 2^i microseconds, the last bucket counts all longer operations.
+   *
+   * @return Returns metrics by their names, for example, "element_allocation". If sc-machine is built without option
+   * SC_MEMORY_METRICS, then returns empty metrics.
+   * @code
+   * ScMemory::ScMetrics const & metrics = ScMemory::GetMetrics();
+   * auto const it = metrics.find("iterator_step");
+   * if (it != metrics.cend())
+   *   std::cout << it->second.m_count << " steps of sc-iterators" << std::endl;
+   * @endcode
+   */
+  _SC_EXTERN static ScMetrics GetMetrics();
+
   static ScMemoryContext * ms_globalContext;
 };
 
@@ -85,6 +117,9 @@ class ScMemoryContext
   friend class ScServerMessageAction;
   friend class ScAction;
   friend class ScTemplateKeynode;
+  friend class ScTemplateSearch;
+  friend class ScTemplateGenerator;
+  friend class ScTemplateSubscription;
 
 public:
   struct ScMemoryStatistics
@@ -99,6 +134,17 @@ public:
     }
   };
 
+  struct ScEventsStatistics
+  {
+    sc_uint32 m_queueSize;              ///< Amount of sc-events waiting for processing or being processed.
+    sc_uint32 m_maxQueueSize;           ///< Maximum amount of waiting sc-events, 0 if the queue is unbounded.
+    sc_uint64 m_processedEventsCount;   ///< Amount of processed sc-events.
+    sc_uint64 m_droppedEventsCount;     ///< Amount of sc-events dropped because the queue was full.
+    sc_uint64 m_blockedEmissionsCount;  ///< Amount of times emitters waited because the queue was full.
+    sc_uint64 m_eventsWaitTime;         ///< Total time (in microseconds) sc-events waited in the queue.
+    sc_uint64 m_eventsRunTime;          ///< Total time (in microseconds) of sc-events processing.
+  };
+
 public:
   _SC_EXTERN explicit ScMemoryContext() noexcept;
   _SC_EXTERN explicit ScMemoryContext(sc_memory_context * context) noexcept;
@@ -123,6 +169,9 @@ public:
   //! Begin events pending mode
   _SC_EXTERN void BeginEventsPending();
 
+  //! Begin events pending mode with coalescing of pending events (duplicated and cancelled events are not emitted)
+  _SC_EXTERN void BeginEventsCoalescingPending();
+
   //! End events pending mode
   _SC_EXTERN void EndEventsPending();
 
@@ -176,6 +225,25 @@ public:
    */
   _SC_EXTERN bool IsElement(ScAddr const & elementAddr) const;
 
+  /*!
+   * @brief Checks if sc-elements exist with the specified addresses at once.
+   *
+   * This method checks sc-memory context once and reads sc-elements grouped by sc-segments. It is faster than calling
+   * `IsElement` for each sc-address.
+   *
+   * @param elementAddrs Sc-addresses to check for existence.
+   * @return Returns flags of existence of sc-elements in the same order as `elementAddrs`.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or does not have read permissions.
+   *
+   * @code
+   * ScMemoryContext context;
+   * ScAddr elementAddr = context.GenerateNode(ScType::NodeConst);
+   * std::vector<bool> const areElements = context.AreElements({elementAddr, ScAddr::Empty});
+   * // areElements == {true, false}
+   * @endcode
+   */
+  _SC_EXTERN std::vector<bool> AreElements(std::vector<ScAddr> const & elementAddrs) const noexcept(false);
+
   /*!
    * @brief Returns the count of sc-edges and outgoing sc-arcs for a specified sc-element.
    *
@@ -296,6 +364,30 @@ public:
    */
   _SC_EXTERN bool EraseElement(ScAddr const & elementAddr) noexcept(false);
 
+  /*!
+   * @brief Erases several sc-elements from the sc-memory at once.
+   *
+   * This method erases the sc-elements identified by the given sc-addresses and all sc-connectors incident to them.
+   * Unlike erasing sc-elements one by one, it collects all sc-elements to be erased first and excludes sc-connectors
+   * from lists of only those sc-elements that remain in the sc-memory. Use it to erase sc-structures and other large
+   * sets of connected sc-elements.
+   *
+   * @param elementAddrs A vector of sc-addresses of sc-elements to erase.
+   * @return Returns true if all sc-elements were successfully erased; returns false if some of sc-addresses are not
+   * valid. The sc-elements with valid sc-addresses are erased in that case.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or does not have erase permissions for
+   * some of sc-elements. None of sc-elements are erased in that case.
+   *
+   * @code
+   * ScMemoryContext context;
+   * ScAddr const & nodeAddr1 = context.GenerateNode(ScType::NodeConst);
+   * ScAddr const & nodeAddr2 = context.GenerateNode(ScType::NodeConst);
+   * context.GenerateConnector(ScType::EdgeAccessConstPosPerm, nodeAddr1, nodeAddr2);
+   * context.EraseElements({nodeAddr1, nodeAddr2});
+   * @endcode
+   */
+  _SC_EXTERN bool EraseElements(std::vector<ScAddr> const & elementAddrs) noexcept(false);
+
   /*!
    * @brief Generates a new sc-node with the specified type.
    *
@@ -449,6 +541,28 @@ public:
    */
   _SC_EXTERN ScType GetElementType(ScAddr const & elementAddr) const noexcept(false);
 
+  /*!
+   * @brief Returns types of the specified sc-elements at once.
+   *
+   * This method checks sc-memory context once and reads sc-elements grouped by sc-segments. It is faster than calling
+   * `GetElementType` for each sc-address.
+   *
+   * @param elementAddrs Sc-addresses of sc-elements to query.
+   * @return Returns types of sc-elements in the same order as `elementAddrs`. Types of sc-elements that don't exist are
+   * `ScType::Unknown`.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or does not have read permissions for
+   * some of sc-elements.
+   *
+   * @code
+   * ScMemoryContext context;
+   * ScAddr nodeAddr = context.GenerateNode(ScType::NodeConst);
+   * ScAddr linkAddr = context.GenerateLink(ScType::LinkConst);
+   * std::vector<ScType> const elementTypes = context.GetElementTypes({nodeAddr, linkAddr});
+   * // elementTypes == {ScType::NodeConst, ScType::LinkConst}
+   * @endcode
+   */
+  _SC_EXTERN std::vector<ScType> GetElementTypes(std::vector<ScAddr> const & elementAddrs) const noexcept(false);
+
   /*!
    * @brief Changes the subtype of an sc-element.
    *
@@ -588,6 +702,32 @@ public:
   _SC_EXTERN std::tuple<ScAddr, ScAddr> GetConnectorIncidentElements(ScAddr const & connectorAddr) const
       noexcept(false);
 
+  /*!
+   * @brief Returns the source and target sc-elements of several sc-connectors at once.
+   *
+   * This method checks sc-memory context once and reads sc-connectors grouped by sc-segments. It is faster than calling
+   * `GetConnectorIncidentElements` for each sc-address.
+   *
+   * @param connectorAddrs Sc-addresses of sc-connectors.
+   * @return Returns tuples of sc-connector incident sc-elements sc-addresses in the same order as `connectorAddrs`. For
+   * sc-elements that don't exist or aren't sc-connectors, both sc-addresses are empty.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or does not have read permissions for
+   * some of sc-elements.
+   *
+   * @code
+   * ScMemoryContext context;
+   * ScAddr sourceNodeAddr = context.GenerateNode(ScType::NodeConst);
+   * ScAddr targetNodeAddr = context.GenerateNode(ScType::NodeConst);
+   * ScAddr arcAddr = context.GenerateConnector(ScType::EdgeDCommonConst, sourceNodeAddr, targetNodeAddr);
+   * for (auto const & [sourceAddr, targetAddr] : context.GetConnectorsIncidentElements({arcAddr}))
+   * {
+   *   // sourceAddr == sourceNodeAddr, targetAddr == targetNodeAddr
+   * }
+   * @endcode
+   */
+  _SC_EXTERN std::vector<std::tuple<ScAddr, ScAddr>> GetConnectorsIncidentElements(
+      std::vector<ScAddr> const & connectorAddrs) const noexcept(false);
+
   /*!
    * @brief Returns the source and target sc-elements of a sc-connector.
    *
@@ -1148,6 +1288,55 @@ public:
       ParamType4 const & param4,
       ParamType5 const & param5);
 
+  /*!
+   * @brief Creates an iterator for iterating over triples in range-based for loop.
+   *
+   * Unlike `CreateIterator3`, this method returns iterator by value and doesn't allocate memory for it, so it is
+   * preferred in tight loops.
+   *
+   * @param param1 A sc-address or sc-type of the first parameter for the iterator.
+   * @param param2 A sc-address or sc-type of the second parameter for the iterator.
+   * @param param3 A sc-address or sc-type of the third parameter for the iterator.
+   *
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated.
+   *
+   * @code
+   * ScMemoryContext context;
+   * for (auto const & [setAddr, arcAddr, elementAddr] :
+   *      context.Iterate(setAddr, ScType::EdgeAccessConstPosPerm, ScType::Unknown))
+   * {
+   *   // Process found triple.
+   * }
+   * @endcode
+   */
+  template <typename ParamType1, typename ParamType2, typename ParamType3>
+  _SC_EXTERN ScIterator3<ParamType1, ParamType2, ParamType3> Iterate(
+      ParamType1 const & param1,
+      ParamType2 const & param2,
+      ParamType3 const & param3);
+
+  /*!
+   * @brief Creates an iterator for iterating over quintuples in range-based for loop.
+   *
+   * Unlike `CreateIterator5`, this method returns iterator by value and doesn't allocate memory for it, so it is
+   * preferred in tight loops.
+   *
+   * @param param1 A sc-address or sc-type of the first parameter for the iterator.
+   * @param param2 A sc-address or sc-type of the second parameter for the iterator.
+   * @param param3 A sc-address or sc-type of the third parameter for the iterator.
+   * @param param4 A sc-address or sc-type of the fourth parameter for the iterator.
+   * @param param5 A sc-address or sc-type of the fifth parameter for the iterator.
+   *
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated.
+   */
+  template <typename ParamType1, typename ParamType2, typename ParamType3, typename ParamType4, typename ParamType5>
+  _SC_EXTERN ScIterator5<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5> Iterate(
+      ParamType1 const & param1,
+      ParamType2 const & param2,
+      ParamType3 const & param3,
+      ParamType4 const & param4,
+      ParamType5 const & param5);
+
   /*!
    * @brief Creates an iterator for iterating over triples.
    *
@@ -1850,6 +2039,8 @@ public:
    * Searches sc-constructions by object of `ScTemplate` and accumulates found sc-constructions into `result`.
    * @param templateToFind An object of `ScTemplate` to find sc-constructions by it.
    * @param result A result vector of found sc-constructions.
+   * @param options Search options. If `options.m_threadsCount` is greater than 1, then sc-constructions are searched in
+   * several threads and order of found sc-constructions may differ from order of single-threaded search.
    * @return Returns true if the sc-constructions are found; otherwise, returns false.
    * @throws utils::ExceptionInvalidState if the object of `ScTemplate` is not valid.
    *
@@ -1881,7 +2072,8 @@ public:
    */
   _SC_EXTERN ScTemplate::Result SearchByTemplate(
       ScTemplate const & templateToFind,
-      ScTemplateSearchResult & result) noexcept(false);
+      ScTemplateSearchResult & result,
+      ScTemplateSearchOptions const & options = ScTemplateSearchOptions()) noexcept(false);
 
   /*!
    * Searches sc-constructions by object of `ScTemplate` and accumulates found sc-constructions into `result`.
@@ -1935,6 +2127,8 @@ public:
    * @param callback A lambda-function, callable when all sc-construction triples were found.
    * @param filterCallback A lambda-function, that filters all found sc-constructions triples.
    * @param checkCallback A lambda-function, that filters all found elements.
+   * @param options Search options. If `options.m_threadsCount` is greater than 1, then sc-constructions are searched in
+   * several threads, but all callbacks are called by one thread at a time.
    * @return Returns true if the sc-constructions are found; otherwise, returns false.
    * @throws utils::ExceptionInvalidState if the object of `ScTemplate` is not valid.
    *
@@ -1969,7 +2163,8 @@ public:
       ScTemplate const & templateToFind,
       ScTemplateSearchResultCallback const & callback,
       ScTemplateSearchResultFilterCallback const & filterCallback = {},
-      ScTemplateSearchResultCheckCallback const & checkCallback = {}) noexcept(false);
+      ScTemplateSearchResultCheckCallback const & checkCallback = {},
+      ScTemplateSearchOptions const & options = ScTemplateSearchOptions()) noexcept(false);
 
   /*!
    * Searches sc-constructions by object of `ScTemplate` and passes found sc-constructions to `callback`
@@ -2119,6 +2314,8 @@ public:
    * @param callback A lambda-function, callable when all sc-construction triples were found.
    * @param filterCallback A lambda-function, that filters all found sc-constructions triples.
    * @param checkCallback A lambda-function, that filters all found elements.
+   * @param options Search options. If `options.m_threadsCount` is greater than 1, then sc-constructions are searched in
+   * several threads, but all callbacks are called by one thread at a time.
    * @return Returns true if the sc-constructions are found; otherwise, returns false.
    * @throws utils::ExceptionInvalidState if the object of `ScTemplate` is not valid.
    *
@@ -2155,7 +2352,8 @@ public:
       ScTemplate const & templateToFind,
       ScTemplateSearchResultCallbackWithRequest const & callback,
       ScTemplateSearchResultFilterCallback const & filterCallback = {},
-      ScTemplateSearchResultCheckCallback const & checkCallback = {}) noexcept(false);
+      ScTemplateSearchResultCheckCallback const & checkCallback = {},
+      ScTemplateSearchOptions const & options = ScTemplateSearchOptions()) noexcept(false);
 
   /*!
    * Searches constructions by object of `ScTemplate` and pass found sc-constructions to `callback`
@@ -2231,6 +2429,89 @@ public:
       ScTemplateSearchResultCallbackWithRequest const & callback,
       ScTemplateSearchResultCheckCallback const & checkCallback) noexcept(false);
 
+  /*!
+   * Describes plan of search by object of `ScTemplate` without searching sc-constructions. The plan contains
+   * connectivity components of sc-template, triples that search starts from, order in which search goes by other
+   * triples and estimated counts of sc-connectors iterated by each triple. Use it to find out why search by sc-template
+   * is slow.
+   * @param templateToFind An object of `ScTemplate` to describe search plan for it.
+   * @return A text description of search plan.
+   * @throws utils::ExceptionInvalidState if sc-memory context has no read permissions.
+   *
+   * @code
+   * ...
+   * ScTemplate templateToFind;
+   * templateToFind.Triple(
+   *  classAddr,
+   *  ScType::EdgeAccessVarPosPerm >> "_arc",
+   *  ScType::Unknown >> "_addr2"
+   * );
+   * SC_LOG_INFO(m_context->ExplainSearchByTemplate(templateToFind));
+   * ...
+   * @endcode
+   */
+  _SC_EXTERN std::string ExplainSearchByTemplate(ScTemplate const & templateToFind) noexcept(false);
+
+  /*!
+   * Creates cursor that searches sc-constructions by object of `ScTemplate` one by one. Unlike `SearchByTemplate`, it
+   * doesn't store all found sc-constructions, so it can be used to page through very big count of sc-constructions.
+   * @param templateToFind An object of `ScTemplate` to find sc-constructions by it.
+   * @param offset A count of found sc-constructions to be skipped.
+   * @param limit A maximum count of sc-constructions to be found by cursor.
+   * @return A cursor of search. It must not be used after this sc-memory context is destroyed.
+   * @throws utils::ExceptionInvalidState if sc-memory context has no read permissions.
+   *
+   * @code
+   * ...
+   * ScTemplate templateToFind;
+   * templateToFind.Triple(
+   *  classAddr,
+   *  ScType::EdgeAccessVarPosPerm >> "_arc",
+   *  ScType::Unknown >> "_addr2"
+   * );
+   * // Get the second page of 100 sc-constructions.
+   * ScTemplateSearchCursor cursor = m_context->CreateTemplateSearchCursor(templateToFind, 100, 100);
+   * ScTemplateResultItem item;
+   * while (cursor.Next(item))
+   * {
+   *   ScAddr const & addr2 = item["_addr2"];
+   *   // Handle found sc-construction.
+   * }
+   * ...
+   * @endcode
+   */
+  _SC_EXTERN ScTemplateSearchCursor CreateTemplateSearchCursor(
+      ScTemplate const & templateToFind,
+      size_t offset = 0,
+      size_t limit = ScTemplateSearchCursor::NO_LIMIT) noexcept(false);
+
+  /*!
+   * Searches sc-constructions by several objects of `ScTemplate` in one pass. Triples of sc-templates are ordered by
+   * their search plans, and sc-templates that start with the same triples share search by them, so sc-connectors of
+   * these triples are iterated once for all sc-templates. Use it to evaluate many similar sc-templates at once.
+   * @param templatesToFind Objects of `ScTemplate` to find sc-constructions by them.
+   * @param results [out] Results of search by each object of `ScTemplate` in the same order as `templatesToFind`.
+   * @throws utils::ExceptionInvalidState if sc-memory context has no read permissions.
+   *
+   * @code
+   * ...
+   * ScTemplate actionTemplate;
+   * actionTemplate.Triple(actionClassAddr, ScType::EdgeAccessVarPosPerm, ScType::NodeVar >> "_action");
+   * actionTemplate.Triple("_action", ScType::EdgeAccessVarPosPerm, ScType::NodeVar >> "_argument");
+   * ScTemplate initiatedActionTemplate;
+   * initiatedActionTemplate.Triple(actionClassAddr, ScType::EdgeAccessVarPosPerm, ScType::NodeVar >> "_action");
+   * initiatedActionTemplate.Triple(initiatedActionAddr, ScType::EdgeAccessVarPosPerm, "_action");
+   *
+   * std::vector<ScTemplateSearchResult> results;
+   * m_context->SearchByTemplates({&actionTemplate, &initiatedActionTemplate}, results);
+   * // results[0] contains sc-constructions found by actionTemplate, results[1] - by initiatedActionTemplate.
+   * ...
+   * @endcode
+   */
+  _SC_EXTERN void SearchByTemplates(
+      std::vector<ScTemplate const *> const & templatesToFind,
+      std::vector<ScTemplateSearchResult> & results) noexcept(false);
+
   /*!
    * Translates a sc-template represented in sc-memory (sc-structure) into object of `ScTemplate`. After
    * sc-template translation you can use object of `ScTemplate` to search or generate sc-constructions: in
@@ -2364,12 +2645,33 @@ protected:
       ScTemplateParams const & params = ScTemplateParams()) noexcept(false);
 
 public:
-  /*! Calculates sc-element counts.
+  /*! Calculates sc-element counts. Counts are maintained by sc-memory, so this method doesn't visit sc-elements.
    * @return Returns sc-nodes, sc-connectors and sc-links counts.
    * @throws ExceptionInvalidState if the sc-memory context is not authenticated or does not have read permissions.
    */
   _SC_EXTERN ScMemoryStatistics CalculateStatistics() const;
 
+  /*! Gets count of sc-elements which sc-types include the specified sc-type. Counts are maintained by sc-memory, so this
+   * method doesn't visit sc-elements.
+   * @param type A sc-type to count sc-elements with it. For example, `ScType::NodeConst` counts all constant sc-nodes,
+   * including constant sc-classes and sc-structures, `ScType::Unknown` counts all sc-elements.
+   * @return Returns count of sc-elements.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or does not have read permissions.
+   *
+   * @code
+   * ScMemoryContext context;
+   * size_t const arcsCount = context.GetElementsCountByType(ScType::EdgeAccessConstPosPerm);
+   * @endcode
+   */
+  _SC_EXTERN size_t GetElementsCountByType(ScType const & type) const noexcept(false);
+
+  /*! Calculates statistics of sc-events processing.
+   * @return Returns size of sc-events queue, amounts of processed and dropped sc-events, amount of times emitters
+   * waited for free space in the queue and total wait and run times of sc-events.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or does not have read permissions.
+   */
+  _SC_EXTERN ScEventsStatistics CalculateEventsStatistics() const;
+
   /*! Calculates sc-element counts.
    * @return Returns sc-nodes, sc-connectors and sc-links counts.
    * @throws ExceptionInvalidState if the sc-memory context is not authenticated or does not have read permissions.
@@ -2396,6 +2698,18 @@ public:
 protected:
   _SC_EXTERN explicit ScMemoryContext(ScAddr const & userAddr) noexcept;
 
+  /*!
+   * Generates several sc-nodes and sc-links at once. Types with sc-link subtype are used to generate sc-links, the
+   * other ones are used to generate sc-nodes.
+   * @param types Types of sc-elements to be generated.
+   * @param addrs [out] Sc-addresses of generated sc-elements in the same order as `types`.
+   * @throws utils::ExceptionInvalidParams if one of types is sc-connector type.
+   * @throws utils::ExceptionCritical if sc-memory is full. None of sc-elements are generated in this case.
+   * @throws utils::ExceptionInvalidState if sc-memory context is not authenticated.
+   */
+  _SC_EXTERN void GenerateNodesAndLinks(std::vector<sc_type> const & types, std::vector<sc_addr> & addrs) noexcept(
+      false);
+
 protected:
   sc_memory_context * m_context;
   ScAddr m_contextStructureAddr;
@@ -2410,6 +2724,22 @@ public:
     m_context.BeginEventsPending();
   }
 
+  /*!
+   * @brief Starts events pending mode for the context.
+   * @param context A sc-memory context which events are pended.
+   * @param coalesceEvents If true, then the same pending events are emitted once, events about sc-connectors generated
+   * and erased within the guard scope are cancelled, and events of sc-elements erased within the guard scope are
+   * dropped.
+   */
+  _SC_EXTERN ScMemoryContextEventsPendingGuard(ScMemoryContext & context, bool coalesceEvents)
+    : m_context(context)
+  {
+    if (coalesceEvents)
+      m_context.BeginEventsCoalescingPending();
+    else
+      m_context.BeginEventsPending();
+  }
+
   _SC_EXTERN ~ScMemoryContextEventsPendingGuard()
   {
     m_context.EndEventsPending();
@@ -126,6 +126,27 @@ std::shared_ptr<ScIterator3<ParamType1, ParamType2, ParamType3>> ScMemoryContext
   return CreateIterator3(param1, param2, param3);
 }
 
+template <typename ParamType1, typename ParamType2, typename ParamType3>
+ScIterator3<ParamType1, ParamType2, ParamType3> ScMemoryContext::Iterate(
+    ParamType1 const & param1,
+    ParamType2 const & param2,
+    ParamType3 const & param3)
+{
+  return ScIterator3<ParamType1, ParamType2, ParamType3>(*this, param1, param2, param3);
+}
+
+template <typename ParamType1, typename ParamType2, typename ParamType3, typename ParamType4, typename ParamType5>
+ScIterator5<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5> ScMemoryContext::Iterate(
+    ParamType1 const & param1,
+    ParamType2 const & param2,
+    ParamType3 const & param3,
+    ParamType4 const & param4,
+    ParamType5 const & param5)
+{
+  return ScIterator5<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5>(
+      *this, param1, param2, param3, param4, param5);
+}
+
 template <typename ParamType1, typename ParamType2, typename ParamType3, typename TripleCallback>
 void ScMemoryContext::ForEach(
     ParamType1 const & param1,
@@ -133,9 +154,8 @@ void ScMemoryContext::ForEach(
     ParamType3 const & param3,
     TripleCallback && callback)
 {
-  ScIterator3Ptr it = CreateIterator3(param1, param2, param3);
-  while (it->Next())
-    callback(it->Get(0), it->Get(1), it->Get(2));
+  for (auto const & [source, connector, target] : Iterate(param1, param2, param3))
+    callback(source, connector, target);
 }
 
 template <typename ParamType1, typename ParamType2, typename ParamType3, typename TripleCallback>
@@ -163,9 +183,8 @@ void ScMemoryContext::ForEach(
     ParamType5 const & param5,
     QuintupleCallback && callback)
 {
-  ScIterator5Ptr it = CreateIterator5(param1, param2, param3, param4, param5);
-  while (it->Next())
-    callback(it->Get(0), it->Get(1), it->Get(2), it->Get(3), it->Get(4));
+  for (auto const & [source, connector, target, attrConnector, attr] : Iterate(param1, param2, param3, param4, param5))
+    callback(source, connector, target, attrConnector, attr);
 }
 
 template <
@@ -27,6 +27,7 @@
 #include "sc_action.hpp"
 #include "sc_result.hpp"
 #include "sc_event_wait.hpp"
+#include "sc_template_subscription.hpp"
 #include "sc_module.hpp"
 #include "sc_keynodes.hpp"
 
@@ -63,7 +63,7 @@ ScSet & ScSet::operator<<(ScTemplateResultItem const & res)
 {
   size_t const res_num = res.Size();
   for (size_t i = 0; i < res_num; ++i)
-    Append(res.m_replacementConstruction[i]);
+    Append(res[i]);
 
   return *this;
 }
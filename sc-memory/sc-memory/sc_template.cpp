@@ -476,6 +476,20 @@ ScTemplateResultItem::ScTemplateResultItem(
 {
 }
 
+ScTemplateResultItem::ScTemplateResultItem(
+    ScMemoryContext * context,
+    ScAddrVector const & results,
+    size_t resultsOffset,
+    size_t resultsSize,
+    ScTemplate::ScTemplateItemsToReplacementsItemsPositions const * replacements)
+  : m_context(context)
+  , m_replacementConstructionView(&results)
+  , m_replacementConstructionViewOffset(resultsOffset)
+  , m_replacementConstructionViewSize(resultsSize)
+  , m_templateItemsNamesToReplacementItemPositionsView(replacements)
+{
+}
+
 ScTemplateResultItem::ScTemplateResultItem(
     ScMemoryContext * context,
     ScTemplate::ScTemplateItemsToReplacementsItemsPositions replacements)
@@ -487,10 +501,9 @@ ScTemplateResultItem::ScTemplateResultItem(
 ScTemplateResultItem::~ScTemplateResultItem() = default;
 
 ScTemplateResultItem::ScTemplateResultItem(ScTemplateResultItem const & otherItem)
-  : ScTemplateResultItem(
-        otherItem.m_context,
-        otherItem.m_replacementConstruction,
-        otherItem.m_templateItemsNamesToReplacementItemPositions)
+  : m_context(otherItem.m_context)
+  , m_replacementConstruction(otherItem.begin(), otherItem.end())
+  , m_templateItemsNamesToReplacementItemPositions(otherItem.GetReplacementsPositions())
 {
 }
 
@@ -500,13 +513,46 @@ ScTemplateResultItem & ScTemplateResultItem::operator=(ScTemplateResultItem cons
     return *this;
 
   m_context = otherItem.m_context;
-  m_replacementConstruction.assign(
-      otherItem.m_replacementConstruction.cbegin(), otherItem.m_replacementConstruction.cend());
-  m_templateItemsNamesToReplacementItemPositions = otherItem.m_templateItemsNamesToReplacementItemPositions;
+  m_replacementConstruction.assign(otherItem.begin(), otherItem.end());
+  m_templateItemsNamesToReplacementItemPositions = otherItem.GetReplacementsPositions();
+  m_replacementConstructionView = nullptr;
+  m_replacementConstructionViewOffset = 0;
+  m_replacementConstructionViewSize = 0;
+  m_templateItemsNamesToReplacementItemPositionsView = nullptr;
 
   return *this;
 }
 
+void ScTemplateResultItem::SetView(
+    ScMemoryContext * context,
+    ScAddrVector const & results,
+    size_t resultsOffset,
+    size_t resultsSize,
+    ScTemplate::ScTemplateItemsToReplacementsItemsPositions const * replacements)
+{
+  m_context = context;
+  m_replacementConstruction.clear();
+  m_templateItemsNamesToReplacementItemPositions.clear();
+  m_replacementConstructionView = &results;
+  m_replacementConstructionViewOffset = resultsOffset;
+  m_replacementConstructionViewSize = resultsSize;
+  m_templateItemsNamesToReplacementItemPositionsView = replacements;
+}
+
+ScAddrVector::const_iterator ScTemplateResultItem::GetReplacementConstruction() const
+{
+  return m_replacementConstructionView != nullptr
+             ? m_replacementConstructionView->cbegin() + m_replacementConstructionViewOffset
+             : m_replacementConstruction.cbegin();
+}
+
+ScTemplate::ScTemplateItemsToReplacementsItemsPositions const & ScTemplateResultItem::GetReplacementsPositions() const
+{
+  return m_templateItemsNamesToReplacementItemPositionsView != nullptr
+             ? *m_templateItemsNamesToReplacementItemPositionsView
+             : m_templateItemsNamesToReplacementItemPositions;
+}
+
 bool ScTemplateResultItem::Get(ScAddr const & varAddr, ScAddr & outAddr) const noexcept
 {
   ScAddr const & addr = GetAddrByVarAddr(varAddr);
@@ -555,7 +601,7 @@ bool ScTemplateResultItem::Get(size_t index, ScAddr & outAddr) const noexcept
 {
   if (index < Size())
   {
-    outAddr = m_replacementConstruction[index];
+    outAddr = GetReplacementConstruction()[index];
     return true;
   }
 
@@ -566,7 +612,7 @@ bool ScTemplateResultItem::Get(size_t index, ScAddr & outAddr) const noexcept
 ScAddr const & ScTemplateResultItem::operator[](size_t index) const noexcept(false)
 {
   if (index < Size())
-    return m_replacementConstruction[index];
+    return GetReplacementConstruction()[index];
 
   SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Index=" << index << " must be < size=" << Size());
 }
@@ -585,36 +631,38 @@ bool ScTemplateResultItem::Has(ScAddr const & varAddr) const noexcept
 
 size_t ScTemplateResultItem::Size() const noexcept
 {
-  return m_replacementConstruction.size();
+  return m_replacementConstructionView != nullptr ? m_replacementConstructionViewSize
+                                                  : m_replacementConstruction.size();
 }
 
 ScAddrVector::const_iterator ScTemplateResultItem::begin() const
 {
-  return m_replacementConstruction.cbegin();
+  return GetReplacementConstruction();
 }
 
 ScAddrVector::const_iterator ScTemplateResultItem::end() const
 {
-  return m_replacementConstruction.cend();
+  return GetReplacementConstruction() + Size();
 }
 
 ScTemplate::ScTemplateItemsToReplacementsItemsPositions const & ScTemplateResultItem::GetReplacements() const noexcept
 {
-  return m_templateItemsNamesToReplacementItemPositions;
+  return GetReplacementsPositions();
 }
 
 ScAddr ScTemplateResultItem::GetAddrByName(std::string const & name) const
 {
-  auto it = m_templateItemsNamesToReplacementItemPositions.find(name);
-  if (it != m_templateItemsNamesToReplacementItemPositions.cend())
-    return m_replacementConstruction[it->second];
+  auto const & replacements = GetReplacementsPositions();
+  auto it = replacements.find(name);
+  if (it != replacements.cend())
+    return GetReplacementConstruction()[it->second];
 
   ScAddr const & addr = m_context->SearchElementBySystemIdentifier(name);
   if (addr.IsValid())
   {
-    it = m_templateItemsNamesToReplacementItemPositions.find(std::to_string(addr.Hash()));
-    if (it != m_templateItemsNamesToReplacementItemPositions.cend())
-      return m_replacementConstruction[it->second];
+    it = replacements.find(std::to_string(addr.Hash()));
+    if (it != replacements.cend())
+      return GetReplacementConstruction()[it->second];
   }
 
   return ScAddr::Empty;
@@ -625,14 +673,15 @@ ScAddr ScTemplateResultItem::GetAddrByVarAddr(ScAddr const & varAddr) const
   if (!varAddr.IsValid())
     return ScAddr::Empty;
 
-  auto it = m_templateItemsNamesToReplacementItemPositions.find(std::to_string(varAddr.Hash()));
-  if (it != m_templateItemsNamesToReplacementItemPositions.cend())
-    return m_replacementConstruction[it->second];
+  auto const & replacements = GetReplacementsPositions();
+  auto it = replacements.find(std::to_string(varAddr.Hash()));
+  if (it != replacements.cend())
+    return GetReplacementConstruction()[it->second];
 
   std::string const & varIdtf = m_context->GetElementSystemIdentifier(varAddr);
-  it = m_templateItemsNamesToReplacementItemPositions.find(varIdtf);
-  if (it != m_templateItemsNamesToReplacementItemPositions.cend())
-    return m_replacementConstruction[it->second];
+  it = replacements.find(varIdtf);
+  if (it != replacements.cend())
+    return GetReplacementConstruction()[it->second];
 
   return ScAddr::Empty;
 }
@@ -643,7 +692,7 @@ ScTemplateSearchResult::ScTemplateSearchResult() noexcept = default;
 
 size_t ScTemplateSearchResult::Size() const noexcept
 {
-  return m_replacementConstructions.size();
+  return m_replacementConstructionSize == 0 ? 0 : m_replacementConstructions.size() / m_replacementConstructionSize;
 }
 
 bool ScTemplateSearchResult::IsEmpty() const noexcept
@@ -655,10 +704,12 @@ bool ScTemplateSearchResult::Get(size_t index, ScTemplateResultItem & outItem) c
 {
   if (index < Size())
   {
-    outItem.m_context = m_context;
-    outItem.m_templateItemsNamesToReplacementItemPositions = m_templateItemsNamesToReplacementItemsPositions;
-    outItem.m_replacementConstruction.assign(
-        m_replacementConstructions[index].cbegin(), m_replacementConstructions[index].cend());
+    outItem.SetView(
+        m_context,
+        m_replacementConstructions,
+        index * m_replacementConstructionSize,
+        m_replacementConstructionSize,
+        &m_templateItemsNamesToReplacementItemsPositions);
     return true;
   }
 
@@ -668,7 +719,13 @@ bool ScTemplateSearchResult::Get(size_t index, ScTemplateResultItem & outItem) c
 ScTemplateResultItem ScTemplateSearchResult::operator[](size_t index) const noexcept(false)
 {
   if (index < Size())
-    return {m_context, m_replacementConstructions[index], m_templateItemsNamesToReplacementItemsPositions};
+  {
+    ScAddr const * replacementConstruction = GetReplacementConstruction(index);
+    return {
+        m_context,
+        ScAddrVector(replacementConstruction, replacementConstruction + m_replacementConstructionSize),
+        m_templateItemsNamesToReplacementItemsPositions};
+  }
 
   SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Index=" << index << " must be < size=" << Size());
 }
@@ -679,6 +736,29 @@ void ScTemplateSearchResult::Clear() noexcept
   m_templateItemsNamesToReplacementItemsPositions.clear();
 }
 
+ScAddrVector const & ScTemplateSearchResult::GetReplacementConstructions() const noexcept
+{
+  return m_replacementConstructions;
+}
+
+ScAddr * ScTemplateSearchResult::GetReplacementConstruction(size_t index) noexcept
+{
+  return m_replacementConstructions.data() + index * m_replacementConstructionSize;
+}
+
+ScAddr const * ScTemplateSearchResult::GetReplacementConstruction(size_t index) const noexcept
+{
+  return m_replacementConstructions.data() + index * m_replacementConstructionSize;
+}
+
+void ScTemplateSearchResult::AppendReplacementConstruction(ScAddr const * replacementConstruction)
+{
+  m_replacementConstructions.insert(
+      m_replacementConstructions.end(),
+      replacementConstruction,
+      replacementConstruction + m_replacementConstructionSize);
+}
+
 ScTemplate::ScTemplateItemsToReplacementsItemsPositions ScTemplateSearchResult::GetReplacements() const noexcept
 {
   ScTemplate::ScTemplateItemsToReplacementsItemsPositions replacementsItemsPositions;
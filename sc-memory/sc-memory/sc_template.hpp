@@ -7,12 +7,17 @@
 #pragma once
 
 #include <functional>
+#include <limits>
+#include <memory>
 
 #include "sc_addr.hpp"
 #include "sc_type.hpp"
 
 #include "sc_utils.hpp"
 
+class ScTemplateSearch;
+class ScTemplateSearchCursor;
+
 /*!
  * @brief Represents an item in object of `ScTemplate`.
  *
@@ -280,6 +285,33 @@ using ScTemplateSearchResultCallbackWithRequest =
 using ScTemplateSearchResultFilterCallback = std::function<bool(ScTemplateResultItem const & resultItem)>;
 using ScTemplateSearchResultCheckCallback = std::function<bool(ScAddr const & addr)>;
 
+/*!
+ * @brief Represents options of search by object of `ScTemplate`.
+ */
+struct _SC_EXTERN ScTemplateSearchOptions
+{
+  /*!
+   * Count of threads to search sc-constructions in. If it is greater than 1, then sc-connectors found for the start
+   * triple of sc-template are divided between threads. Callbacks of found sc-constructions are called by one thread at
+   * a time. If filter or check callbacks are passed, then search is done in one thread.
+   */
+  size_t m_threadsCount = 1;
+
+  /*!
+   * A sc-address of sc-structure. If it is valid, then only sc-constructions which all sc-elements belong to this
+   * sc-structure are found.
+   */
+  ScAddr m_structureAddr;
+
+  /*!
+   * If it is true, then sc-templates with cycles between variable sources and targets of triples are searched by join:
+   * sc-elements adjacent to already found sc-elements by several triples are intersected instead of iterating triples
+   * one by one. It is used only if all sc-connectors of sc-template are variable sc-arcs that aren't sources or targets
+   * of other triples and each variable can be reached from fixed sc-elements.
+   */
+  bool m_isJoinEnabled = true;
+};
+
 /*!
  * @brief Represents a program object of sc-template used for generating and searching sc-elements in sc-memory.
  *
@@ -294,6 +326,7 @@ class _SC_EXTERN ScTemplate
   friend class ScTemplateBuilder;
   friend class ScTemplateBuilderFromScs;
   friend class ScTemplateLoader;
+  friend class ScTemplateSubscription;
 
 public:
   /*!
@@ -479,10 +512,14 @@ protected:
    *
    * @param context A sc-memory context.
    * @param result A result item to store the found elements.
+   * @param options Optional search options.
    * @return A result of the search.
    * @throws utils::ExceptionInvalidParams if the parameters are invalid.
    */
-  Result Search(ScMemoryContext & context, ScTemplateSearchResult & result) const noexcept(false);
+  Result Search(
+      ScMemoryContext & context,
+      ScTemplateSearchResult & result,
+      ScTemplateSearchOptions const & options = ScTemplateSearchOptions()) const noexcept(false);
 
   /*!
    * @brief Searches for sc-elements by object of `ScTemplate` with callbacks.
@@ -491,13 +528,15 @@ protected:
    * @param callback A callback to handle the search results.
    * @param filterCallback Optional filter callback.
    * @param checkCallback Optional check callback.
+   * @param options Optional search options.
    * @throws utils::ExceptionInvalidParams if the parameters are invalid.
    */
   void Search(
       ScMemoryContext & context,
       ScTemplateSearchResultCallback const & callback,
       ScTemplateSearchResultFilterCallback const & filterCallback = {},
-      ScTemplateSearchResultCheckCallback const & checkCallback = {}) const noexcept(false);
+      ScTemplateSearchResultCheckCallback const & checkCallback = {},
+      ScTemplateSearchOptions const & options = ScTemplateSearchOptions()) const noexcept(false);
 
   /*!
    * @brief Searches for sc-elements by object of `ScTemplate` with request callbacks.
@@ -506,13 +545,74 @@ protected:
    * @param callback A callback to handle the search results with requests.
    * @param filterCallback Optional filter callback.
    * @param checkCallback Optional check callback.
+   * @param options Optional search options.
    * @throws utils::ExceptionInvalidParams if the parameters are invalid.
    */
   void Search(
       ScMemoryContext & context,
       ScTemplateSearchResultCallbackWithRequest const & callback,
       ScTemplateSearchResultFilterCallback const & filterCallback = {},
-      ScTemplateSearchResultCheckCallback const & checkCallback = {}) const noexcept(false);
+      ScTemplateSearchResultCheckCallback const & checkCallback = {},
+      ScTemplateSearchOptions const & options = ScTemplateSearchOptions()) const noexcept(false);
+
+  /*!
+   * @brief Describes plan of search by object of `ScTemplate`.
+   *
+   * @param context A sc-memory context.
+   * @return A text that describes connectivity components of sc-template, triples search starts from, order of search
+   * by other triples and estimated counts of sc-connectors iterated by triples.
+   * @throws utils::ExceptionInvalidState if sc-memory context has no read permissions.
+   */
+  std::string ExplainSearch(ScMemoryContext & context) const noexcept(false);
+
+  /*!
+   * @brief Creates cursor to search sc-constructions by object of `ScTemplate` one by one.
+   *
+   * @param context A sc-memory context.
+   * @param offset A count of found sc-constructions to be skipped.
+   * @param limit A maximum count of sc-constructions to be found.
+   * @return A cursor of search.
+   * @throws utils::ExceptionInvalidState if sc-memory context has no read permissions.
+   */
+  ScTemplateSearchCursor CreateSearchCursor(ScMemoryContext & context, size_t offset, size_t limit) const
+      noexcept(false);
+
+  /*!
+   * @brief Searches for sc-elements by several objects of `ScTemplate` in one pass.
+   *
+   * @param context A sc-memory context.
+   * @param templates Objects of `ScTemplate` to search by.
+   * @param results [out] Results of search by each object of `ScTemplate` in the same order.
+   * @throws utils::ExceptionInvalidState if sc-memory context has no read permissions.
+   */
+  static void SearchBatch(
+      ScMemoryContext & context,
+      std::vector<ScTemplate const *> const & templates,
+      std::vector<ScTemplateSearchResult> & results) noexcept(false);
+
+  /*!
+   * @brief Collects fixed sc-elements incident to sc-connectors of all triples of `ScTemplate`.
+   *
+   * @param context A sc-memory context.
+   * @param elementsAddrs [out] Fixed sources of triples or fixed targets of triples without fixed sources.
+   * @return false if there is triple without fixed source and target, true otherwise.
+   */
+  bool CollectTriplesFixedElements(ScMemoryContext & context, ScAddrUnorderedSet & elementsAddrs) const;
+
+  /*!
+   * @brief Searches for sc-constructions by object of `ScTemplate` that contain specified sc-connector.
+   *
+   * @param context A sc-memory context.
+   * @param connectorAddr A sc-address of sc-connector which found sc-constructions must contain.
+   * @param connectorType A sc-type of sc-connector.
+   * @param callback A callback to handle found sc-constructions.
+   * @throws utils::ExceptionInvalidState if sc-memory context has no read permissions.
+   */
+  void SearchByConnector(
+      ScMemoryContext & context,
+      ScAddr const & connectorAddr,
+      ScType const & connectorType,
+      ScTemplateSearchResultCallback const & callback) const noexcept(false);
 
   /*!
    * @brief Translates a sc-template in sc-memory (sc-structure) into object of `ScTemplate`.
@@ -589,6 +689,12 @@ protected:
  *
  * ScTemplateResultItem is used to store and manage the results of sc-template operations, providing access to the found
  * sc-elements.
+ *
+ * @note Items got by `ScTemplateSearchResult::Get`, passed to `ScTemplateSearchResult::ForEach`, got from
+ * `ScTemplateSearchCursor` and passed to search callbacks don't own found sc-elements, they are views into storage of
+ * search. Such item is valid while search result isn't changed or destroyed, while cursor isn't moved to next
+ * sc-construction or while callback is called. Items returned by `ScTemplateSearchResult::operator[]` and copies of
+ * items own found sc-elements.
  */
 class _SC_EXTERN ScTemplateResultItem
 {
@@ -596,6 +702,7 @@ class _SC_EXTERN ScTemplateResultItem
   friend class ScSet;
   friend class ScTemplateSearch;
   friend class ScTemplateSearchResult;
+  friend class ScTemplateSearchCursor;
 
 public:
   _SC_EXTERN ScTemplateResultItem();
@@ -697,19 +804,45 @@ protected:
       ScMemoryContext * context,
       ScAddrVector results,
       ScTemplate::ScTemplateItemsToReplacementsItemsPositions replacements);
+  ScTemplateResultItem(
+      ScMemoryContext * context,
+      ScAddrVector const & results,
+      size_t resultsOffset,
+      size_t resultsSize,
+      ScTemplate::ScTemplateItemsToReplacementsItemsPositions const * replacements);
   _SC_EXTERN ScTemplateResultItem(
       ScMemoryContext * context,
       ScTemplate::ScTemplateItemsToReplacementsItemsPositions replacements);
 
+  /*!
+   * @brief Makes item a view into found sc-elements and replacements stored by other object.
+   */
+  void SetView(
+      ScMemoryContext * context,
+      ScAddrVector const & results,
+      size_t resultsOffset,
+      size_t resultsSize,
+      ScTemplate::ScTemplateItemsToReplacementsItemsPositions const * replacements);
+
+  ScAddrVector::const_iterator GetReplacementConstruction() const;
+
+  ScTemplate::ScTemplateItemsToReplacementsItemsPositions const & GetReplacementsPositions() const;
+
   ScAddr GetAddrByName(std::string const & name) const;
 
   ScAddr GetAddrByVarAddr(ScAddr const & varAddr) const;
 
   ScMemoryContext * m_context;
 
-  ScAddrVector m_replacementConstruction;  ///< A vector of sc-addresses that are results.
+  ScAddrVector m_replacementConstruction;  ///< A vector of sc-addresses that are results, if item owns them.
   ScTemplate::ScTemplateItemsToReplacementsItemsPositions
       m_templateItemsNamesToReplacementItemPositions;  ///< A map of template items to replacement item positions.
+
+  ScAddrVector const * m_replacementConstructionView = nullptr;  ///< A storage of results, if item is a view.
+  size_t m_replacementConstructionViewOffset = 0;  ///< A position of the first sc-address of results in view.
+  size_t m_replacementConstructionViewSize = 0;    ///< A count of sc-addresses that are results in view.
+  ScTemplate::ScTemplateItemsToReplacementsItemsPositions const * m_templateItemsNamesToReplacementItemPositionsView =
+      nullptr;  ///< A pointer to map of template items to replacement item positions, if item is a view.
 };
 
 using ScTemplateGenResult = ScTemplateResultItem;
@@ -724,6 +857,7 @@ using ScTemplateSearchResultItem = ScTemplateResultItem;
 class _SC_EXTERN ScTemplateSearchResult
 {
   friend class ScTemplateSearch;
+  friend class ScTemplateBatchSearch;
 
 public:
   _SC_EXTERN ScTemplateSearchResult() noexcept;
@@ -781,14 +915,90 @@ public:
   template <typename FnT>
   _SC_EXTERN void ForEach(FnT && f) noexcept
   {
-    for (auto & res : m_replacementConstructions)
-      f(ScTemplateResultItem{m_context, res, m_templateItemsNamesToReplacementItemsPositions});
+    for (size_t index = 0; index < Size(); ++index)
+      f(ScTemplateResultItem{
+          m_context,
+          m_replacementConstructions,
+          index * m_replacementConstructionSize,
+          m_replacementConstructionSize,
+          &m_templateItemsNamesToReplacementItemsPositions});
   }
 
+  /*!
+   * @brief Gets all found sc-elements. Found constructions are stored one after another, each of them has three
+   * sc-elements for each triple of sc-template.
+   *
+   * @return A vector of sc-addresses of all found constructions.
+   */
+  _SC_EXTERN ScAddrVector const & GetReplacementConstructions() const noexcept;
+
 protected:
+  ScAddr * GetReplacementConstruction(size_t index) noexcept;
+
+  ScAddr const * GetReplacementConstruction(size_t index) const noexcept;
+
+  void AppendReplacementConstruction(ScAddr const * replacementConstruction);
+
   ScMemoryContext * m_context = nullptr;
-  using SearchResults = std::vector<ScAddrVector>;
-  SearchResults m_replacementConstructions;  ///< A vector of replacement constructions.
+  size_t m_replacementConstructionSize = 0;  ///< A count of sc-addresses in one replacement construction.
+  ScAddrVector m_replacementConstructions;   ///< A buffer of all replacement constructions stored one after another.
   ScTemplate::ScTemplateItemsToReplacementsItemsPositions
       m_templateItemsNamesToReplacementItemsPositions;  ///< A map of template items to replacement item positions.
 };
+
+/*!
+ * @brief Represents a cursor of search by object of `ScTemplate`.
+ *
+ * ScTemplateSearchCursor finds next sc-construction only when `Next` is called and doesn't store found
+ * sc-constructions, so memory used by it depends only on size of sc-template. Triples of sc-template are searched in
+ * order of search plan, each next triple is searched by sc-elements found for previous ones.
+ *
+ * @note Order of found sc-constructions may differ from order of `ScMemoryContext::SearchByTemplate`. Cursor must not
+ * be used after sc-memory context it is created with is destroyed.
+ */
+class _SC_EXTERN ScTemplateSearchCursor
+{
+  friend class ScTemplate;
+
+public:
+  static constexpr size_t NO_LIMIT = std::numeric_limits<size_t>::max();
+
+  _SC_EXTERN ScTemplateSearchCursor(ScTemplateSearchCursor && other) noexcept;
+
+  _SC_EXTERN ScTemplateSearchCursor & operator=(ScTemplateSearchCursor && other) noexcept;
+
+  _SC_EXTERN ~ScTemplateSearchCursor();
+
+  /*!
+   * @brief Finds next sc-construction.
+   *
+   * @param outItem [out] A found sc-construction.
+   * @return true if next sc-construction is found, false if all sc-constructions have been found or limit of cursor is
+   * reached.
+   * @throws utils::ExceptionInvalidState if sc-template has triples without fixed sc-elements to start search from.
+   */
+  _SC_EXTERN bool Next(ScTemplateResultItem & outItem) noexcept(false);
+
+  /*!
+   * @brief Gets count of sc-constructions found by `Next`, skipped ones are not counted.
+   *
+   * @return Count of found sc-constructions.
+   */
+  _SC_EXTERN size_t GetFoundCount() const noexcept;
+
+  /*!
+   * @brief Gets the map of template items to replacement item positions in found sc-constructions.
+   *
+   * @return A map of template items to replacement item positions.
+   */
+  _SC_EXTERN ScTemplate::ScTemplateItemsToReplacementsItemsPositions const & GetReplacements() const noexcept;
+
+protected:
+  ScTemplateSearchCursor(std::unique_ptr<ScTemplateSearch> search, size_t offset, size_t limit);
+
+  std::unique_ptr<ScTemplateSearch> m_search;  ///< A compiled search which state is a state of cursor.
+  size_t m_offset;                             ///< A count of sc-constructions to be skipped.
+  size_t m_limit;                              ///< A maximum count of sc-constructions to be found.
+  size_t m_skippedCount = 0;                   ///< A count of skipped sc-constructions.
+  size_t m_foundCount = 0;                     ///< A count of found sc-constructions.
+};
@@ -6,6 +6,8 @@
 
 #include "sc_template.hpp"
 
+#include <limits>
+
 #include "sc_template_private.hpp"
 #include "sc_memory.hpp"
 
@@ -26,6 +28,11 @@ public:
   {
   }
 
+  /*!
+   * Generates sc-construction by sc-template in two passes. At first, all triples are checked and sc-elements to be
+   * generated are planned, so nothing is generated for incorrect sc-template. Then all sc-nodes and sc-links are
+   * generated at once and sc-connectors are generated between them.
+   */
   ScTemplateResultCode operator()(ScTemplateGenResult & result)
   {
     // TODO: Add blocking constant sc-structure
@@ -36,24 +43,53 @@ public:
     result = ScTemplateResultItem{&m_context, m_replacements};
     result.m_replacementConstruction.resize(m_triples.size() * 3);
 
-    ScAddrVector generatedElements;
-    size_t resultIdx = 0;
+    PlanGeneration(result.m_replacementConstruction);
+    GenerateNodesAndLinks(result.m_replacementConstruction);
+    GenerateConnectors(result.m_replacementConstruction);
+
+    return ScTemplateResultCode::Success;
+  }
+
+  void CleanupCreatedElements()
+  {
+    for (auto & m_generatedElement : m_generatedElements)
+      m_context.EraseElement(m_generatedElement);
+    m_generatedElements.clear();
+  }
 
-    for (auto const & triple : m_triples)
+private:
+  static constexpr size_t NO_POSITION = std::numeric_limits<size_t>::max();
+
+  /*!
+   * Resolves sc-elements of all triples without generating them. Found sc-elements are stored in `resultAddrs`, for
+   * positions of sc-elements to be generated positions where they are generated at first are stored.
+   */
+  void PlanGeneration(ScAddrVector & resultAddrs)
+  {
+    m_generatedPositions.assign(resultAddrs.size(), NO_POSITION);
+    m_nodesAndLinksPositions.clear();
+    m_nodesAndLinksTypes.clear();
+    m_connectorsPositions.clear();
+
+    for (size_t tripleIdx = 0; tripleIdx < m_triples.size(); ++tripleIdx)
     {
-      auto const & items = triple->GetValues();
+      auto const & items = m_triples[tripleIdx]->GetValues();
       ScTemplateItem const & sourceItem = items[0];
       ScTemplateItem const & connectorItem = items[1];
       ScTemplateItem const & targetItem = items[2];
 
+      size_t const sourcePosition = tripleIdx * 3;
+      size_t const connectorPosition = sourcePosition + 1;
+      size_t const targetPosition = sourcePosition + 2;
+
       if (sourceItem.IsType() && sourceItem.m_typeValue.IsUnknown())
         SC_THROW_EXCEPTION(
             utils::ExceptionInvalidParams,
             "You can't generate sc-element with unknown sc-type as the first item of triple "
                 << sourceItem.GetPrettyName() << ".");
 
-      ScAddr sourceAddr = TryFindElementReplacement(sourceItem, result.m_replacementConstruction);
-      if (sourceItem.IsType() && sourceItem.m_typeValue.IsEdge() && !sourceAddr.IsValid())
+      bool const isSourceFound = PlanElementReplacement(sourceItem, sourcePosition, resultAddrs);
+      if (sourceItem.IsType() && sourceItem.m_typeValue.IsEdge() && !isSourceFound)
         SC_THROW_EXCEPTION(
             utils::ExceptionInvalidParams,
             "You can't generate sc-connector as the first item of triple "
@@ -67,8 +103,8 @@ public:
             "You can't generate sc-element with unknown sc-type as the third item of triple "
                 << targetItem.GetPrettyName() << ".");
 
-      ScAddr targetAddr = TryFindElementReplacement(targetItem, result.m_replacementConstruction);
-      if (targetItem.IsType() && targetItem.m_typeValue.IsEdge() && !targetAddr.IsValid())
+      bool const isTargetFound = PlanElementReplacement(targetItem, targetPosition, resultAddrs);
+      if (targetItem.IsType() && targetItem.m_typeValue.IsEdge() && !isTargetFound)
         SC_THROW_EXCEPTION(
             utils::ExceptionInvalidParams,
             "You can't generate sc-connector as the third item of triple "
@@ -82,53 +118,108 @@ public:
             "You can't generate sc-element with unknown sc-type as the second item of triple "
                 << connectorItem.GetPrettyName() << ".");
 
-      ScAddr connectorAddr = TryFindElementReplacement(connectorItem, result.m_replacementConstruction);
-      if (connectorAddr.IsValid())
-        CheckIncidenceBetweenConnectorAndIncidentElements(connectorItem, connectorAddr, sourceItem, targetItem);
-
-      if (connectorAddr.IsValid())
+      if (PlanElementReplacement(connectorItem, connectorPosition, resultAddrs))
       {
-        auto [firstIncidentElementAddr, secondIncidentElementAddr] =
-            m_context.GetConnectorIncidentElements(connectorAddr);
-        sourceAddr = firstIncidentElementAddr;
-        targetAddr = secondIncidentElementAddr;
+        size_t const generatedConnectorPosition = m_generatedPositions[connectorPosition];
+        if (generatedConnectorPosition == NO_POSITION)
+        {
+          ScAddr const & connectorAddr = resultAddrs[connectorPosition];
+          CheckIncidenceBetweenConnectorAndIncidentElements(connectorItem, connectorAddr, sourceItem, targetItem);
+
+          auto const [sourceAddr, targetAddr] = m_context.GetConnectorIncidentElements(connectorAddr);
+          resultAddrs[sourcePosition] = sourceAddr;
+          resultAddrs[targetPosition] = targetAddr;
+          m_generatedPositions[sourcePosition] = NO_POSITION;
+          m_generatedPositions[targetPosition] = NO_POSITION;
+        }
+        else
+        {
+          // sc-connector to be generated in previous triple has the same incident sc-elements
+          m_generatedPositions[sourcePosition] = m_generatedPositions[generatedConnectorPosition - 1];
+          m_generatedPositions[targetPosition] = m_generatedPositions[generatedConnectorPosition + 1];
+          resultAddrs[sourcePosition] = resultAddrs[generatedConnectorPosition - 1];
+          resultAddrs[targetPosition] = resultAddrs[generatedConnectorPosition + 1];
+        }
+        continue;
       }
 
-      if (!sourceAddr.IsValid())
-        sourceAddr = GenerateNodeOrLink(sourceItem.m_typeValue.UpConstType());
-      if (!targetAddr.IsValid())
-        targetAddr = GenerateNodeOrLink(targetItem.m_typeValue.UpConstType());
+      if (!isSourceFound)
+        PlanNodeOrLink(sourceItem.m_typeValue.UpConstType(), sourcePosition);
+      if (!isTargetFound)
+        PlanNodeOrLink(targetItem.m_typeValue.UpConstType(), targetPosition);
 
-      if (!connectorAddr.IsValid())
-        connectorAddr = GenerateConnector(connectorItem.m_typeValue.UpConstType(), sourceAddr, targetAddr);
+      m_generatedPositions[connectorPosition] = connectorPosition;
+      m_connectorsPositions.push_back(connectorPosition);
+    }
+  }
 
-      result.m_replacementConstruction[resultIdx++] = sourceAddr;
-      result.m_replacementConstruction[resultIdx++] = connectorAddr;
-      result.m_replacementConstruction[resultIdx++] = targetAddr;
+  /*!
+   * Finds sc-element for item in parameters, fixed sc-addresses or previous triples. Returns true if sc-element exists
+   * or is planned to be generated in previous triples.
+   */
+  bool PlanElementReplacement(ScTemplateItem const & item, size_t const position, ScAddrVector & resultAddrs)
+  {
+    ScAddr const & addr = TryFindElementReplacement(item, resultAddrs);
+    if (addr.IsValid())
+    {
+      resultAddrs[position] = addr;
+      return true;
     }
 
-    return ScTemplateResultCode::Success;
+    if (item.IsReplacement())
+    {
+      auto const it = m_replacements.find(item.m_name);
+      if (it != m_replacements.cend() && m_generatedPositions[it->second] != NO_POSITION)
+      {
+        m_generatedPositions[position] = m_generatedPositions[it->second];
+        return true;
+      }
+    }
+
+    return false;
   }
 
-  void CleanupCreatedElements()
+  void PlanNodeOrLink(ScType const & type, size_t const position)
   {
-    for (auto & m_generatedElement : m_generatedElements)
-      m_context.EraseElement(m_generatedElement);
-    m_generatedElements.clear();
+    m_generatedPositions[position] = position;
+    m_nodesAndLinksPositions.push_back(position);
+    m_nodesAndLinksTypes.push_back(*type);
   }
 
-private:
-  ScAddr GenerateNodeOrLink(ScType const & type)
+  void GenerateNodesAndLinks(ScAddrVector & resultAddrs)
   {
-    ScAddr addr;
-    if (type.IsLink())
-      addr = m_context.GenerateLink(type);
-    else
-      addr = m_context.GenerateNode(type);
+    if (m_nodesAndLinksTypes.empty())
+      return;
 
-    m_generatedElements.push_back(addr);
+    m_context.GenerateNodesAndLinks(m_nodesAndLinksTypes, m_nodesAndLinksAddrs);
+    for (size_t i = 0; i < m_nodesAndLinksPositions.size(); ++i)
+    {
+      ScAddr const addr = m_nodesAndLinksAddrs[i];
+      resultAddrs[m_nodesAndLinksPositions[i]] = addr;
+      m_generatedElements.push_back(addr);
+    }
+  }
 
-    return addr;
+  void GenerateConnectors(ScAddrVector & resultAddrs)
+  {
+    auto const & ResolveAddr = [&](size_t const position) -> ScAddr const &
+    {
+      size_t const generatedPosition = m_generatedPositions[position];
+      return generatedPosition == NO_POSITION ? resultAddrs[position] : resultAddrs[generatedPosition];
+    };
+
+    // sc-connectors can be incident to sc-connectors of previous triples only, so they are generated in triples order
+    for (size_t const connectorPosition : m_connectorsPositions)
+    {
+      ScTemplateItem const & connectorItem = (*m_triples[connectorPosition / 3])[1];
+      resultAddrs[connectorPosition] = GenerateConnector(
+          connectorItem.m_typeValue.UpConstType(),
+          ResolveAddr(connectorPosition - 1),
+          ResolveAddr(connectorPosition + 1));
+    }
+
+    for (size_t position = 0; position < resultAddrs.size(); ++position)
+      resultAddrs[position] = ResolveAddr(position);
   }
 
   ScAddr GenerateConnector(ScType const & type, ScAddr const & sourceAddr, ScAddr const & targetAddr)
@@ -331,7 +422,14 @@ private:
   ScTemplate::ScTemplateTriplesVector const & m_triples;
   ScTemplateParams const & m_params;
   ScMemoryContext & m_context;
-  ScAddrList m_generatedElements;
+  ScAddrVector m_generatedElements;
+
+  // fields of generation plan
+  std::vector<size_t> m_generatedPositions;  ///< Positions where sc-elements to be generated are generated at first.
+  std::vector<size_t> m_nodesAndLinksPositions;
+  std::vector<sc_type> m_nodesAndLinksTypes;
+  std::vector<sc_addr> m_nodesAndLinksAddrs;
+  std::vector<size_t> m_connectorsPositions;
 };
 
 ScTemplate::Result ScTemplate::Generate(
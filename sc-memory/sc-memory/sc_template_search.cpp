@@ -7,12 +7,27 @@
 #include "sc_template.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
 
 #include "sc_template_private.hpp"
 #include "sc_memory.hpp"
 
+extern "C"
+{
+#include "sc-core/sc-store/sc-base/sc_metrics.h"
+}
+
 class ScTemplateSearch
 {
+  friend class ScTemplateBatchSearch;
+
 public:
   ScTemplateSearch(ScTemplate & templ, ScMemoryContext & context, ScAddr const & structure)
     : m_template(templ)
@@ -22,7 +37,70 @@ public:
     PrepareSearch();
   }
 
+  /*!
+   * Creates search of sc-constructions that contain specified sc-connector as the second item of triple with specified
+   * index. The sc-connector and its incident sc-elements are fixed in compiled sc-template, so search plan starts from
+   * this triple.
+   */
+  ScTemplateSearch(
+      ScTemplate & templ,
+      ScMemoryContext & context,
+      size_t const tripleIdx,
+      ScAddr const & connectorAddr,
+      ScType const & connectorType)
+    : m_template(templ)
+    , m_context(context)
+  {
+    CompileTemplate();
+
+    auto & items = m_triples[tripleIdx].m_items;
+    m_isConnectorMatched =
+        !GetFixedAddr(items[1]).IsValid() && sc_type_has_subtype(*connectorType, *items[1].m_iteratorType);
+    if (!m_isConnectorMatched)
+      return;
+
+    // ends of sc-edge can be found in any order, so only ends of sc-arc are fixed
+    if (!(*connectorType & sc_type_edge_common))
+    {
+      auto const [sourceAddr, targetAddr] = m_context.GetConnectorIncidentElements(connectorAddr);
+      m_isConnectorMatched = PinItem(items[0], sourceAddr) && PinItem(items[2], targetAddr);
+      if (!m_isConnectorMatched)
+        return;
+    }
+
+    items[1].m_itemType = ScTemplateItem::Type::Addr;
+    items[1].m_addr = connectorAddr;
+    PreparePlan();
+  }
+
+  /*!
+   * Creates search by already compiled plan of other search. It is used to search sc-constructions by part of
+   * sc-connectors of start triple in other thread with own sc-memory context.
+   */
+  ScTemplateSearch(ScTemplateSearch const & other, ScMemoryContext & context)
+    : m_template(other.m_template)
+    , m_context(context)
+    , m_slotsNames(other.m_slotsNames)
+    , m_triples(other.m_triples)
+    , m_equalTriplesItems(other.m_equalTriplesItems)
+    , m_connectivityComponentsTemplateTriples(other.m_connectivityComponentsTemplateTriples)
+    , m_connectivityComponentPriorityTemplateTriples(other.m_connectivityComponentPriorityTemplateTriples)
+    , m_startTemplateTriples(other.m_startTemplateTriples)
+    , m_joinTriples(other.m_joinTriples)
+    , m_joinSteps(other.m_joinSteps)
+    , m_joinFixedTriples(other.m_joinFixedTriples)
+    , m_joinVariablesCount(other.m_joinVariablesCount)
+    , m_isJoinEnabled(other.m_isJoinEnabled)
+    , m_structure(other.m_structure)
+    , m_callback(other.m_callback)
+    , m_callbackWithRequest(other.m_callbackWithRequest)
+    , m_filterCallback(other.m_filterCallback)
+    , m_checkCallback(other.m_checkCallback)
+  {
+  }
+
   using ScTemplateTriples = ScTemplate::ScTemplateGroupedTriples;
+  using ScTemplateTriplesIndices = std::vector<size_t>;
   using ScReplacementTriple = ScAddrTriple;
 
   void SetCallbackWithRequest(ScTemplateSearchResultCallbackWithRequest const & callback)
@@ -45,163 +123,446 @@ public:
     m_checkCallback = checkCallback;
   }
 
+  void SetJoinEnabled(bool const isJoinEnabled)
+  {
+    m_isJoinEnabled = isJoinEnabled;
+  }
+
 private:
+  static constexpr size_t NO_SLOT = std::numeric_limits<size_t>::max();
+  static constexpr size_t NO_POSITION = std::numeric_limits<size_t>::max();
+  static constexpr size_t UNKNOWN_CARDINALITY = std::numeric_limits<size_t>::max();
+  static constexpr size_t NO_VARIABLE = std::numeric_limits<size_t>::max();
+  static constexpr size_t NO_TRIPLE = std::numeric_limits<size_t>::max();
+
+  /*!
+   * Compiled sc-template item. Replacement name of item is numbered as slot, sc-address and sc-type specified for this
+   * replacement name in sc-template are resolved before search.
+   */
+  struct ScTemplateSearchItem
+  {
+    ScTemplateItem::Type m_itemType = ScTemplateItem::Type::Type;
+    size_t m_slot = NO_SLOT;     ///< Slot of item replacement name or `NO_SLOT` if item has no replacement name.
+    size_t m_dependenceIdx = 0;  ///< Index of the first item in triple with the same slot.
+    ScAddr m_addr;               ///< Item sc-address specified in sc-template.
+    ScType m_type;               ///< Item sc-type specified in sc-template.
+    bool m_hasReplacementAddr = false;
+    ScAddr m_replacementAddr;  ///< sc-address specified in sc-template for item replacement name.
+    bool m_hasReplacementType = false;
+    ScType m_replacementType;  ///< sc-type specified in sc-template for item replacement name.
+    ScType m_iteratorType;     ///< sc-type used to iterate sc-elements for item.
+  };
+
+  /*!
+   * Compiled sc-template triple. Triples depended on items of triple are stored as index arrays.
+   */
+  struct ScTemplateSearchTriple
+  {
+    size_t m_index = 0;
+    size_t m_priority = 0;  ///< Priority of triple type in sc-template.
+    /// Estimated count of sc-connectors iterated by triple if only its fixed items are known.
+    size_t m_cardinality = UNKNOWN_CARDINALITY;
+    size_t m_typeCardinality = UNKNOWN_CARDINALITY;  ///< Count of sc-connectors with sc-type of triple sc-connector.
+    std::array<ScTemplateSearchItem, 3> m_items;
+    std::array<ScTemplateTriplesIndices, 3> m_dependedTriples;
+  };
+
+  /*!
+   * Triple in search by join. Sources and targets of triples that aren't fixed are numbered as variables. Sc-elements
+   * adjacent to the bound item of triple are collected and sorted to intersect them.
+   */
+  struct ScTemplateJoinTriple
+  {
+    std::array<size_t, 2> m_variables = {NO_VARIABLE, NO_VARIABLE};  ///< Variables of source and target.
+    size_t m_boundItemIdx = 0;  ///< Index of item which sc-element is known when triple is iterated.
+    size_t m_equalTripleIdx = NO_TRIPLE;  ///< Previous equal triple with the same variables of source and target.
+  };
+
+  /*!
+   * Step of search by join. Candidates of step variable are intersection of sc-elements adjacent to already known
+   * sc-elements by triples of the step.
+   */
+  struct ScTemplateJoinStep
+  {
+    size_t m_variable = NO_VARIABLE;
+    ScTemplateTriplesIndices m_triples;      ///< Triples which items other than variable are known.
+    ScTemplateTriplesIndices m_loopTriples;  ///< Triples which source and target are variable.
+  };
+
+  struct ScTemplateJoinAdjacentElement
+  {
+    ScAddr::HashType m_elementHash;
+    ScAddr m_elementAddr;
+    ScAddr m_connectorAddr;
+  };
+
+  using ScTemplateJoinAdjacentElements = std::vector<ScTemplateJoinAdjacentElement>;
+
   /*!
    * Prepares input sc-template to minimize search
    */
   void PrepareSearch()
   {
+    SC_METRICS_START(startTime);
+    CompileTemplate();
+    PreparePlan();
+    SC_METRICS_RECORD(SC_METRIC_TEMPLATE_SEARCH_PREPARE, startTime);
+  }
+
+  void PreparePlan()
+  {
+    EstimateTriplesCardinalities();
+
     if (m_template.Size() == 1)
+    {
+      m_connectivityComponentsTemplateTriples = {{0}};
+      m_startTemplateTriples = {0};
       return;
+    }
 
+    EstimateTriplesCardinalitiesByTypes();
     SetUpDependenciesBetweenTriples();
     RemoveCycledDependenciesBetweenTriples();
+    CompileDependenciesBetweenTriples();
+    OrderDependedTriplesByCardinalities();
     FindConnectivityComponents();
-    FindTriplesWithMostMinimalArcsForFirstItem();
+    FindTriplesWithMinimalCardinalities();
+
+    m_startTemplateTriples.assign(
+        m_connectivityComponentPriorityTemplateTriples.cbegin(), m_connectivityComponentPriorityTemplateTriples.cend());
+
+    PrepareJoin();
   }
 
   /*!
-   * Find all dependencies between triples. Compares replacement name of each item of the triple
-   * with replacement name of each item of the other triple, and if they are equal, then adds
-   * dependencies between them.
-   * @note All triple items that have valid address must have replacement names to set up dependencies with them.
+   * Compiles input sc-template into dense plan. Replacement names of sc-template items are numbered as slots, sc-types
+   * and sc-addresses specified for replacement names are resolved once, so search doesn't look up anything by names.
    */
-  void SetUpDependenciesBetweenTriples()
+  void CompileTemplate()
   {
-    auto const & AddDependenceFromTripleItemToOtherTriple =
-        [this](ScTemplateTriple const * triple, ScTemplateItem const & tripleItem, ScTemplateTriple const * otherTriple)
+    std::unordered_map<std::string, size_t> replacementNamesToSlots;
+
+    m_triples.resize(m_template.Size());
+    for (ScTemplateTriple const * templateTriple : m_template.m_templateTriples)
+    {
+      ScTemplateSearchTriple & triple = m_triples[templateTriple->m_index];
+      triple.m_index = templateTriple->m_index;
+
+      for (size_t i = 0; i < triple.m_items.size(); ++i)
+      {
+        ScTemplateItem const & templateItem = (*templateTriple)[i];
+        ScTemplateSearchItem & item = triple.m_items[i];
+        item.m_itemType = templateItem.m_itemType;
+        item.m_addr = templateItem.m_addrValue;
+        item.m_type = templateItem.m_typeValue;
+        item.m_dependenceIdx = i;
+
+        if (!templateItem.m_name.empty())
+        {
+          auto const [slotIt, isInserted] = replacementNamesToSlots.insert({templateItem.m_name, m_slotsNames.size()});
+          if (isInserted)
+            m_slotsNames.push_back(templateItem.m_name);
+          item.m_slot = slotIt->second;
+
+          auto const & addrIt = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(templateItem.m_name);
+          if (addrIt != m_template.m_templateItemsNamesToReplacementItemsAddrs.cend())
+          {
+            item.m_hasReplacementAddr = true;
+            item.m_replacementAddr = addrIt->second;
+          }
+
+          auto const & typeIt = m_template.m_templateItemsNamesToTypes.find(templateItem.m_name);
+          if (typeIt != m_template.m_templateItemsNamesToTypes.cend())
+          {
+            item.m_hasReplacementType = true;
+            item.m_replacementType = typeIt->second;
+          }
+
+          // items with the same slot in triple share dependencies
+          for (size_t j = 0; j < i; ++j)
+          {
+            if (triple.m_items[j].m_slot == item.m_slot)
+            {
+              item.m_dependenceIdx = j;
+              break;
+            }
+          }
+        }
+
+        ScType const & type = item.m_hasReplacementType ? item.m_replacementType : item.m_type;
+        item.m_iteratorType = type.HasConstancyFlag() ? type.UpConstType() : type;
+      }
+    }
+
+    for (size_t priority = 0; priority < m_template.m_priorityOrderedTemplateTriples.size(); ++priority)
+    {
+      for (size_t const tripleIdx : m_template.m_priorityOrderedTemplateTriples[priority])
+        m_triples[tripleIdx].m_priority = priority;
+    }
+
+    CompileTriplesEquality();
+  }
+
+  static ScAddr const & GetFixedAddr(ScTemplateSearchItem const & item)
+  {
+    if (item.m_itemType == ScTemplateItem::Type::Addr)
+      return item.m_addr;
+
+    if (item.m_itemType == ScTemplateItem::Type::Replace && item.m_hasReplacementAddr)
+      return item.m_replacementAddr;
+
+    return ScAddr::Empty;
+  }
+
+  /*!
+   * Fixes sc-element in item if it isn't fixed yet and has suitable sc-type. Returns false if sc-element can't be
+   * found by item.
+   */
+  bool PinItem(ScTemplateSearchItem & item, ScAddr const & elementAddr) const
+  {
+    ScAddr const & fixedAddr = GetFixedAddr(item);
+    if (fixedAddr.IsValid())
+      return fixedAddr == elementAddr;
+
+    if (!sc_type_has_subtype(*m_context.GetElementType(elementAddr), *item.m_iteratorType))
+      return false;
+
+    item.m_itemType = ScTemplateItem::Type::Addr;
+    item.m_addr = elementAddr;
+    return true;
+  }
+
+  size_t GetIncidentConnectorsCount(ScAddr const & elementAddr, bool isOutgoing) const
+  {
+    try
+    {
+      return isOutgoing ? m_context.GetElementEdgesAndOutgoingArcsCount(elementAddr)
+                        : m_context.GetElementEdgesAndIncomingArcsCount(elementAddr);
+    }
+    catch (utils::ExceptionInvalidParams const &)
+    {
+      // there are no sc-connectors for sc-element that doesn't exist
+      return 0;
+    }
+  }
+
+  /*!
+   * Estimates count of sc-connectors iterated by each triple if only its fixed items are known. Estimation is based on
+   * counts of outgoing sc-connectors of fixed source sc-elements and incoming sc-connectors of fixed target
+   * sc-elements. Triples without fixed items have unknown cardinality, they can be searched only after triples depended
+   * on them.
+   */
+  void EstimateTriplesCardinalities()
+  {
+    for (ScTemplateSearchTriple & triple : m_triples)
     {
-      std::string const & key = GetKey(triple, tripleItem);
+      ScAddr const & sourceAddr = GetFixedAddr(triple.m_items[0]);
+      ScAddr const & connectorAddr = GetFixedAddr(triple.m_items[1]);
+      ScAddr const & targetAddr = GetFixedAddr(triple.m_items[2]);
+
+      if (connectorAddr.IsValid())
+        triple.m_cardinality = 1;
+      else if (sourceAddr.IsValid() && targetAddr.IsValid())
+        triple.m_cardinality =
+            std::min(GetIncidentConnectorsCount(sourceAddr, true), GetIncidentConnectorsCount(targetAddr, false));
+      else if (sourceAddr.IsValid())
+        triple.m_cardinality = GetIncidentConnectorsCount(sourceAddr, true);
+      else if (targetAddr.IsValid())
+        triple.m_cardinality = GetIncidentConnectorsCount(targetAddr, false);
+    }
+  }
+
+  /*!
+   * Refines estimated cardinalities of triples by counts of sc-connectors with sc-types of triples sc-connectors. These
+   * counts are maintained by sc-memory, so they are got without visiting sc-elements. Triple can't iterate more
+   * sc-connectors than there are sc-connectors of its sc-type in sc-memory.
+   */
+  void EstimateTriplesCardinalitiesByTypes()
+  {
+    std::unordered_map<sc_type, size_t> typesCardinalities;
+    for (ScTemplateSearchTriple & triple : m_triples)
+    {
+      ScTemplateSearchItem const & connectorItem = triple.m_items[1];
+      if (GetFixedAddr(connectorItem).IsValid())
+        continue;
 
-      auto const & found = m_templateItemsNamesToDependedTemplateTriples.find(key);
-      if (found == m_templateItemsNamesToDependedTemplateTriples.cend())
-        m_templateItemsNamesToDependedTemplateTriples.insert({key, {otherTriple->m_index}});
+      auto const it = typesCardinalities.find(*connectorItem.m_iteratorType);
+      if (it != typesCardinalities.cend())
+        triple.m_typeCardinality = it->second;
       else
-        found->second.insert(otherTriple->m_index);
-    };
+      {
+        try
+        {
+          triple.m_typeCardinality = m_context.GetElementsCountByType(connectorItem.m_iteratorType);
+        }
+        catch (utils::ExceptionInvalidState const &)
+        {
+          // sc-memory context without read permissions can't get counts of sc-elements
+          return;
+        }
+        typesCardinalities.insert({*connectorItem.m_iteratorType, triple.m_typeCardinality});
+      }
+
+      if (triple.m_cardinality != UNKNOWN_CARDINALITY)
+        triple.m_cardinality = std::min(triple.m_cardinality, triple.m_typeCardinality);
+    }
+  }
+
+  static bool IsTripleMoreSelective(ScTemplateSearchTriple const & triple, ScTemplateSearchTriple const & otherTriple)
+  {
+    return triple.m_cardinality < otherTriple.m_cardinality
+           || (triple.m_cardinality == otherTriple.m_cardinality
+               && (triple.m_priority < otherTriple.m_priority
+                   || (triple.m_priority == otherTriple.m_priority && triple.m_index < otherTriple.m_index)));
+  }
 
-    auto const & TryAddDependenceBetweenTriples = [&AddDependenceFromTripleItemToOtherTriple](
-                                                      ScTemplateTriple const * triple,
-                                                      ScTemplateItem const & tripleItem,
-                                                      ScTemplateTriple const * otherTriple,
-                                                      ScTemplateItem const & otherTripleItem1,
-                                                      ScTemplateItem const & otherTripleItem2,
-                                                      ScTemplateItem const & otherTripleItem3)
+  static bool IsTriplesItemsEqual(ScTemplateSearchItem const & item, ScTemplateSearchItem const & otherItem)
+  {
+    bool isEqual = item.m_type == otherItem.m_type;
+    if (!isEqual)
     {
-      // don't set up dependency with self
-      if (triple->m_index == otherTriple->m_index)
-        return;
+      if (item.m_hasReplacementType)
+        isEqual = item.m_replacementType == otherItem.m_type;
+      else if (otherItem.m_hasReplacementType)
+        isEqual = item.m_type == otherItem.m_replacementType;
+    }
 
-      // don't set up dependency if item of triple has empty replacement name
-      if (tripleItem.m_name.empty())
-        return;
+    if (isEqual)
+      isEqual = item.m_addr == otherItem.m_addr;
 
-      // check triple item name with other triple items names and dependencies
-      tripleItem.m_name == otherTripleItem1.m_name
-          ? AddDependenceFromTripleItemToOtherTriple(triple, tripleItem, otherTriple)
-          : (tripleItem.m_name == otherTripleItem2.m_name
-                 ? AddDependenceFromTripleItemToOtherTriple(triple, tripleItem, otherTriple)
-                 : (tripleItem.m_name == otherTripleItem3.m_name
-                        ? AddDependenceFromTripleItemToOtherTriple(triple, tripleItem, otherTriple)
-                        : (void)(null_ptr)));
-    };
+    if (!isEqual)
+    {
+      if (item.m_hasReplacementAddr)
+        isEqual = item.m_replacementAddr == otherItem.m_addr;
+      else if (otherItem.m_hasReplacementAddr)
+        isEqual = item.m_addr == otherItem.m_replacementAddr;
+    }
+
+    return isEqual;
+  }
+
+  /*!
+   * Compares items of all triples pairwise once, search uses only flat matrix of comparison results.
+   */
+  void CompileTriplesEquality()
+  {
+    size_t const triplesCount = m_triples.size();
+    m_equalTriplesItems.assign(triplesCount * triplesCount, false);
 
-    for (ScTemplateTriple const * triple : m_template.m_templateTriples)
+    for (ScTemplateSearchTriple const & triple : m_triples)
     {
-      ScTemplateItem const & item1 = (*triple)[0];
-      ScTemplateItem const & item2 = (*triple)[1];
-      ScTemplateItem const & item3 = (*triple)[2];
+      for (ScTemplateSearchTriple const & otherTriple : m_triples)
+      {
+        m_equalTriplesItems[triple.m_index * triplesCount + otherTriple.m_index] =
+            IsTriplesItemsEqual(triple.m_items[0], otherTriple.m_items[0])
+            && IsTriplesItemsEqual(triple.m_items[1], otherTriple.m_items[1])
+            && IsTriplesItemsEqual(triple.m_items[2], otherTriple.m_items[2]);
+      }
+    }
+  }
+
+  /*!
+   * Find all dependencies between triples. Compares replacement slot of each item of the triple
+   * with replacement slot of each item of the other triple, and if they are equal, then adds
+   * dependencies between them.
+   * @note All triple items that have valid address must have replacement names to set up dependencies with them.
+   */
+  void SetUpDependenciesBetweenTriples()
+  {
+    m_dependedTemplateTriples.resize(m_triples.size());
 
-      for (ScTemplateTriple const * otherTriple : m_template.m_templateTriples)
+    for (ScTemplateSearchTriple const & triple : m_triples)
+    {
+      for (ScTemplateSearchTriple const & otherTriple : m_triples)
       {
-        ScTemplateItem const & otherItem1 = (*otherTriple)[0];
-        ScTemplateItem const & otherItem2 = (*otherTriple)[1];
-        ScTemplateItem const & otherItem3 = (*otherTriple)[2];
+        // don't set up dependency with self
+        if (triple.m_index == otherTriple.m_index)
+          continue;
+
+        for (ScTemplateSearchItem const & item : triple.m_items)
+        {
+          // don't set up dependency if item of triple has empty replacement name
+          if (item.m_slot == NO_SLOT)
+            continue;
 
-        TryAddDependenceBetweenTriples(triple, item1, otherTriple, otherItem1, otherItem2, otherItem3);
-        TryAddDependenceBetweenTriples(triple, item2, otherTriple, otherItem1, otherItem2, otherItem3);
-        TryAddDependenceBetweenTriples(triple, item3, otherTriple, otherItem1, otherItem2, otherItem3);
+          // check triple item slot with other triple items slots
+          if (item.m_slot == otherTriple.m_items[0].m_slot || item.m_slot == otherTriple.m_items[1].m_slot
+              || item.m_slot == otherTriple.m_items[2].m_slot)
+            m_dependedTemplateTriples[triple.m_index][item.m_dependenceIdx].insert(otherTriple.m_index);
+        }
       }
     }
   };
 
+  ScTemplateTriples const & GetDependedTemplateTriples(size_t const tripleIdx, size_t const itemIdx) const
+  {
+    return m_dependedTemplateTriples[tripleIdx][m_triples[tripleIdx].m_items[itemIdx].m_dependenceIdx];
+  }
+
   /*!
    * Finds triples that loop sc-template and eliminates transitions from them
    */
   void RemoveCycledDependenciesBetweenTriples()
   {
-    auto const & CheckIfItemIsNodeVarStruct = [this](ScTemplateItem const & item) -> bool
+    auto const & CheckIfItemIsNodeVarStruct = [](ScTemplateSearchItem const & item) -> bool
     {
-      auto const & found = m_template.m_templateItemsNamesToTypes.find(item.m_name);
-      return found != m_template.m_templateItemsNamesToTypes.cend() && found->second == ScType::NodeVarStruct;
+      return item.m_hasReplacementType && item.m_replacementType == ScType::NodeVarStruct;
     };
 
     auto const & faeTriples =
         m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::FAE];
     auto const & CheckIfItemIsFixedAndOtherConnectorItemIsConnector =
-        [&faeTriples](size_t const tripleIdx, ScTemplateItem const & item) -> bool
+        [&faeTriples](size_t const tripleIdx, ScTemplateSearchItem const & item) -> bool
     {
-      return item.IsAddr() && faeTriples.find(tripleIdx) != faeTriples.cend();
+      return item.m_itemType == ScTemplateItem::Type::Addr && faeTriples.find(tripleIdx) != faeTriples.cend();
     };
 
-    auto const & UpdateCycledTriples = [this](ScTemplateTriple const * triple, ScTemplateItem const & item)
+    auto const & UpdateCycledTriples = [this](size_t const tripleIdx)
     {
-      std::string const & key = GetKey(triple, item);
-
-      auto const & dependedTriples = m_templateItemsNamesToDependedTemplateTriples.find(key);
-      if (dependedTriples != m_templateItemsNamesToDependedTemplateTriples.cend())
+      for (size_t const dependedTripleIdx : GetDependedTemplateTriples(tripleIdx, 0))
       {
-        for (size_t const dependedTripleIdx : dependedTriples->second)
-        {
-          if (IsTriplesEqual(triple, m_template.m_templateTriples[dependedTripleIdx]))
-            m_cycledTemplateTriples.insert(dependedTripleIdx);
-        }
+        if (IsTriplesEqual(tripleIdx, dependedTripleIdx))
+          m_cycledTemplateTriples.insert(dependedTripleIdx);
       }
 
-      m_cycledTemplateTriples.insert(triple->m_index);
+      m_cycledTemplateTriples.insert(tripleIdx);
     };
 
     // save all triples that form cycles
-    for (ScTemplateTriple const * triple : m_template.m_templateTriples)
+    for (ScTemplateSearchTriple const & triple : m_triples)
     {
-      ScTemplateItem const & item1 = (*triple)[0];
+      ScTemplateSearchItem const & item1 = triple.m_items[0];
 
       bool isFound = false;
-      if (m_cycledTemplateTriples.find(triple->m_index) == m_cycledTemplateTriples.cend()
+      if (m_cycledTemplateTriples.find(triple.m_index) == m_cycledTemplateTriples.cend()
           && (CheckIfItemIsNodeVarStruct(item1)
-              || CheckIfItemIsFixedAndOtherConnectorItemIsConnector(triple->m_index, item1)))
+              || CheckIfItemIsFixedAndOtherConnectorItemIsConnector(triple.m_index, item1)))
       {
         ScTemplateTriples checkedTriples;
-        FindCycleWithFAATriple(item1, triple, triple, checkedTriples, isFound);
+        FindCycleWithFAATriple(triple.m_index, 0, triple.m_index, checkedTriples, isFound);
       }
 
       if (isFound)
       {
-        UpdateCycledTriples(triple, item1);
+        UpdateCycledTriples(triple.m_index);
       }
     }
 
     // remove dependencies with all triples that form cycles
     for (size_t const idx : m_cycledTemplateTriples)
     {
-      ScTemplateTriple * triple = m_template.m_templateTriples[idx];
-      std::string const & key = GetKey(triple, (*triple)[0]);
-
-      auto const & found = m_templateItemsNamesToDependedTemplateTriples.find(key);
-      if (found != m_templateItemsNamesToDependedTemplateTriples.cend())
+      ScTemplateTriples & dependedTriples = m_dependedTemplateTriples[idx][m_triples[idx].m_items[0].m_dependenceIdx];
+      for (size_t const otherIdx : m_cycledTemplateTriples)
       {
-        for (size_t const otherIdx : m_cycledTemplateTriples)
-        {
-          found->second.erase(otherIdx);
-        }
+        dependedTriples.erase(otherIdx);
       }
     }
   };
 
   void FindCycleWithFAATriple(
-      ScTemplateItem const & templateItem,
-      ScTemplateTriple const * templateTriple,
-      ScTemplateTriple const * templateTripleToFind,
+      size_t const templateTripleIdx,
+      size_t const templateItemIdx,
+      size_t const templateTripleToFindIdx,
       ScTemplateTriples checkedTemplateTriples,
       bool & isFound)
   {
@@ -209,32 +570,29 @@ private:
     if (isFound)
       return;
 
-    auto const & FindCycleWithFAATripleByTripleItem = [this, &templateTripleToFind, &checkedTemplateTriples](
-                                                          ScTemplateItem const & item,
-                                                          ScTemplateTriple const * triple,
-                                                          ScTemplateItem const & previousItem,
-                                                          bool & isFound)
+    ScTemplateSearchItem const & templateItem = m_triples[templateTripleIdx].m_items[templateItemIdx];
+
+    auto const & FindCycleWithFAATripleByTripleItem =
+        [this, &templateTripleToFindIdx, &checkedTemplateTriples](
+            size_t const tripleIdx, size_t const itemIdx, ScTemplateSearchItem const & previousItem, bool & isFound)
     {
-      // no iterate back by the same item name
-      if (!item.m_name.empty() && item.m_name == previousItem.m_name)
+      ScTemplateSearchItem const & item = m_triples[tripleIdx].m_items[itemIdx];
+
+      // no iterate back by the same item replacement
+      if (item.m_slot != NO_SLOT && item.m_slot == previousItem.m_slot)
         return;
 
       // no iterate back by the same item address
-      if (item.m_addrValue.IsValid() && item.m_addrValue == previousItem.m_addrValue)
+      if (item.m_addr.IsValid() && item.m_addr == previousItem.m_addr)
         return;
 
-      FindCycleWithFAATriple(item, triple, templateTripleToFind, checkedTemplateTriples, isFound);
+      FindCycleWithFAATriple(tripleIdx, itemIdx, templateTripleToFindIdx, checkedTemplateTriples, isFound);
     };
 
-    ScTemplateTriples nextTemplateTriples;
-    FindDependedTriple(templateItem, templateTriple, nextTemplateTriples);
-
-    for (size_t const otherTemplateTripleIdx : nextTemplateTriples)
+    for (size_t const otherTemplateTripleIdx : GetDependedTemplateTriples(templateTripleIdx, templateItemIdx))
     {
-      ScTemplateTriple const * otherTriple = m_template.m_templateTriples[otherTemplateTripleIdx];
-
-      if ((otherTemplateTripleIdx == templateTripleToFind->m_index
-           && templateItem.m_name != (*templateTripleToFind)[0].m_name)
+      if ((otherTemplateTripleIdx == templateTripleToFindIdx
+           && templateItem.m_slot != m_triples[templateTripleToFindIdx].m_items[0].m_slot)
           || isFound)
       {
         isFound = true;
@@ -249,55 +607,76 @@ private:
       {
         checkedTemplateTriples.insert(otherTemplateTripleIdx);
 
-        FindCycleWithFAATripleByTripleItem((*otherTriple)[0], otherTriple, templateItem, isFound);
-        FindCycleWithFAATripleByTripleItem((*otherTriple)[1], otherTriple, templateItem, isFound);
-        FindCycleWithFAATripleByTripleItem((*otherTriple)[2], otherTriple, templateItem, isFound);
+        FindCycleWithFAATripleByTripleItem(otherTemplateTripleIdx, 0, templateItem, isFound);
+        FindCycleWithFAATripleByTripleItem(otherTemplateTripleIdx, 1, templateItem, isFound);
+        FindCycleWithFAATripleByTripleItem(otherTemplateTripleIdx, 2, templateItem, isFound);
       }
     }
   }
 
+  /*!
+   * Moves found dependencies between triples into index arrays of compiled triples.
+   */
+  void CompileDependenciesBetweenTriples()
+  {
+    for (ScTemplateSearchTriple & triple : m_triples)
+    {
+      for (size_t i = 0; i < triple.m_dependedTriples.size(); ++i)
+      {
+        ScTemplateTriples const & dependedTriples = m_dependedTemplateTriples[triple.m_index][i];
+        triple.m_dependedTriples[i].assign(dependedTriples.cbegin(), dependedTriples.cend());
+      }
+    }
+
+    m_dependedTemplateTriples.clear();
+  }
+
+  ScTemplateTriplesIndices const & GetDependedTriples(size_t const tripleIdx, size_t const itemIdx) const
+  {
+    ScTemplateSearchTriple const & triple = m_triples[tripleIdx];
+    return triple.m_dependedTriples[triple.m_items[itemIdx].m_dependenceIdx];
+  }
+
   void FindConnectivityComponents()
   {
     ScTemplateTriples checkedTriples;
 
-    for (ScTemplateTriple const * triple : m_template.m_templateTriples)
+    for (ScTemplateSearchTriple const & triple : m_triples)
     {
       ScTemplateTriples connectivityComponentTriples;
-      FindConnectivityComponent(triple, checkedTriples, connectivityComponentTriples);
+      FindConnectivityComponent(triple.m_index, checkedTriples, connectivityComponentTriples);
 
-      m_connectivityComponentsTemplateTriples.push_back(connectivityComponentTriples);
+      if (!connectivityComponentTriples.empty())
+        m_connectivityComponentsTemplateTriples.push_back(connectivityComponentTriples);
     }
   }
 
   void FindConnectivityComponent(
-      ScTemplateTriple const * templateTriple,
+      size_t const templateTripleIdx,
       ScTemplateTriples & checkedTemplateTriples,
       ScTemplateTriples & connectivityComponentTemplateTriples)
   {
     // check if triple was passed in branch of sc-template
-    if (checkedTemplateTriples.find(templateTriple->m_index) != checkedTemplateTriples.cend())
+    if (checkedTemplateTriples.find(templateTripleIdx) != checkedTemplateTriples.cend())
       return;
 
-    connectivityComponentTemplateTriples.insert(templateTriple->m_index);
+    connectivityComponentTemplateTriples.insert(templateTripleIdx);
 
     FindConnectivityComponentByItem(
-        (*templateTriple)[0], templateTriple, checkedTemplateTriples, connectivityComponentTemplateTriples);
+        templateTripleIdx, 0, checkedTemplateTriples, connectivityComponentTemplateTriples);
     FindConnectivityComponentByItem(
-        (*templateTriple)[1], templateTriple, checkedTemplateTriples, connectivityComponentTemplateTriples);
+        templateTripleIdx, 1, checkedTemplateTriples, connectivityComponentTemplateTriples);
     FindConnectivityComponentByItem(
-        (*templateTriple)[2], templateTriple, checkedTemplateTriples, connectivityComponentTemplateTriples);
+        templateTripleIdx, 2, checkedTemplateTriples, connectivityComponentTemplateTriples);
   }
 
   void FindConnectivityComponentByItem(
-      ScTemplateItem const & templateItem,
-      ScTemplateTriple const * templateTriple,
+      size_t const templateTripleIdx,
+      size_t const templateItemIdx,
       ScTemplateTriples & checkedTemplateTriples,
       ScTemplateTriples & connectivityComponentTemplateTriples)
   {
-    ScTemplateTriples nextTriples;
-    FindDependedTriple(templateItem, templateTriple, nextTriples);
-
-    for (size_t const otherTripleIdx : nextTriples)
+    for (size_t const otherTripleIdx : GetDependedTriples(templateTripleIdx, templateItemIdx))
     {
       // check if triple was passed in branch of sc-template
       if (checkedTemplateTriples.find(otherTripleIdx) != checkedTemplateTriples.cend())
@@ -308,40 +687,66 @@ private:
         checkedTemplateTriples.insert(otherTripleIdx);
         connectivityComponentTemplateTriples.insert(otherTripleIdx);
 
-        ScTemplateTriple const * otherTriple = m_template.m_templateTriples[otherTripleIdx];
-
         FindConnectivityComponentByItem(
-            (*otherTriple)[0], otherTriple, checkedTemplateTriples, connectivityComponentTemplateTriples);
+            otherTripleIdx, 0, checkedTemplateTriples, connectivityComponentTemplateTriples);
         FindConnectivityComponentByItem(
-            (*otherTriple)[1], otherTriple, checkedTemplateTriples, connectivityComponentTemplateTriples);
+            otherTripleIdx, 1, checkedTemplateTriples, connectivityComponentTemplateTriples);
         FindConnectivityComponentByItem(
-            (*otherTriple)[2], otherTriple, checkedTemplateTriples, connectivityComponentTemplateTriples);
+            otherTripleIdx, 2, checkedTemplateTriples, connectivityComponentTemplateTriples);
       }
     }
   }
 
   /*!
-   * Finds all connectivity component triples among all triples that have the fixed first item, but not fixed
-   * other items, for which the minimum number of arcs goes/incomes out of the first item compared to the other triples.
+   * Orders triples depended on each triple item by estimated count of sc-connectors that will be iterated when
+   * search goes to them. Triples that are reached by their sc-connector item are the cheapest ones, the other ones are
+   * ordered by their estimated cardinalities.
    */
-  void FindTriplesWithMostMinimalArcsForFirstItem()
+  void OrderDependedTriplesByCardinalities()
   {
-    for (ScTemplateTriples const & connectivityComponentsTriples : m_connectivityComponentsTemplateTriples)
+    for (ScTemplateSearchTriple & triple : m_triples)
     {
-      sc_int32 priorityTripleIdx = -1;
-      auto & afaTriples = m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::AFA];
-      if (!afaTriples.empty())
-        priorityTripleIdx = (sc_int32)*afaTriples.cbegin();
+      for (size_t i = 0; i < triple.m_dependedTriples.size(); ++i)
+      {
+        size_t const slot = triple.m_items[i].m_slot;
+        auto const & GetCardinality = [this, slot](size_t const tripleIdx) -> size_t
+        {
+          ScTemplateSearchTriple const & dependedTriple = m_triples[tripleIdx];
+          return dependedTriple.m_items[1].m_slot == slot
+                     ? 1
+                     : std::min(dependedTriple.m_cardinality, dependedTriple.m_typeCardinality);
+        };
+
+        std::stable_sort(
+            triple.m_dependedTriples[i].begin(),
+            triple.m_dependedTriples[i].end(),
+            [&GetCardinality](size_t const tripleIdx, size_t const otherTripleIdx)
+            {
+              return GetCardinality(tripleIdx) < GetCardinality(otherTripleIdx);
+            });
+      }
+    }
+  }
 
-      if (priorityTripleIdx == -1)
+  /*!
+   * Finds triple with the minimal estimated cardinality in each connectivity component to start search from it.
+   * Connectivity components that have no triples with fixed items have no start triples.
+   */
+  void FindTriplesWithMinimalCardinalities()
+  {
+    for (ScTemplateTriples const & connectivityComponentTriples : m_connectivityComponentsTemplateTriples)
+    {
+      sc_int32 priorityTripleIdx = -1;
+      for (size_t const tripleIdx : connectivityComponentTriples)
       {
-        priorityTripleIdx = FindTripleWithMostMinimalInputArcsForThirdItem(connectivityComponentsTriples);
-        if (priorityTripleIdx == -1)
-          priorityTripleIdx = FindTripleWithMostMinimalOutputArcsForFirstItem(connectivityComponentsTriples);
+        ScTemplateSearchTriple const & triple = m_triples[tripleIdx];
+        if (triple.m_cardinality == UNKNOWN_CARDINALITY)
+          continue;
+
+        if (priorityTripleIdx == -1 || IsTripleMoreSelective(triple, m_triples[priorityTripleIdx]))
+          priorityTripleIdx = (sc_int32)tripleIdx;
       }
 
-      // save triple in which the first item address has the most minimal count of incoming/outgoing sc-arcs in vector
-      // with more priority
       if (priorityTripleIdx != -1)
       {
         m_connectivityComponentPriorityTemplateTriples.insert(priorityTripleIdx);
@@ -349,141 +754,197 @@ private:
     }
   }
 
-  sc_int32 FindTripleWithMostMinimalInputArcsForThirdItem(ScTemplateTriples const & connectivityComponentsTriples)
+  static bool IsArcType(ScType const & type)
+  {
+    return !(*type & sc_type_edge_common) && (*type & (sc_type_arc_access | sc_type_arc_common));
+  }
+
+  /*!
+   * Prepares search by join for sc-templates with cycles between variable sources and targets of triples. Sources and
+   * targets are numbered as variables and ordered so that each next variable is adjacent to already known sc-elements
+   * by as many triples as possible. Search by join is not prepared if sc-template has fixed sc-connectors,
+   * sc-connectors which are sources or targets of other triples, sc-edges or variables which are not reachable from
+   * fixed sc-elements. Equal triples are joined as other ones, so all sc-constructions of cycled sc-template are found.
+   * Only equal triples between the same variables are interchangeable, so their sc-connectors are taken in order of
+   * hashes, and sc-constructions which differ only by permutation of these sc-connectors are not found again.
+   */
+  void PrepareJoin()
   {
-    auto triplesWithConstEndElement =
-        m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::FAF];
-    if (triplesWithConstEndElement.empty())
+    size_t const triplesCount = m_triples.size();
+
+    std::vector<size_t> slotsUsagesCounts(m_slotsNames.size(), 0);
+    for (ScTemplateSearchTriple const & triple : m_triples)
     {
-      triplesWithConstEndElement =
-          m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::AAF];
+      for (ScTemplateSearchItem const & item : triple.m_items)
+      {
+        if (item.m_slot != NO_SLOT)
+          ++slotsUsagesCounts[item.m_slot];
+      }
     }
 
-    // find triple in which the third item address has the most minimal count of incoming sc-arcs
-    sc_int32 priorityTripleIdx = -1;
-    sc_int32 minInputArcsCount = -1;
-    for (size_t const tripleIdx : triplesWithConstEndElement)
+    std::vector<size_t> slotsVariables(m_slotsNames.size(), NO_VARIABLE);
+    std::vector<ScTemplateJoinTriple> joinTriples(triplesCount);
+    size_t variablesCount = 0;
+    for (size_t tripleIdx = 0; tripleIdx < triplesCount; ++tripleIdx)
     {
-      // check if triple in connectivity component
-      if (connectivityComponentsTriples.find(tripleIdx) == connectivityComponentsTriples.cend())
-        continue;
+      auto const & items = m_triples[tripleIdx].m_items;
+      if (GetFixedAddr(items[1]).IsValid() || !IsArcType(items[1].m_iteratorType)
+          || (items[1].m_slot != NO_SLOT && slotsUsagesCounts[items[1].m_slot] > 1))
+        return;
 
-      ScTemplateTriple const * triple = m_template.m_templateTriples[tripleIdx];
-      auto const count = (sc_int32)m_context.GetElementEdgesAndIncomingArcsCount(triple->GetValues()[2].m_addrValue);
+      for (size_t const itemIdx : {0, 2})
+      {
+        ScTemplateSearchItem const & item = items[itemIdx];
+        if (GetFixedAddr(item).IsValid())
+          continue;
+
+        size_t & variable = joinTriples[tripleIdx].m_variables[itemIdx / 2];
+        if (item.m_slot == NO_SLOT)
+          variable = variablesCount++;
+        else
+        {
+          if (slotsVariables[item.m_slot] == NO_VARIABLE)
+            slotsVariables[item.m_slot] = variablesCount++;
+          variable = slotsVariables[item.m_slot];
+        }
+      }
 
-      if (minInputArcsCount == -1 || count < minInputArcsCount)
+      for (size_t otherTripleIdx = 0; otherTripleIdx < tripleIdx; ++otherTripleIdx)
       {
-        priorityTripleIdx = (sc_int32)tripleIdx;
-        minInputArcsCount = (sc_int32)count;
+        if (m_equalTriplesItems[tripleIdx * triplesCount + otherTripleIdx]
+            && joinTriples[tripleIdx].m_variables == joinTriples[otherTripleIdx].m_variables)
+          joinTriples[tripleIdx].m_equalTripleIdx = otherTripleIdx;
       }
     }
 
-    return priorityTripleIdx;
-  }
-
-  sc_int32 FindTripleWithMostMinimalOutputArcsForFirstItem(ScTemplateTriples const & connectivityComponentsTriples)
-  {
-    auto triplesWithConstBeginElement =
-        m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::FAN];
-    // if there are no triples with the no connector third item than sort triples with the connector third item
-    if (triplesWithConstBeginElement.empty())
-      triplesWithConstBeginElement =
-          m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::FAE];
+    // triples between variables form cycle if they connect already connected variables
+    std::vector<size_t> variablesComponents(variablesCount);
+    for (size_t variable = 0; variable < variablesCount; ++variable)
+      variablesComponents[variable] = variable;
+    auto const & FindComponent = [&variablesComponents](size_t variable) -> size_t
+    {
+      while (variablesComponents[variable] != variable)
+        variable = variablesComponents[variable] = variablesComponents[variablesComponents[variable]];
+      return variable;
+    };
 
-    // find triple in which the first item address has the most minimal count of outgoing sc-arcs
-    sc_int32 priorityTripleIdx = -1;
-    sc_int32 minOutputArcsCount = -1;
-    for (size_t const tripleIdx : triplesWithConstBeginElement)
+    bool isCycled = false;
+    for (ScTemplateJoinTriple const & joinTriple : joinTriples)
     {
-      // check if triple in connectivity component
-      if (connectivityComponentsTriples.find(tripleIdx) == connectivityComponentsTriples.cend())
+      auto const [sourceVariable, targetVariable] = joinTriple.m_variables;
+      if (sourceVariable == NO_VARIABLE || targetVariable == NO_VARIABLE || sourceVariable == targetVariable)
         continue;
 
-      ScTemplateTriple const * triple = m_template.m_templateTriples[tripleIdx];
-      auto const count = (sc_int32)m_context.GetElementEdgesAndOutgoingArcsCount(triple->GetValues()[0].m_addrValue);
-
-      if (minOutputArcsCount == -1 || count < minOutputArcsCount)
-      {
-        priorityTripleIdx = (sc_int32)tripleIdx;
-        minOutputArcsCount = (sc_int32)count;
-      }
+      size_t const sourceComponent = FindComponent(sourceVariable);
+      size_t const targetComponent = FindComponent(targetVariable);
+      if (sourceComponent == targetComponent)
+        isCycled = true;
+      else
+        variablesComponents[sourceComponent] = targetComponent;
     }
 
-    return priorityTripleIdx;
-  }
-
-  //! Returns key - "${item replacement name}${triple index}"
-  static std::string GetKey(ScTemplateTriple const * triple, ScTemplateItem const & item)
-  {
-    std::ostringstream stream;
-    stream << item.m_name << "_" << triple->m_index;
-    return stream.str();
-  }
-
-  void FindDependedTriple(ScTemplateItem const & item, ScTemplateTriple const * triple, ScTemplateTriples & nextTriples)
-  {
-    if (item.m_name.empty())
+    if (!isCycled)
       return;
 
-    std::string const & key = GetKey(triple, item);
-    auto const & found = m_templateItemsNamesToDependedTemplateTriples.find(key);
-    if (found != m_templateItemsNamesToDependedTemplateTriples.cend())
-      nextTriples = found->second;
-  }
-
-  bool IsTriplesEqual(
-      ScTemplateTriple const * templateTriple,
-      ScTemplateTriple const * otherTemplateTriple,
-      std::string const & itemName = "")
-  {
-    if (templateTriple->m_index == otherTemplateTriple->m_index)
-      return true;
-
-    auto const & tripleValues = templateTriple->GetValues();
-    auto const & otherTripleValues = otherTemplateTriple->GetValues();
+    std::vector<bool> boundVariables(variablesCount, false);
+    std::vector<bool> orderedTriples(triplesCount, false);
+    auto const & IsBound = [&boundVariables](size_t const variable) -> bool
+    {
+      return variable == NO_VARIABLE || boundVariables[variable];
+    };
 
-    auto const & IsTriplesItemsEqual = [this](ScTemplateItem const & item, ScTemplateItem const & otherItem) -> bool
+    std::vector<ScTemplateJoinStep> joinSteps;
+    joinSteps.reserve(variablesCount);
+    for (size_t stepIdx = 0; stepIdx < variablesCount; ++stepIdx)
     {
-      bool isEqual = item.m_typeValue == otherItem.m_typeValue;
-      if (!isEqual)
+      ScTemplateJoinStep bestStep;
+      size_t bestCardinality = UNKNOWN_CARDINALITY;
+      for (size_t variable = 0; variable < variablesCount; ++variable)
       {
-        auto found = m_template.m_templateItemsNamesToTypes.find(item.m_name);
-        if (found == m_template.m_templateItemsNamesToTypes.cend())
+        if (boundVariables[variable])
+          continue;
+
+        ScTemplateJoinStep step;
+        step.m_variable = variable;
+        size_t cardinality = UNKNOWN_CARDINALITY;
+        for (size_t tripleIdx = 0; tripleIdx < triplesCount; ++tripleIdx)
         {
-          found = m_template.m_templateItemsNamesToTypes.find(otherItem.m_name);
-          if (found != m_template.m_templateItemsNamesToTypes.cend())
-            isEqual = item.m_typeValue == found->second;
-        }
-        else
-          isEqual = found->second == otherItem.m_typeValue;
-      }
+          auto const [sourceVariable, targetVariable] = joinTriples[tripleIdx].m_variables;
+          if (orderedTriples[tripleIdx] || sourceVariable == targetVariable)
+            continue;
 
-      if (isEqual)
-        isEqual = item.m_addrValue == otherItem.m_addrValue;
+          if ((sourceVariable == variable && IsBound(targetVariable))
+              || (targetVariable == variable && IsBound(sourceVariable)))
+          {
+            step.m_triples.push_back(tripleIdx);
+            if (sourceVariable == NO_VARIABLE || targetVariable == NO_VARIABLE)
+              cardinality = std::min(cardinality, m_triples[tripleIdx].m_cardinality);
+          }
+        }
 
-      if (!isEqual)
+        if (step.m_triples.size() > bestStep.m_triples.size()
+            || (step.m_triples.size() == bestStep.m_triples.size() && cardinality < bestCardinality))
+        {
+          bestStep = std::move(step);
+          bestCardinality = cardinality;
+        }
+      }
+
+      // variable is not reachable from fixed sc-elements
+      if (bestStep.m_triples.empty())
+        return;
+
+      boundVariables[bestStep.m_variable] = true;
+      for (size_t const tripleIdx : bestStep.m_triples)
+      {
+        orderedTriples[tripleIdx] = true;
+        joinTriples[tripleIdx].m_boundItemIdx = joinTriples[tripleIdx].m_variables[0] == bestStep.m_variable ? 2 : 0;
+      }
+
+      for (size_t tripleIdx = 0; tripleIdx < triplesCount; ++tripleIdx)
       {
-        auto found = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(item.m_name);
-        if (found == m_template.m_templateItemsNamesToReplacementItemsAddrs.cend())
+        auto const [sourceVariable, targetVariable] = joinTriples[tripleIdx].m_variables;
+        if (sourceVariable == bestStep.m_variable && targetVariable == bestStep.m_variable)
         {
-          found = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(otherItem.m_name);
-          if (found != m_template.m_templateItemsNamesToReplacementItemsAddrs.cend())
-            isEqual = item.m_addrValue == found->second;
+          orderedTriples[tripleIdx] = true;
+          bestStep.m_loopTriples.push_back(tripleIdx);
         }
-        else
-          isEqual = found->second == otherItem.m_addrValue;
       }
 
-      return isEqual;
-    };
+      joinSteps.push_back(std::move(bestStep));
+    }
+
+    for (size_t tripleIdx = 0; tripleIdx < triplesCount; ++tripleIdx)
+    {
+      if (!orderedTriples[tripleIdx])
+        m_joinFixedTriples.push_back(tripleIdx);
+    }
+
+    m_joinTriples = std::move(joinTriples);
+    m_joinSteps = std::move(joinSteps);
+    m_joinVariablesCount = variablesCount;
+  }
+
+  bool IsJoinSearch() const
+  {
+    return m_isJoinEnabled && !m_joinSteps.empty();
+  }
+
+  bool IsTriplesEqual(size_t const tripleIdx, size_t const otherTripleIdx, size_t const itemSlot = NO_SLOT) const
+  {
+    if (tripleIdx == otherTripleIdx)
+      return true;
+
+    if (!m_equalTriplesItems[tripleIdx * m_triples.size() + otherTripleIdx])
+      return false;
 
-    return IsTriplesItemsEqual(tripleValues[0], otherTripleValues[0])
-           && IsTriplesItemsEqual(tripleValues[1], otherTripleValues[1])
-           && IsTriplesItemsEqual(tripleValues[2], otherTripleValues[2])
-           && ((tripleValues[0].m_name == otherTripleValues[0].m_name
-                && (itemName.empty() || otherTripleValues[0].m_name == itemName))
-               || (tripleValues[2].m_name == otherTripleValues[2].m_name
-                   && (itemName.empty() || otherTripleValues[0].m_name == itemName)));
+    auto const & tripleItems = m_triples[tripleIdx].m_items;
+    auto const & otherTripleItems = m_triples[otherTripleIdx].m_items;
+
+    return (tripleItems[0].m_slot == otherTripleItems[0].m_slot
+            && (itemSlot == NO_SLOT || otherTripleItems[0].m_slot == itemSlot))
+           || (tripleItems[2].m_slot == otherTripleItems[2].m_slot
+               && (itemSlot == NO_SLOT || otherTripleItems[0].m_slot == itemSlot));
   };
 
   inline bool IsStructureValid()
@@ -491,55 +952,96 @@ private:
     return m_structure.IsValid();
   }
 
-  inline bool IsInStructure(ScAddr const & addr)
+  /*!
+   * Checks if sc-element belongs to sc-structure search is restricted by. At first, sc-elements are checked one by one.
+   * When count of checks exceeds count of sc-elements of sc-structure, all sc-elements of sc-structure are collected to
+   * check the rest of sc-elements without access to sc-memory.
+   */
+  bool IsInStructure(ScAddr const & addr)
   {
-    return m_context.CheckConnector(m_structure, addr, ScType::EdgeAccessConstPosPerm);
-  }
+    if (m_isStructureElementsCollected)
+      return m_structureElements.find(addr) != m_structureElements.cend();
 
-  ScAddr const & ResolveAddr(
-      ScTemplateItem const & templateItem,
-      ScAddrVector const & replacementConstruction,
-      ScTemplateSearchResult & result) const
-  {
-    auto const & GetItemAddrInReplacements = [&replacementConstruction,
-                                              &result](ScTemplateItem const & item) -> ScAddr const &
+    if (m_structureElementsCount == UNKNOWN_CARDINALITY)
+    {
+      m_structureElementsCount = GetIncidentConnectorsCount(m_structure, true);
+      m_structureType = m_context.GetElementType(m_structure);
+    }
+
+    if (++m_structureChecksCount > m_structureElementsCount)
+    {
+      CollectStructureElements();
+      return m_structureElements.find(addr) != m_structureElements.cend();
+    }
+
+#ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
+    // only sc-arcs from sc-structures are iterated for sc-element in this case
+    if (sc_type_is_structure_and_arc(*m_structureType, *ScType::EdgeAccessConstPosPerm))
     {
-      auto const & it = result.m_templateItemsNamesToReplacementItemsPositions.find(item.m_name);
-      if (it != result.m_templateItemsNamesToReplacementItemsPositions.cend())
+      ScIterator3Ptr const it = m_context.CreateIterator3(m_structureType, ScType::EdgeAccessConstPosPerm, addr);
+      while (it->Next())
       {
-        ScAddr const & addr = replacementConstruction[it->second];
-        if (addr.IsValid())
-          return addr;
+        if (it->Get(0) == m_structure)
+          return true;
       }
+      return false;
+    }
+#endif
+
+    return m_context.CheckConnector(m_structure, addr, ScType::EdgeAccessConstPosPerm);
+  }
 
+  void CollectStructureElements()
+  {
+    m_structureElements.reserve(m_structureElementsCount);
+
+    ScIterator3Ptr const it = m_context.CreateIterator3(m_structure, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+    while (it->Next())
+      m_structureElements.insert(it->Get(2));
+
+    m_isStructureElementsCollected = true;
+  }
+
+  ScAddr const & GetItemAddrInReplacements(
+      ScTemplateSearchItem const & templateItem,
+      ScAddr const * replacementConstruction) const
+  {
+    if (templateItem.m_slot == NO_SLOT)
       return ScAddr::Empty;
-    };
 
+    size_t const position = m_slotsPositions[templateItem.m_slot];
+    if (position == NO_POSITION)
+      return ScAddr::Empty;
+
+    return replacementConstruction[position];
+  }
+
+  ScAddr const & ResolveAddr(ScTemplateSearchItem const & templateItem, ScAddr const * replacementConstruction) const
+  {
     switch (templateItem.m_itemType)
     {
     case ScTemplateItem::Type::Addr:
     {
-      return templateItem.m_addrValue;
+      return templateItem.m_addr;
     }
 
     case ScTemplateItem::Type::Replace:
     {
-      ScAddr const & replacementAddr = GetItemAddrInReplacements(templateItem);
+      ScAddr const & replacementAddr = GetItemAddrInReplacements(templateItem, replacementConstruction);
       if (replacementAddr.IsValid())
         return replacementAddr;
 
-      auto const & addrsIt = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(templateItem.m_name);
-      if (addrsIt != m_template.m_templateItemsNamesToReplacementItemsAddrs.cend())
-        return addrsIt->second;
+      if (templateItem.m_hasReplacementAddr)
+        return templateItem.m_replacementAddr;
 
       return ScAddr::Empty;
     }
 
     case ScTemplateItem::Type::Type:
     {
-      if (!templateItem.m_name.empty())
+      if (templateItem.m_slot != NO_SLOT)
       {
-        return GetItemAddrInReplacements(templateItem);
+        return GetItemAddrInReplacements(templateItem, replacementConstruction);
       }
       SC_FALLTHROUGH;
     }
@@ -551,61 +1053,42 @@ private:
     }
   }
 
-  ScIterator3Ptr CreateIterator(
-      ScTemplateTriple const * templateTriple,
-      ScAddrVector const & replacementConstruction,
-      ScTemplateSearchResult & result)
+  ScIterator3Ptr CreateIterator(ScTemplateSearchTriple const & templateTriple, ScAddr const * replacementConstruction)
   {
-    ScTemplateItem const & item1 = (*templateTriple)[0];
-    ScTemplateItem const & item2 = (*templateTriple)[1];
-    ScTemplateItem const & item3 = (*templateTriple)[2];
-
-    ScAddr const & addr1 = ResolveAddr(item1, replacementConstruction, result);
-    ScAddr const & addr2 = ResolveAddr(item2, replacementConstruction, result);
-    ScAddr const & addr3 = ResolveAddr(item3, replacementConstruction, result);
-
-    auto const & PrepareType = [this](ScTemplateItem const & item) -> ScType
-    {
-      ScType type = item.m_typeValue;
-      if (!item.m_name.empty())
-      {
-        auto const & found = m_template.m_templateItemsNamesToTypes.find(item.m_name);
-        if (found != m_template.m_templateItemsNamesToTypes.cend())
-          type = found->second;
-      }
+    ScTemplateSearchItem const & item1 = templateTriple.m_items[0];
+    ScTemplateSearchItem const & item2 = templateTriple.m_items[1];
+    ScTemplateSearchItem const & item3 = templateTriple.m_items[2];
 
-      if (type.HasConstancyFlag())
-        return type.UpConstType();
-
-      return type;
-    };
+    ScAddr const & addr1 = ResolveAddr(item1, replacementConstruction);
+    ScAddr const & addr2 = ResolveAddr(item2, replacementConstruction);
+    ScAddr const & addr3 = ResolveAddr(item3, replacementConstruction);
 
     if (addr1.IsValid())
     {
       if (!addr2.IsValid())
       {
         if (addr3.IsValid())  // F_A_F
-          return m_context.CreateIterator3(addr1, PrepareType(item2), addr3);
+          return m_context.CreateIterator3(addr1, item2.m_iteratorType, addr3);
         else  // F_A_A
-          return m_context.CreateIterator3(addr1, PrepareType(item2), PrepareType(item3));
+          return m_context.CreateIterator3(addr1, item2.m_iteratorType, item3.m_iteratorType);
       }
       else
       {
         if (addr3.IsValid())  // F_F_F
           return m_context.CreateIterator3(addr1, addr2, addr3);
         else  // F_F_A
-          return m_context.CreateIterator3(addr1, addr2, PrepareType(item3));
+          return m_context.CreateIterator3(addr1, addr2, item3.m_iteratorType);
       }
     }
     else if (addr3.IsValid())
     {
       if (addr2.IsValid())  // A_F_F
-        return m_context.CreateIterator3(PrepareType(item1), addr2, addr3);
+        return m_context.CreateIterator3(item1.m_iteratorType, addr2, addr3);
       else  // A_A_F
-        return m_context.CreateIterator3(PrepareType(item1), PrepareType(item2), addr3);
+        return m_context.CreateIterator3(item1.m_iteratorType, item2.m_iteratorType, addr3);
     }
     else if (addr2.IsValid() && !addr3.IsValid())  // A_F_A
-      return m_context.CreateIterator3(PrepareType(item1), addr2, PrepareType(item3));
+      return m_context.CreateIterator3(item1.m_iteratorType, addr2, item3.m_iteratorType);
 
     return {};
   }
@@ -613,8 +1096,8 @@ private:
   using UsedConnectors = std::unordered_set<ScAddr, ScAddrHashFunc>;
 
   void DoIterationOnNextEqualTriples(
-      ScTemplateTriples const & templateTriples,
-      std::string const & templateItemName,
+      ScTemplateTriplesIndices const & templateTriples,
+      size_t const templateItemSlot,
       size_t const replacementConstructionIdx,
       ScTemplateTriples const & currentIterableTemplateTriples,
       ScTemplateTriples & childrenTemplateTriples,
@@ -625,25 +1108,26 @@ private:
     isLast = true;
     isFinished = true;
 
-    std::unordered_set<size_t> iteratedTemplateTriples;
+    std::vector<bool> iteratedTemplateTriples(m_triples.size(), false);
     for (size_t const idx : templateTriples)
     {
-      ScTemplateTriple * triple = m_template.m_templateTriples[idx];
-      if (iteratedTemplateTriples.find(triple->m_index) != iteratedTemplateTriples.cend())
+      if (iteratedTemplateTriples[idx])
         continue;
 
       ScTemplateTriples equalTemplateTriples;
-      for (ScTemplateTriple * otherTemplateTriple : m_template.m_templateTriples)
       {
-        // check if iterable triple is equal to current, not checked and not iterable with previous
-        if (m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].find(
-                otherTemplateTriple->m_index)
-                == m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].cend()
-            && currentIterableTemplateTriples.find(idx) == currentIterableTemplateTriples.cend()
-            && IsTriplesEqual(triple, otherTemplateTriple, templateItemName))
+        ScTemplateTriples const & checkedTemplateTriples =
+            m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx];
+        for (size_t otherIdx = 0; otherIdx < m_triples.size(); ++otherIdx)
         {
-          equalTemplateTriples.insert(otherTemplateTriple->m_index);
-          iteratedTemplateTriples.insert(otherTemplateTriple->m_index);
+          // check if iterable triple is equal to current, not checked and not iterable with previous
+          if (checkedTemplateTriples.find(otherIdx) == checkedTemplateTriples.cend()
+              && currentIterableTemplateTriples.find(idx) == currentIterableTemplateTriples.cend()
+              && IsTriplesEqual(idx, otherIdx, templateItemSlot))
+          {
+            equalTemplateTriples.insert(otherIdx);
+            iteratedTemplateTriples[otherIdx] = true;
+          }
         }
       }
 
@@ -668,8 +1152,8 @@ private:
   }
 
   bool DoDependenceIterationByItem(
-      ScTemplateTriple const * templateTriple,
-      ScTemplateItem const & item,
+      size_t const templateTripleIdx,
+      size_t const templateItemIdx,
       size_t replacementConstructionIdx,
       ScTemplateTriples const & templateTriples,
       ScTemplateTriples & childrenTemplateTriples,
@@ -679,12 +1163,10 @@ private:
   {
     bool isChildFinished = false;
     bool isNoChild = false;
-    ScTemplateTriples nextTemplateTriples;
-    FindDependedTriple(item, templateTriple, nextTemplateTriples);
 
     DoIterationOnNextEqualTriples(
-        nextTemplateTriples,
-        item.m_name,
+        GetDependedTriples(templateTripleIdx, templateItemIdx),
+        m_triples[templateTripleIdx].m_items[templateItemIdx].m_slot,
         replacementConstructionIdx,
         templateTriples,
         childrenTemplateTriples,
@@ -703,14 +1185,14 @@ private:
       ScTemplateTriples & childrenTemplateTriples,
       ScTemplateSearchResult & result)
   {
+    bool const isRootIteration = m_depth++ == 0;
     size_t templateTripleIdx = *templateTriples.begin();
-    ScTemplateTriple * templateTriple = m_template.m_templateTriples[templateTripleIdx];
 
     bool isForLastTemplateTripleAllChildrenFinished = true;
     bool isLastTemplateTripleHasNoChildren = false;
 
     ScIterator3Ptr it =
-        CreateIterator(templateTriple, result.m_replacementConstructions[replacementConstructionIdx], result);
+        CreateIterator(m_triples[templateTripleIdx], result.GetReplacementConstruction(replacementConstructionIdx));
     if (!it || !it->IsValid())
       SC_THROW_EXCEPTION(
           utils::ExceptionInvalidState,
@@ -720,7 +1202,9 @@ private:
 
     size_t checkedCurrentResultEqualTemplateTriplesCount = 0;
 
-    ScAddrVector nextResultReplacementTriples{result.m_replacementConstructions[replacementConstructionIdx]};
+    ScAddr const * currentReplacementConstruction = result.GetReplacementConstruction(replacementConstructionIdx);
+    ScAddrVector nextResultReplacementTriples{
+        currentReplacementConstruction, currentReplacementConstruction + result.m_replacementConstructionSize};
     ScTemplateTriples nextCheckedTemplateTriples{
         m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx]};
     UsedConnectors nextUsedReplacementConnectors{
@@ -748,7 +1232,11 @@ private:
         break;
       }
 
-      auto & notUsedConnectorsInCurrentTemplateTriple = m_notUsedConnectorsInTemplateTriples[templateTriple->m_index];
+      // sc-connectors of start triple are divided between parts of parallel search
+      if (isRootIteration && m_rootPartsCount > 1 && replacementTriple[1].Hash() % m_rootPartsCount != m_rootPartIdx)
+        continue;
+
+      auto & notUsedConnectorsInCurrentTemplateTriple = m_notUsedConnectorsInTemplateTriples[templateTripleIdx];
       if (notUsedConnectorsInCurrentTemplateTriple.find(replacementTriple[1])
           != notUsedConnectorsInCurrentTemplateTriple.cend())
         continue;
@@ -806,7 +1294,7 @@ private:
 
           ReserveResult(replacementConstructionIdx, result);
 
-          result.m_replacementConstructions.emplace_back(nextResultReplacementTriples);
+          result.AppendReplacementConstruction(nextResultReplacementTriples.data());
           m_checkedTemplateTriplesInReplacementConstructions.emplace_back(nextCheckedTemplateTriples);
           m_usedConnectorsInReplacementConstructions.emplace_back(DEFAULT_RESULT_RESERVE_SIZE);
 
@@ -817,8 +1305,10 @@ private:
             m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx];
         if (!isForLastTemplateTripleAllChildrenFinished)
         {
-          result.m_replacementConstructions[replacementConstructionIdx].assign(
-              nextResultReplacementTriples.cbegin(), nextResultReplacementTriples.cend());
+          std::copy(
+              nextResultReplacementTriples.cbegin(),
+              nextResultReplacementTriples.cend(),
+              result.GetReplacementConstruction(replacementConstructionIdx));
           checkedTemplateTriplesInCurrentReplacementConstruction = nextCheckedTemplateTriples;
           m_usedConnectorsInReplacementConstructions[replacementConstructionIdx] = nextUsedReplacementConnectors;
         }
@@ -831,19 +1321,17 @@ private:
 
         templateTripleIdx = *templateTriplesIterator;
 
-        templateTriple = m_template.m_templateTriples[templateTripleIdx];
-
         if (checkedTemplateTriplesInCurrentReplacementConstruction.find(templateTripleIdx)
             != checkedTemplateTriplesInCurrentReplacementConstruction.cend())
           continue;
 
-        ScAddrVector & replacementConstruction = result.m_replacementConstructions[replacementConstructionIdx];
+        ScAddr const * replacementConstruction = result.GetReplacementConstruction(replacementConstructionIdx);
 
         bool isFinished = true;
-        auto const & items = templateTriple->GetValues();
+        auto const & items = m_triples[templateTripleIdx].m_items;
         for (size_t i = 0; i < items.size(); ++i)
         {
-          ScAddr const & resolvedAddr = ResolveAddr(items[i], replacementConstruction, result);
+          ScAddr const & resolvedAddr = ResolveAddr(items[i], replacementConstruction);
           if (resolvedAddr.IsValid() && resolvedAddr != replacementTriple[i])
           {
             isForLastTemplateTripleAllChildrenFinished = false;
@@ -857,7 +1345,7 @@ private:
 
         // update data
         {
-          UpdateResult(templateTriple, replacementConstructionIdx, replacementTriple, result);
+          UpdateResult(templateTripleIdx, replacementConstructionIdx, replacementTriple, result);
         }
 
         // find next depended on triples and analyse result
@@ -867,8 +1355,8 @@ private:
 
           // first of all check triples by connector, it is more effectively
           if (DoDependenceIterationByItem(
-                  templateTriple,
-                  items[1],
+                  templateTripleIdx,
+                  1,
                   replacementConstructionIdx,
                   templateTriples,
                   childrenTemplateTriples,
@@ -876,8 +1364,8 @@ private:
                   isForLastTemplateTripleAllChildrenFinished,
                   isLastTemplateTripleHasNoChildren)
               || DoDependenceIterationByItem(
-                  templateTriple,
-                  items[0],
+                  templateTripleIdx,
+                  0,
                   replacementConstructionIdx,
                   templateTriples,
                   childrenTemplateTriples,
@@ -885,8 +1373,8 @@ private:
                   isForLastTemplateTripleAllChildrenFinished,
                   isLastTemplateTripleHasNoChildren)
               || DoDependenceIterationByItem(
-                  templateTriple,
-                  items[2],
+                  templateTripleIdx,
+                  2,
                   replacementConstructionIdx,
                   templateTriples,
                   childrenTemplateTriples,
@@ -900,7 +1388,11 @@ private:
                   otherTemplateTripleIdx);
             }
             childrenTemplateTriples.clear();
-            ClearResult(templateTripleIdx, replacementConstructionIdx, replacementConstruction);
+            // found replacement constructions may be appended to result, so position of construction is changed
+            ClearResult(
+                templateTripleIdx,
+                replacementConstructionIdx,
+                result.GetReplacementConstruction(replacementConstructionIdx));
             continue;
           }
 
@@ -922,55 +1414,83 @@ private:
 
       // there are no next triples for current triple, it is last
       if (isLastTemplateTripleHasNoChildren && isForLastTemplateTripleAllChildrenFinished
-          && m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].size()
-                 == m_template.m_templateTriples.size())
+          && m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].size() == m_triples.size())
       {
+        UpdateReplacementsPositions(result);
+
         if (!m_filterCallback
             || m_filterCallback(
                 {&m_context,
-                 result.m_replacementConstructions[replacementConstructionIdx],
-                 result.m_templateItemsNamesToReplacementItemsPositions}))
+                 result.m_replacementConstructions,
+                 replacementConstructionIdx * result.m_replacementConstructionSize,
+                 result.m_replacementConstructionSize,
+                 &result.m_templateItemsNamesToReplacementItemsPositions}))
           AppendFoundReplacementConstruction(result, replacementConstructionIdx);
       }
     }
-    while (!isStopped);
+    while (!IsStopped());
+
+    --m_depth;
+  }
+
+  bool IsStopped() const
+  {
+    return isStopped || (m_isSearchStopped != nullptr && m_isSearchStopped->load(std::memory_order_relaxed));
   }
 
   void UpdateResult(
-      ScTemplateTriple const * templateTriple,
+      size_t const templateTripleIdx,
       size_t const replacementConstructionIdx,
       ScAddrTriple const & replacementTriple,
       ScTemplateSearchResult & result)
   {
-    auto const & UpdateResultByItem =
-        [&result](ScTemplateItem const & item, ScAddr const & addr, size_t const elementNum, ScAddrVector & resultAddrs)
-    {
-      resultAddrs[elementNum] = addr;
-
-      if (item.m_name.empty())
-        return;
-
-      result.m_templateItemsNamesToReplacementItemsPositions[item.m_name] = elementNum;
-    };
-
-    m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].insert(templateTriple->m_index);
+    m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].insert(templateTripleIdx);
     m_usedConnectorsInReplacementConstructions[replacementConstructionIdx].insert(replacementTriple[1]);
 
-    size_t itemIdx = templateTriple->m_index * 3;
+    size_t const itemIdx = templateTripleIdx * 3;
     for (size_t i = replacementConstructionIdx; i < result.Size(); ++i)
     {
-      ScAddrVector & resultAddrs = result.m_replacementConstructions[i];
+      ScAddr * resultAddrs = result.GetReplacementConstruction(i);
+
+      resultAddrs[itemIdx] = replacementTriple[0];
+      resultAddrs[itemIdx + 1] = replacementTriple[1];
+      resultAddrs[itemIdx + 2] = replacementTriple[2];
+    }
+
+    auto const & items = m_triples[templateTripleIdx].m_items;
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+      size_t const slot = items[i].m_slot;
+      if (slot == NO_SLOT || m_slotsPositions[slot] == itemIdx + i)
+        continue;
 
-      UpdateResultByItem((*templateTriple)[0], replacementTriple[0], itemIdx, resultAddrs);
-      UpdateResultByItem((*templateTriple)[1], replacementTriple[1], itemIdx + 1, resultAddrs);
-      UpdateResultByItem((*templateTriple)[2], replacementTriple[2], itemIdx + 2, resultAddrs);
+      m_slotsPositions[slot] = itemIdx + i;
+      m_isSlotsPositionsChanged = true;
     }
   };
 
+  /*!
+   * Updates map of replacement names to their positions in result by slots positions. It is done only when result
+   * items are passed to user, because search resolves replacements by slots.
+   */
+  void UpdateReplacementsPositions(ScTemplateSearchResult & result)
+  {
+    if (!m_isSlotsPositionsChanged)
+      return;
+
+    for (size_t slot = 0; slot < m_slotsPositions.size(); ++slot)
+    {
+      if (m_slotsPositions[slot] != NO_POSITION)
+        result.m_templateItemsNamesToReplacementItemsPositions[m_slotsNames[slot]] = m_slotsPositions[slot];
+    }
+
+    m_isSlotsPositionsChanged = false;
+  }
+
   void ClearResult(
       size_t const tripleIdx,
       size_t const replacementConstructionIdx,
-      ScAddrVector & replacementConstruction)
+      ScAddr * replacementConstruction)
   {
     m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].erase(tripleIdx);
 
@@ -989,20 +1509,26 @@ private:
     {
       m_callback(
           {&m_context,
-           result.m_replacementConstructions[resultIdx],
-           result.m_templateItemsNamesToReplacementItemsPositions});
+           result.m_replacementConstructions,
+           resultIdx * result.m_replacementConstructionSize,
+           result.m_replacementConstructionSize,
+           &result.m_templateItemsNamesToReplacementItemsPositions});
     }
     else if (m_callbackWithRequest)
     {
       ScTemplateSearchRequest const & request = m_callbackWithRequest(
           {&m_context,
-           result.m_replacementConstructions[resultIdx],
-           result.m_templateItemsNamesToReplacementItemsPositions});
+           result.m_replacementConstructions,
+           resultIdx * result.m_replacementConstructionSize,
+           result.m_replacementConstructionSize,
+           &result.m_templateItemsNamesToReplacementItemsPositions});
       switch (request)
       {
       case ScTemplateSearchRequest::STOP:
       {
         isStopped = true;
+        if (m_isSearchStopped != nullptr)
+          *m_isSearchStopped = true;
         break;
       }
       case ScTemplateSearchRequest::ERROR:
@@ -1023,11 +1549,262 @@ private:
       return;
 
     ++m_resultReserveCount;
-    result.m_replacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE * m_resultReserveCount);
+    result.m_replacementConstructions.reserve(
+        DEFAULT_RESULT_RESERVE_SIZE * m_resultReserveCount * result.m_replacementConstructionSize);
     m_checkedTemplateTriplesInReplacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE * m_resultReserveCount);
     m_usedConnectorsInReplacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE * m_resultReserveCount);
   }
 
+  bool IsJoinElementChecked(ScAddr const & addr)
+  {
+    return (!IsStructureValid() || IsInStructure(addr)) && (!m_checkCallback || m_checkCallback(addr));
+  }
+
+  ScAddr const & ResolveJoinItem(size_t const tripleIdx, size_t const itemIdx) const
+  {
+    size_t const variable = m_joinTriples[tripleIdx].m_variables[itemIdx / 2];
+    return variable == NO_VARIABLE ? GetFixedAddr(m_triples[tripleIdx].m_items[itemIdx])
+                                   : m_joinVariablesAddrs[variable];
+  }
+
+  /*!
+   * Gets sc-elements adjacent to sc-element of bound item of triple, sorted by their hashes. They are collected once
+   * for each sc-element during search, so sc-connectors of the same sc-element aren't iterated again for other
+   * candidates.
+   */
+  ScTemplateJoinAdjacentElements const & GetJoinAdjacentElements(size_t const tripleIdx, ScAddr const & boundAddr)
+  {
+    auto & tripleAdjacentElements = m_joinAdjacentElements[tripleIdx];
+    auto const & it = tripleAdjacentElements.find(boundAddr.Hash());
+    if (it != tripleAdjacentElements.cend())
+      return it->second;
+
+    ScTemplateJoinAdjacentElements & adjacentElements = tripleAdjacentElements[boundAddr.Hash()];
+
+    auto const & items = m_triples[tripleIdx].m_items;
+    bool const isSourceBound = m_joinTriples[tripleIdx].m_boundItemIdx == 0;
+    ScIterator3Ptr iterator;
+    if (isSourceBound)
+      iterator = m_context.CreateIterator3(boundAddr, items[1].m_iteratorType, items[2].m_iteratorType);
+    else
+      iterator = m_context.CreateIterator3(items[0].m_iteratorType, items[1].m_iteratorType, boundAddr);
+    while (iterator->Next())
+    {
+      ScAddr const & connectorAddr = iterator->Get(1);
+      ScAddr const & elementAddr = iterator->Get(isSourceBound ? 2 : 0);
+      if (IsJoinElementChecked(connectorAddr) && IsJoinElementChecked(elementAddr))
+        adjacentElements.push_back({elementAddr.Hash(), elementAddr, connectorAddr});
+    }
+
+    std::sort(
+        adjacentElements.begin(),
+        adjacentElements.end(),
+        [](ScTemplateJoinAdjacentElement const & element, ScTemplateJoinAdjacentElement const & otherElement)
+        {
+          return element.m_elementHash < otherElement.m_elementHash;
+        });
+    return adjacentElements;
+  }
+
+  static auto FindJoinAdjacentElements(ScTemplateJoinAdjacentElements const & elements, ScAddr::HashType const hash)
+  {
+    return std::equal_range(
+        elements.cbegin(),
+        elements.cend(),
+        ScTemplateJoinAdjacentElement{hash, ScAddr::Empty, ScAddr::Empty},
+        [](ScTemplateJoinAdjacentElement const & element, ScTemplateJoinAdjacentElement const & otherElement)
+        {
+          return element.m_elementHash < otherElement.m_elementHash;
+        });
+  }
+
+  /*!
+   * Binds variable of step to each sc-element adjacent to known sc-elements by all triples of step. Sorted lists of
+   * adjacent sc-elements are intersected as in leapfrog join: the shortest list is iterated and the other lists are
+   * sought forward by hash of its sc-element.
+   */
+  void DoJoinIteration(size_t const stepIdx, ScTemplateSearchResult & result)
+  {
+    if (stepIdx == m_joinSteps.size())
+    {
+      DoJoinConnectorsIteration(0, result);
+      return;
+    }
+
+    ScTemplateJoinStep const & step = m_joinSteps[stepIdx];
+
+    std::vector<ScTemplateJoinAdjacentElements const *> adjacentElementsLists;
+    adjacentElementsLists.reserve(step.m_triples.size());
+    for (size_t const tripleIdx : step.m_triples)
+    {
+      ScTemplateJoinAdjacentElements const & adjacentElements =
+          GetJoinAdjacentElements(tripleIdx, ResolveJoinItem(tripleIdx, m_joinTriples[tripleIdx].m_boundItemIdx));
+      if (adjacentElements.empty())
+        return;
+
+      adjacentElementsLists.push_back(&adjacentElements);
+    }
+
+    std::iter_swap(
+        adjacentElementsLists.begin(),
+        std::min_element(
+            adjacentElementsLists.begin(),
+            adjacentElementsLists.end(),
+            [](ScTemplateJoinAdjacentElements const * elements, ScTemplateJoinAdjacentElements const * otherElements)
+            {
+              return elements->size() < otherElements->size();
+            }));
+
+    ScTemplateJoinAdjacentElements const & shortestElements = *adjacentElementsLists.front();
+    std::vector<ScTemplateJoinAdjacentElements::const_iterator> positions;
+    positions.reserve(adjacentElementsLists.size());
+    for (ScTemplateJoinAdjacentElements const * elements : adjacentElementsLists)
+      positions.push_back(elements->cbegin());
+
+    for (auto it = shortestElements.cbegin(); it != shortestElements.cend() && !IsStopped(); ++it)
+    {
+      ScAddr::HashType const hash = it->m_elementHash;
+      if (it != shortestElements.cbegin() && std::prev(it)->m_elementHash == hash)
+        continue;
+
+      // candidates of start variable are divided between parts of parallel search
+      if (stepIdx == 0 && m_rootPartsCount > 1 && hash % m_rootPartsCount != m_rootPartIdx)
+        continue;
+
+      bool isIntersected = true;
+      for (size_t listIdx = 1; listIdx < adjacentElementsLists.size() && isIntersected; ++listIdx)
+      {
+        auto & position = positions[listIdx];
+        position = std::lower_bound(
+            position,
+            adjacentElementsLists[listIdx]->cend(),
+            hash,
+            [](ScTemplateJoinAdjacentElement const & element, ScAddr::HashType const elementHash)
+            {
+              return element.m_elementHash < elementHash;
+            });
+        isIntersected = position != adjacentElementsLists[listIdx]->cend() && position->m_elementHash == hash;
+      }
+
+      if (!isIntersected)
+        continue;
+
+      ScAddr const & elementAddr = it->m_elementAddr;
+      m_joinVariablesAddrs[step.m_variable] = elementAddr;
+
+      bool isLooped = true;
+      for (size_t const tripleIdx : step.m_loopTriples)
+      {
+        auto const [beginIt, endIt] = FindJoinAdjacentElements(GetJoinAdjacentElements(tripleIdx, elementAddr), hash);
+        if (beginIt == endIt)
+        {
+          isLooped = false;
+          break;
+        }
+      }
+
+      if (isLooped)
+        DoJoinIteration(stepIdx + 1, result);
+    }
+  }
+
+  /*!
+   * When all sources and targets of triples are known, iterates sc-connectors between them. Different triples can't
+   * have the same sc-connector, and sc-connectors of equal triples between the same sc-elements are taken in order of
+   * their hashes.
+   */
+  void DoJoinConnectorsIteration(size_t const tripleIdx, ScTemplateSearchResult & result)
+  {
+    if (tripleIdx == m_triples.size())
+    {
+      AppendFoundJoinConstruction(result);
+      return;
+    }
+
+    size_t const boundItemIdx = m_joinTriples[tripleIdx].m_boundItemIdx;
+    ScAddr const & boundAddr = ResolveJoinItem(tripleIdx, boundItemIdx);
+    ScAddr const & otherAddr = ResolveJoinItem(tripleIdx, 2 - boundItemIdx);
+
+    auto const [beginIt, endIt] =
+        FindJoinAdjacentElements(GetJoinAdjacentElements(tripleIdx, boundAddr), otherAddr.Hash());
+    for (auto it = beginIt; it != endIt && !IsStopped(); ++it)
+    {
+      ScAddr const & connectorAddr = it->m_connectorAddr;
+
+      size_t const equalTripleIdx = m_joinTriples[tripleIdx].m_equalTripleIdx;
+      if (equalTripleIdx != NO_TRIPLE && m_joinConstruction[equalTripleIdx * 3 + 1].Hash() >= connectorAddr.Hash())
+        continue;
+
+      bool isUsed = false;
+      for (size_t previousTripleIdx = 0; previousTripleIdx < tripleIdx && !isUsed; ++previousTripleIdx)
+        isUsed = m_joinConstruction[previousTripleIdx * 3 + 1] == connectorAddr;
+      if (isUsed)
+        continue;
+
+      size_t const itemIdx = tripleIdx * 3;
+      m_joinConstruction[itemIdx + boundItemIdx] = boundAddr;
+      m_joinConstruction[itemIdx + 1] = connectorAddr;
+      m_joinConstruction[itemIdx + 2 - boundItemIdx] = otherAddr;
+
+      DoJoinConnectorsIteration(tripleIdx + 1, result);
+    }
+  }
+
+  void AppendFoundJoinConstruction(ScTemplateSearchResult & result)
+  {
+    if (m_filterCallback
+        && !m_filterCallback(
+            {&m_context,
+             m_joinConstruction,
+             0,
+             result.m_replacementConstructionSize,
+             &result.m_templateItemsNamesToReplacementItemsPositions}))
+      return;
+
+    // found sc-constructions are stored in result only if there are no callbacks to pass them to
+    size_t resultIdx = 0;
+    if (m_callback || m_callbackWithRequest)
+      std::copy(m_joinConstruction.cbegin(), m_joinConstruction.cend(), result.GetReplacementConstruction(resultIdx));
+    else
+    {
+      resultIdx = result.Size();
+      result.AppendReplacementConstruction(m_joinConstruction.data());
+    }
+
+    AppendFoundReplacementConstruction(result, resultIdx);
+  }
+
+  void DoJoinIterations(ScTemplateSearchResult & result)
+  {
+    for (size_t tripleIdx = 0; tripleIdx < m_triples.size(); ++tripleIdx)
+    {
+      auto const & items = m_triples[tripleIdx].m_items;
+      for (size_t i = 0; i < items.size(); ++i)
+      {
+        ScAddr const & fixedAddr = GetFixedAddr(items[i]);
+        if (fixedAddr.IsValid() && !IsJoinElementChecked(fixedAddr))
+          return;
+
+        if (items[i].m_slot != NO_SLOT && m_slotsPositions[items[i].m_slot] == NO_POSITION)
+        {
+          m_slotsPositions[items[i].m_slot] = tripleIdx * 3 + i;
+          m_isSlotsPositionsChanged = true;
+        }
+      }
+    }
+    UpdateReplacementsPositions(result);
+
+    for (size_t const tripleIdx : m_joinFixedTriples)
+    {
+      auto const [beginIt, endIt] = FindJoinAdjacentElements(
+          GetJoinAdjacentElements(tripleIdx, ResolveJoinItem(tripleIdx, 0)), ResolveJoinItem(tripleIdx, 2).Hash());
+      if (beginIt == endIt)
+        return;
+    }
+
+    DoJoinIteration(0, result);
+  }
+
   void DoIterations(ScTemplateSearchResult & result)
   {
     if (m_template.IsEmpty())
@@ -1035,11 +1812,23 @@ private:
 
     ScAddrVector newResult;
     newResult.resize(CalculateOneResultSize());
-    result.m_replacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE);
-    result.m_replacementConstructions.emplace_back(newResult);
+    result.m_replacementConstructionSize = newResult.size();
+    result.m_replacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE * result.m_replacementConstructionSize);
+    result.AppendReplacementConstruction(newResult.data());
+
+    m_slotsPositions.assign(m_slotsNames.size(), NO_POSITION);
+
+    if (IsJoinSearch())
+    {
+      m_joinVariablesAddrs.assign(m_joinVariablesCount, ScAddr::Empty);
+      m_joinConstruction.assign(result.m_replacementConstructionSize, ScAddr::Empty);
+      m_joinAdjacentElements.assign(m_triples.size(), {});
+      DoJoinIterations(result);
+      return;
+    }
 
-    m_notUsedConnectorsInTemplateTriples.resize(m_template.Size());
-    m_usedConnectorsInTemplateTriples.resize(m_template.Size());
+    m_notUsedConnectorsInTemplateTriples.resize(m_triples.size());
+    m_usedConnectorsInTemplateTriples.resize(m_triples.size());
     m_usedConnectorsInReplacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE);
     m_usedConnectorsInReplacementConstructions.emplace_back();
     m_checkedTemplateTriplesInReplacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE);
@@ -1050,25 +1839,31 @@ private:
     bool isFinished = false;
     bool isLast = false;
 
-    auto const & startTriples = m_template.Size() == 1 ? ScTemplateTriples{m_template.m_templateTriples[0]->m_index}
-                                                       : m_connectivityComponentPriorityTemplateTriples;
-    DoIterationOnNextEqualTriples(startTriples, "", 0, {}, childrenTemplateTriples, result, isFinished, isLast);
+    DoIterationOnNextEqualTriples(
+        m_startTemplateTriples, NO_SLOT, 0, {}, childrenTemplateTriples, result, isFinished, isLast);
   }
 
 public:
   ScTemplate::Result operator()(ScTemplateSearchResult & result)
   {
     result.Clear();
+    SC_METRICS_START(startTime);
     DoIterations(result);
+    SC_METRICS_RECORD(SC_METRIC_TEMPLATE_SEARCH_RUN, startTime);
+    UpdateReplacementsPositions(result);
 
-    std::vector<ScAddrVector> checkedResults;
-    checkedResults.reserve(result.Size());
+    ScAddrVector checkedResults;
+    checkedResults.reserve(m_foundReplacementConstructions.size() * result.m_replacementConstructionSize);
     for (size_t const foundIdx : m_foundReplacementConstructions)
     {
-      checkedResults.emplace_back(result.m_replacementConstructions[foundIdx]);
+      ScAddr const * foundReplacementConstruction = result.GetReplacementConstruction(foundIdx);
+      checkedResults.insert(
+          checkedResults.end(),
+          foundReplacementConstruction,
+          foundReplacementConstruction + result.m_replacementConstructionSize);
     }
     result.m_context = &m_context;
-    result.m_replacementConstructions.assign(checkedResults.cbegin(), checkedResults.cend());
+    result.m_replacementConstructions.swap(checkedResults);
 
     return ScTemplate::Result(result.Size() > 0);
   }
@@ -1076,73 +1871,991 @@ public:
   void operator()()
   {
     ScTemplateSearchResult result;
+    SC_METRICS_START(startTime);
     DoIterations(result);
+    SC_METRICS_RECORD(SC_METRIC_TEMPLATE_SEARCH_RUN, startTime);
   }
 
-  size_t CalculateOneResultSize() const
+  /*!
+   * Checks if search can be divided between `threadsCount` threads. Search is divided by sc-connectors of start triple,
+   * so sc-template must have the only start triple and this triple must not be equal to other triples of sc-template,
+   * otherwise one sc-connector can be found for different triples in different threads. Filter and check callbacks
+   * are called for each candidate and aren't required to be thread-safe, so search with them isn't divided.
+   */
+  bool IsParallelizable(size_t const threadsCount) const
   {
-    return m_template.Size() * 3;
-  }
+    if (threadsCount < 2 || m_template.IsEmpty() || m_filterCallback || m_checkCallback)
+      return false;
 
-private:
-  ScTemplate & m_template;
-  ScMemoryContext & m_context;
+    // candidates of the first variable are divided between threads
+    if (IsJoinSearch())
+      return true;
 
-  // fields for template preprocessing
-  std::map<std::string, ScTemplateTriples> m_templateItemsNamesToDependedTemplateTriples;
-  ScTemplateTriples m_cycledTemplateTriples;
-  std::vector<ScTemplateTriples> m_connectivityComponentsTemplateTriples;
-  ScTemplateTriples m_connectivityComponentPriorityTemplateTriples;
+    if (m_connectivityComponentsTemplateTriples.size() != 1 || m_startTemplateTriples.size() != 1)
+      return false;
 
-  // fields search by template
-  std::vector<UsedConnectors> m_notUsedConnectorsInTemplateTriples;
-  std::vector<UsedConnectors> m_usedConnectorsInTemplateTriples;
-  std::vector<UsedConnectors> m_usedConnectorsInReplacementConstructions;
-  std::vector<ScTemplateTriples> m_checkedTemplateTriplesInReplacementConstructions;
+    size_t const startTripleIdx = m_startTemplateTriples.front();
+    for (size_t tripleIdx = 0; tripleIdx < m_triples.size(); ++tripleIdx)
+    {
+      if (tripleIdx != startTripleIdx && IsTriplesEqual(startTripleIdx, tripleIdx))
+        return false;
+    }
 
-  size_t const DEFAULT_RESULT_RESERVE_SIZE = 512;
-  size_t m_resultReserveCount = 1;
-  size_t m_lastReplacementConstructionIdx = 0;
-  std::unordered_set<size_t> m_foundReplacementConstructions;
+    return true;
+  }
 
-  // fields for append result handling
-  bool isStopped = false;
+  ScTemplate::Result SearchInParallel(ScTemplateSearchResult & result, size_t const threadsCount)
+  {
+    std::vector<ScTemplateSearchResult> partsResults(threadsCount);
+    RunInParallel(
+        threadsCount,
+        [&partsResults](ScTemplateSearch & search, size_t const partIdx)
+        {
+          search(partsResults[partIdx]);
+        });
 
-  ScAddr const m_structure;
-  ScTemplateSearchResultCallback m_callback;
-  ScTemplateSearchResultCallbackWithRequest m_callbackWithRequest;
-  ScTemplateSearchResultFilterCallback m_filterCallback;
-  ScTemplateSearchResultCheckCallback m_checkCallback;
-};
+    result.Clear();
+    for (ScTemplateSearchResult & partResult : partsResults)
+    {
+      if (partResult.IsEmpty())
+        continue;
 
-ScTemplate::Result ScTemplate::Search(ScMemoryContext & ctx, ScTemplateSearchResult & result) const
-{
-  ScTemplateSearch search(const_cast<ScTemplate &>(*this), ctx, ScAddr::Empty);
-  return search(result);
-}
+      result.m_replacementConstructionSize = partResult.m_replacementConstructionSize;
+      result.m_replacementConstructions.insert(
+          result.m_replacementConstructions.end(),
+          partResult.m_replacementConstructions.cbegin(),
+          partResult.m_replacementConstructions.cend());
+      result.m_templateItemsNamesToReplacementItemsPositions.insert(
+          partResult.m_templateItemsNamesToReplacementItemsPositions.cbegin(),
+          partResult.m_templateItemsNamesToReplacementItemsPositions.cend());
+    }
+    result.m_context = &m_context;
 
-void ScTemplate::Search(
-    ScMemoryContext & ctx,
-    ScTemplateSearchResultCallback const & callback,
-    ScTemplateSearchResultFilterCallback const & filterCallback,
-    ScTemplateSearchResultCheckCallback const & checkCallback) const
-{
-  ScTemplateSearch search(const_cast<ScTemplate &>(*this), ctx, ScAddr::Empty);
-  search.SetCallback(callback);
-  search.SetFilterCallback(filterCallback);
-  search.SetCheckCallback(checkCallback);
-  search();
-}
+    return ScTemplate::Result(result.Size() > 0);
+  }
 
-void ScTemplate::Search(
+  void SearchInParallel(size_t const threadsCount)
+  {
+    // callbacks are called by one thread at a time and are not called after search is stopped in any thread
+    auto const callback = m_callback;
+    if (callback)
+      m_callback = [this, callback](ScTemplateSearchResultItem const & item)
+      {
+        std::lock_guard<std::mutex> lock(m_callbacksMutex);
+        if (!m_isPartsSearchStopped)
+          callback(item);
+      };
+
+    auto const callbackWithRequest = m_callbackWithRequest;
+    if (callbackWithRequest)
+      m_callbackWithRequest = [this, callbackWithRequest](ScTemplateSearchResultItem const & item)
+      {
+        std::lock_guard<std::mutex> lock(m_callbacksMutex);
+        if (m_isPartsSearchStopped)
+          return ScTemplateSearchRequest::STOP;
+
+        ScTemplateSearchRequest const request = callbackWithRequest(item);
+        if (request != ScTemplateSearchRequest::CONTINUE)
+          m_isPartsSearchStopped = true;
+        return request;
+      };
+
+    RunInParallel(
+        threadsCount,
+        [](ScTemplateSearch & search, size_t const)
+        {
+          search();
+        });
+  }
+
+  /*!
+   * Prepares search to find sc-constructions one by one by cursor. Triples are ordered as they are visited by search
+   * plan, so each next triple has sc-elements found for previous triples. Triples which aren't reached by search plan
+   * are placed at the end in order they become depended on already ordered triples.
+   */
+  void PrepareCursor()
+  {
+    m_cursorTriples.clear();
+    m_cursorTriples.reserve(m_triples.size());
+
+    std::vector<bool> orderedTriples(m_triples.size(), false);
+    for (size_t const startTripleIdx : m_startTemplateTriples)
+      OrderCursorTriples(startTripleIdx, orderedTriples);
+
+    std::vector<bool> boundSlots(m_slotsNames.size(), false);
+    for (size_t const tripleIdx : m_cursorTriples)
+    {
+      for (auto const & item : m_triples[tripleIdx].m_items)
+      {
+        if (item.m_slot != NO_SLOT)
+          boundSlots[item.m_slot] = true;
+      }
+    }
+
+    while (m_cursorTriples.size() < m_triples.size())
+    {
+      size_t nextTripleIdx = NO_POSITION;
+      for (size_t tripleIdx = 0; tripleIdx < m_triples.size() && nextTripleIdx == NO_POSITION; ++tripleIdx)
+      {
+        if (orderedTriples[tripleIdx])
+          continue;
+
+        for (auto const & item : m_triples[tripleIdx].m_items)
+        {
+          if (GetFixedAddr(item).IsValid() || (item.m_slot != NO_SLOT && boundSlots[item.m_slot]))
+          {
+            nextTripleIdx = tripleIdx;
+            break;
+          }
+        }
+      }
+
+      // there are no triples that can be searched, iterator for the first of rest triples will not be created
+      if (nextTripleIdx == NO_POSITION)
+        nextTripleIdx = std::find(orderedTriples.cbegin(), orderedTriples.cend(), false) - orderedTriples.cbegin();
+
+      orderedTriples[nextTripleIdx] = true;
+      m_cursorTriples.push_back(nextTripleIdx);
+      for (auto const & item : m_triples[nextTripleIdx].m_items)
+      {
+        if (item.m_slot != NO_SLOT)
+          boundSlots[item.m_slot] = true;
+      }
+    }
+
+    m_slotsPositions.assign(m_slotsNames.size(), NO_POSITION);
+    m_cursorReplacements.clear();
+    for (size_t const tripleIdx : m_cursorTriples)
+    {
+      auto const & items = m_triples[tripleIdx].m_items;
+      for (size_t i = 0; i < items.size(); ++i)
+      {
+        if (items[i].m_slot != NO_SLOT)
+          m_cursorReplacements.insert({m_slotsNames[items[i].m_slot], tripleIdx * 3 + i});
+      }
+    }
+
+    m_cursorConstruction.assign(CalculateOneResultSize(), ScAddr::Empty);
+    m_cursorIterators.assign(m_triples.size(), {});
+    m_isCursorStarted = false;
+    m_isCursorFinished = m_triples.empty();
+  }
+
+  /*!
+   * Finds next sc-construction by cursor. Search continues from the last triple: if there are no more sc-connectors for
+   * triple, then search returns to previous triple and iterates its next sc-connector.
+   */
+  bool NextCursorConstruction()
+  {
+    if (m_isCursorFinished)
+      return false;
+
+    size_t level = m_cursorTriples.size() - 1;
+    if (!m_isCursorStarted)
+    {
+      m_isCursorStarted = true;
+      level = 0;
+      OpenCursorIterator(level);
+    }
+
+    while (true)
+    {
+      if (NextCursorTriple(level))
+      {
+        if (level + 1 == m_cursorTriples.size())
+          return true;
+
+        OpenCursorIterator(++level);
+        continue;
+      }
+
+      m_cursorIterators[level].reset();
+      if (level == 0)
+      {
+        m_isCursorFinished = true;
+        return false;
+      }
+
+      --level;
+    }
+  }
+
+  void GetCursorConstruction(ScTemplateResultItem & outItem)
+  {
+    outItem.SetView(&m_context, m_cursorConstruction, 0, m_cursorConstruction.size(), &m_cursorReplacements);
+  }
+
+  ScTemplate::ScTemplateItemsToReplacementsItemsPositions const & GetCursorReplacements() const
+  {
+    return m_cursorReplacements;
+  }
+
+  /*!
+   * Returns false if sc-connector specified for search can't be the second item of triple specified for search.
+   */
+  bool IsConnectorMatched() const
+  {
+    return m_isConnectorMatched;
+  }
+
+  /*!
+   * Collects fixed sources or targets of sc-connectors of all triples. Returns false if there is triple without fixed
+   * source and target.
+   */
+  bool CollectTriplesFixedElements(ScAddrUnorderedSet & elementsAddrs) const
+  {
+    for (ScTemplateSearchTriple const & triple : m_triples)
+    {
+      ScAddr const & sourceAddr = GetFixedAddr(triple.m_items[0]);
+      ScAddr const & targetAddr = GetFixedAddr(triple.m_items[2]);
+      if (sourceAddr.IsValid())
+        elementsAddrs.insert(sourceAddr);
+      else if (targetAddr.IsValid())
+        elementsAddrs.insert(targetAddr);
+      else
+        return false;
+    }
+
+    return true;
+  }
+
+  size_t CalculateOneResultSize() const
+  {
+    return m_template.Size() * 3;
+  }
+
+  /*!
+   * Describes plan of search: connectivity components of sc-template, triples search starts from, order in which search
+   * goes by depended triples and estimated cardinalities of triples.
+   */
+  std::string Explain() const
+  {
+    std::ostringstream stream;
+    stream << "Search plan of sc-template with " << m_triples.size() << " triple(s)\n";
+
+    if (IsJoinSearch())
+    {
+      stream << "Search by join of " << m_joinSteps.size() << " variable(s):\n";
+      for (ScTemplateJoinStep const & step : m_joinSteps)
+      {
+        stream << "  " << ExplainJoinVariable(step.m_variable) << " by triple(s)";
+        for (size_t const tripleIdx : step.m_triples)
+          stream << " " << tripleIdx;
+        stream << "\n";
+      }
+      return stream.str();
+    }
+
+    size_t componentNumber = 0;
+    for (ScTemplateTriples const & connectivityComponentTriples : m_connectivityComponentsTemplateTriples)
+    {
+      stream << "Connectivity component " << ++componentNumber << " with " << connectivityComponentTriples.size()
+             << " triple(s)";
+
+      auto const & startTripleIt = std::find_if(
+          m_startTemplateTriples.cbegin(),
+          m_startTemplateTriples.cend(),
+          [&connectivityComponentTriples](size_t const tripleIdx)
+          {
+            return connectivityComponentTriples.find(tripleIdx) != connectivityComponentTriples.cend();
+          });
+      if (startTripleIt == m_startTemplateTriples.cend())
+      {
+        stream << " has no triples with fixed sc-elements to start search from\n";
+        continue;
+      }
+
+      stream << ":\n";
+      std::vector<bool> explainedTriples(m_triples.size(), false);
+      ExplainTriple(stream, *startTripleIt, NO_SLOT, 1, explainedTriples);
+    }
+
+    return stream.str();
+  }
+
+private:
+  void OrderCursorTriples(size_t const tripleIdx, std::vector<bool> & orderedTriples)
+  {
+    if (orderedTriples[tripleIdx])
+      return;
+
+    orderedTriples[tripleIdx] = true;
+    m_cursorTriples.push_back(tripleIdx);
+
+    // search goes by sc-connector item at first
+    for (size_t const itemIdx : {1, 0, 2})
+    {
+      for (size_t const dependedTripleIdx : GetDependedTriples(tripleIdx, itemIdx))
+        OrderCursorTriples(dependedTripleIdx, orderedTriples);
+    }
+  }
+
+  void OpenCursorIterator(size_t const level)
+  {
+    ScIterator3Ptr it = CreateIterator(m_triples[m_cursorTriples[level]], m_cursorConstruction.data());
+    if (!it || !it->IsValid())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidState,
+          "Fully variable triple was selected during searching by specified sc-template. It is possible that you have "
+          "incorrect sc-template or you can't find constructions in knowledge base using this sc-template. Check "
+          "sc-template.");
+
+    m_cursorIterators[level] = it;
+  }
+
+  void ClearCursorTriple(size_t const tripleIdx)
+  {
+    auto const & items = m_triples[tripleIdx].m_items;
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+      size_t const position = tripleIdx * 3 + i;
+      size_t const slot = items[i].m_slot;
+      if (slot != NO_SLOT && m_slotsPositions[slot] == position)
+        m_slotsPositions[slot] = NO_POSITION;
+
+      m_cursorConstruction[position] = ScAddr::Empty;
+    }
+  }
+
+  bool IsCursorConnectorUsed(size_t const level, ScAddr const & connectorAddr) const
+  {
+    for (size_t previousLevel = 0; previousLevel < level; ++previousLevel)
+    {
+      if (m_cursorConstruction[m_cursorTriples[previousLevel] * 3 + 1] == connectorAddr)
+        return true;
+    }
+
+    return false;
+  }
+
+  bool NextCursorTriple(size_t const level)
+  {
+    size_t const tripleIdx = m_cursorTriples[level];
+    auto const & items = m_triples[tripleIdx].m_items;
+    ClearCursorTriple(tripleIdx);
+
+    ScIterator3Ptr const & it = m_cursorIterators[level];
+    while (it->Next())
+    {
+      ScReplacementTriple const & replacementTriple = it->Get();
+      if (IsCursorConnectorUsed(level, replacementTriple[1]))
+        continue;
+
+      if (IsStructureValid()
+          && (!IsInStructure(replacementTriple[0]) || !IsInStructure(replacementTriple[1])
+              || !IsInStructure(replacementTriple[2])))
+        continue;
+
+      bool isMatched = true;
+      for (size_t i = 0; i < items.size(); ++i)
+      {
+        // sc-elements of previous triples and previous items of this triple must be the same
+        ScAddr const & resolvedAddr = ResolveAddr(items[i], m_cursorConstruction.data());
+        if (resolvedAddr.IsValid() && resolvedAddr != replacementTriple[i])
+        {
+          isMatched = false;
+          break;
+        }
+
+        size_t const position = tripleIdx * 3 + i;
+        m_cursorConstruction[position] = replacementTriple[i];
+        if (items[i].m_slot != NO_SLOT && m_slotsPositions[items[i].m_slot] == NO_POSITION)
+          m_slotsPositions[items[i].m_slot] = position;
+      }
+
+      if (isMatched)
+        return true;
+
+      ClearCursorTriple(tripleIdx);
+    }
+
+    return false;
+  }
+
+  /*!
+   * Runs `work` in `threadsCount` threads. Each thread has own sc-memory context of the same user and own search by
+   * plan of this search that finds sc-constructions only for its part of sc-connectors of start triple. If `work`
+   * throws exception in any thread, then search is stopped in all threads and exception is rethrown.
+   */
+  void RunInParallel(
+      size_t const threadsCount,
+      std::function<void(ScTemplateSearch & search, size_t partIdx)> const & work)
+  {
+    ScAddr const & userAddr = m_context.GetUser();
+
+    std::mutex exceptionMutex;
+    std::exception_ptr exception;
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadsCount);
+    for (size_t partIdx = 0; partIdx < threadsCount; ++partIdx)
+    {
+      threads.emplace_back(
+          [&, partIdx]()
+          {
+            try
+            {
+              ScMemoryContext context(userAddr);
+              ScTemplateSearch search(*this, context);
+              search.m_rootPartsCount = threadsCount;
+              search.m_rootPartIdx = partIdx;
+              search.m_isSearchStopped = &m_isPartsSearchStopped;
+              work(search, partIdx);
+            }
+            catch (...)
+            {
+              m_isPartsSearchStopped = true;
+
+              std::lock_guard<std::mutex> lock(exceptionMutex);
+              if (!exception)
+                exception = std::current_exception();
+            }
+          });
+    }
+
+    for (std::thread & thread : threads)
+      thread.join();
+
+    if (exception)
+      std::rethrow_exception(exception);
+  }
+
+  std::string ExplainItem(ScTemplateSearchItem const & item) const
+  {
+    // fixed items have slots named by their sc-addresses too, so they are explained by sc-addresses
+    if (item.m_itemType == ScTemplateItem::Type::Addr)
+      return std::to_string(item.m_addr.Hash());
+
+    if (item.m_slot != NO_SLOT)
+      return "`" + m_slotsNames[item.m_slot] + "`";
+
+    return "_";
+  }
+
+  std::string ExplainJoinVariable(size_t const variable) const
+  {
+    for (size_t tripleIdx = 0; tripleIdx < m_joinTriples.size(); ++tripleIdx)
+    {
+      for (size_t const itemIdx : {0, 2})
+      {
+        ScTemplateSearchItem const & item = m_triples[tripleIdx].m_items[itemIdx];
+        if (m_joinTriples[tripleIdx].m_variables[itemIdx / 2] == variable && item.m_slot != NO_SLOT)
+          return ExplainItem(item);
+      }
+    }
+
+    return "_";
+  }
+
+  void ExplainTriple(
+      std::ostringstream & stream,
+      size_t const tripleIdx,
+      size_t const slot,
+      size_t const depth,
+      std::vector<bool> & explainedTriples) const
+  {
+    explainedTriples[tripleIdx] = true;
+
+    ScTemplateSearchTriple const & triple = m_triples[tripleIdx];
+    auto const & items = triple.m_items;
+
+    stream << std::string(depth * 2, ' ');
+    if (slot != NO_SLOT)
+      stream << "by `" << m_slotsNames[slot] << "` ";
+    stream << "triple " << tripleIdx << " (" << ExplainItem(items[0]) << ", " << ExplainItem(items[1]) << ", "
+           << ExplainItem(items[2]) << ") ";
+    stream << (GetFixedAddr(items[0]).IsValid() ? "F" : "A") << "_" << (GetFixedAddr(items[1]).IsValid() ? "F" : "A")
+           << "_" << (GetFixedAddr(items[2]).IsValid() ? "F" : "A");
+    stream << ", estimated sc-connectors count: ";
+    if (triple.m_cardinality == UNKNOWN_CARDINALITY)
+      stream << "unknown";
+    else
+      stream << triple.m_cardinality;
+    stream << "\n";
+
+    // search goes by sc-connector item at first
+    for (size_t const itemIdx : {1, 0, 2})
+    {
+      for (size_t const dependedTripleIdx : GetDependedTriples(tripleIdx, itemIdx))
+      {
+        if (!explainedTriples[dependedTripleIdx])
+          ExplainTriple(stream, dependedTripleIdx, items[itemIdx].m_slot, depth + 1, explainedTriples);
+      }
+    }
+  }
+
+private:
+  ScTemplate & m_template;
+  ScMemoryContext & m_context;
+
+  // fields of compiled sc-template
+  std::vector<std::string> m_slotsNames;
+  std::vector<ScTemplateSearchTriple> m_triples;
+  std::vector<bool> m_equalTriplesItems;
+
+  // fields for template preprocessing
+  std::vector<std::array<ScTemplateTriples, 3>> m_dependedTemplateTriples;
+  ScTemplateTriples m_cycledTemplateTriples;
+  std::vector<ScTemplateTriples> m_connectivityComponentsTemplateTriples;
+  ScTemplateTriples m_connectivityComponentPriorityTemplateTriples;
+  ScTemplateTriplesIndices m_startTemplateTriples;
+
+  // fields for search by join
+  std::vector<ScTemplateJoinTriple> m_joinTriples;
+  std::vector<ScTemplateJoinStep> m_joinSteps;
+  ScTemplateTriplesIndices m_joinFixedTriples;
+  size_t m_joinVariablesCount = 0;
+  bool m_isJoinEnabled = true;
+  ScAddrVector m_joinVariablesAddrs;
+  ScAddrVector m_joinConstruction;
+  std::vector<std::unordered_map<ScAddr::HashType, ScTemplateJoinAdjacentElements>> m_joinAdjacentElements;
+
+  // fields search by template
+  std::vector<size_t> m_slotsPositions;
+  bool m_isSlotsPositionsChanged = false;
+  std::vector<UsedConnectors> m_notUsedConnectorsInTemplateTriples;
+  std::vector<UsedConnectors> m_usedConnectorsInTemplateTriples;
+  std::vector<UsedConnectors> m_usedConnectorsInReplacementConstructions;
+  std::vector<ScTemplateTriples> m_checkedTemplateTriplesInReplacementConstructions;
+
+  size_t const DEFAULT_RESULT_RESERVE_SIZE = 512;
+  size_t m_resultReserveCount = 1;
+  size_t m_lastReplacementConstructionIdx = 0;
+  std::unordered_set<size_t> m_foundReplacementConstructions;
+
+  // fields for append result handling
+  bool isStopped = false;
+
+  // fields for parallel search
+  size_t m_depth = 0;
+  size_t m_rootPartsCount = 1;
+  size_t m_rootPartIdx = 0;
+  std::atomic_bool * m_isSearchStopped = nullptr;
+  std::atomic_bool m_isPartsSearchStopped{false};
+  std::mutex m_callbacksMutex;
+
+  // fields for search by cursor
+  ScTemplateTriplesIndices m_cursorTriples;
+  std::vector<ScIterator3Ptr> m_cursorIterators;
+  ScAddrVector m_cursorConstruction;
+  ScTemplate::ScTemplateItemsToReplacementsItemsPositions m_cursorReplacements;
+  bool m_isCursorStarted = false;
+  bool m_isCursorFinished = false;
+
+  // fields for search by sc-connector
+  bool m_isConnectorMatched = true;
+
+  ScAddr const m_structure;
+  ScType m_structureType;
+  size_t m_structureElementsCount = UNKNOWN_CARDINALITY;
+  size_t m_structureChecksCount = 0;
+  bool m_isStructureElementsCollected = false;
+  std::unordered_set<ScAddr, ScAddrHashFunc> m_structureElements;
+
+  ScTemplateSearchResultCallback m_callback;
+  ScTemplateSearchResultCallbackWithRequest m_callbackWithRequest;
+  ScTemplateSearchResultFilterCallback m_filterCallback;
+  ScTemplateSearchResultCheckCallback m_checkCallback;
+};
+
+/*!
+ * Searches sc-constructions by several sc-templates in one pass. Triples of each sc-template are ordered as in search
+ * by cursor and inserted into trie: sc-templates with the same first triples share trie nodes, so sc-connectors of
+ * these triples are iterated once for all of them. Replacement names are numbered as slots in order they occur in trie
+ * path, so the same triples of sc-templates are shared even if they have different replacement names.
+ */
+class ScTemplateBatchSearch
+{
+public:
+  ScTemplateBatchSearch(std::vector<ScTemplate const *> const & templates, ScMemoryContext & context)
+    : m_context(context)
+  {
+    PrepareSearch(templates);
+  }
+
+  void operator()(std::vector<ScTemplateSearchResult> & results)
+  {
+    results.clear();
+    results.resize(m_templates.size());
+    for (size_t templateIdx = 0; templateIdx < m_templates.size(); ++templateIdx)
+    {
+      ScTemplateSearchResult & result = results[templateIdx];
+      result.m_context = &m_context;
+      result.m_replacementConstructionSize = m_templates[templateIdx].m_constructionSize;
+      result.m_templateItemsNamesToReplacementItemsPositions = m_templates[templateIdx].m_replacements;
+    }
+
+    for (size_t const nodeIdx : m_rootNodes)
+      SearchNode(nodeIdx, 0, results);
+  }
+
+private:
+  static constexpr size_t NO_SLOT = std::numeric_limits<size_t>::max();
+  static constexpr size_t NO_NODE = std::numeric_limits<size_t>::max();
+
+  struct ScTemplateBatchItem
+  {
+    ScAddr m_addr;            ///< Fixed sc-address of item or empty sc-address if item is variable.
+    ScType m_iteratorType;    ///< sc-type used to iterate sc-elements for item.
+    size_t m_slot = NO_SLOT;  ///< Slot numbered in trie path or `NO_SLOT` if item has no replacement name.
+
+    bool operator==(ScTemplateBatchItem const & other) const
+    {
+      return m_addr == other.m_addr && m_iteratorType == other.m_iteratorType && m_slot == other.m_slot;
+    }
+  };
+
+  /*!
+   * Trie node is a triple shared by all sc-templates which paths go through this node.
+   */
+  struct ScTemplateBatchNode
+  {
+    std::array<ScTemplateBatchItem, 3> m_items;
+    std::vector<size_t> m_children;
+    std::vector<size_t> m_completedTemplates;  ///< Indices of sc-templates which last triple is this node.
+  };
+
+  struct ScTemplateBatchTemplate
+  {
+    std::vector<size_t> m_triples;  ///< Indices of sc-template triples in order of trie path.
+    size_t m_constructionSize = 0;
+    ScTemplate::ScTemplateItemsToReplacementsItemsPositions m_replacements;
+  };
+
+  void PrepareSearch(std::vector<ScTemplate const *> const & templates)
+  {
+    m_templates.resize(templates.size());
+    for (size_t templateIdx = 0; templateIdx < templates.size(); ++templateIdx)
+    {
+      ScTemplateSearch search(const_cast<ScTemplate &>(*templates[templateIdx]), m_context, ScAddr::Empty);
+      search.PrepareCursor();
+
+      ScTemplateBatchTemplate & batchTemplate = m_templates[templateIdx];
+      batchTemplate.m_triples = search.m_cursorTriples;
+      batchTemplate.m_constructionSize = search.CalculateOneResultSize();
+      batchTemplate.m_replacements = search.GetCursorReplacements();
+      if (batchTemplate.m_triples.empty())
+        continue;
+
+      std::vector<size_t> slotsToBatchSlots(search.m_slotsNames.size(), NO_SLOT);
+      size_t batchSlotsCount = 0;
+      size_t nodeIdx = NO_NODE;
+      for (size_t const tripleIdx : batchTemplate.m_triples)
+      {
+        std::array<ScTemplateBatchItem, 3> batchItems;
+        auto const & items = search.m_triples[tripleIdx].m_items;
+        for (size_t i = 0; i < items.size(); ++i)
+        {
+          batchItems[i].m_addr = ScTemplateSearch::GetFixedAddr(items[i]);
+          batchItems[i].m_iteratorType = items[i].m_iteratorType;
+          if (items[i].m_slot == ScTemplateSearch::NO_SLOT)
+            continue;
+
+          size_t & batchSlot = slotsToBatchSlots[items[i].m_slot];
+          if (batchSlot == NO_SLOT)
+            batchSlot = batchSlotsCount++;
+          batchItems[i].m_slot = batchSlot;
+        }
+
+        nodeIdx = InsertNode(nodeIdx, batchItems);
+      }
+
+      m_nodes[nodeIdx].m_completedTemplates.push_back(templateIdx);
+      m_slotsAddrs.resize(std::max(m_slotsAddrs.size(), batchSlotsCount));
+      m_construction.resize(std::max(m_construction.size(), batchTemplate.m_triples.size()));
+    }
+  }
+
+  size_t InsertNode(size_t const parentNodeIdx, std::array<ScTemplateBatchItem, 3> const & items)
+  {
+    std::vector<size_t> const & siblings = parentNodeIdx == NO_NODE ? m_rootNodes : m_nodes[parentNodeIdx].m_children;
+    for (size_t const siblingIdx : siblings)
+    {
+      if (m_nodes[siblingIdx].m_items == items)
+        return siblingIdx;
+    }
+
+    size_t const nodeIdx = m_nodes.size();
+    m_nodes.push_back({items, {}, {}});
+    if (parentNodeIdx == NO_NODE)
+      m_rootNodes.push_back(nodeIdx);
+    else
+      m_nodes[parentNodeIdx].m_children.push_back(nodeIdx);
+
+    return nodeIdx;
+  }
+
+  ScAddr const & ResolveAddr(ScTemplateBatchItem const & item) const
+  {
+    if (item.m_addr.IsValid() || item.m_slot == NO_SLOT)
+      return item.m_addr;
+
+    return m_slotsAddrs[item.m_slot];
+  }
+
+  ScIterator3Ptr CreateIterator(std::array<ScTemplateBatchItem, 3> const & items) const
+  {
+    ScAddr const & addr1 = ResolveAddr(items[0]);
+    ScAddr const & addr2 = ResolveAddr(items[1]);
+    ScAddr const & addr3 = ResolveAddr(items[2]);
+
+    if (addr1.IsValid())
+    {
+      if (!addr2.IsValid())
+      {
+        if (addr3.IsValid())  // F_A_F
+          return m_context.CreateIterator3(addr1, items[1].m_iteratorType, addr3);
+        else  // F_A_A
+          return m_context.CreateIterator3(addr1, items[1].m_iteratorType, items[2].m_iteratorType);
+      }
+      else
+      {
+        if (addr3.IsValid())  // F_F_F
+          return m_context.CreateIterator3(addr1, addr2, addr3);
+        else  // F_F_A
+          return m_context.CreateIterator3(addr1, addr2, items[2].m_iteratorType);
+      }
+    }
+    else if (addr3.IsValid())
+    {
+      if (addr2.IsValid())  // A_F_F
+        return m_context.CreateIterator3(items[0].m_iteratorType, addr2, addr3);
+      else  // A_A_F
+        return m_context.CreateIterator3(items[0].m_iteratorType, items[1].m_iteratorType, addr3);
+    }
+
+    return {};
+  }
+
+  bool IsConnectorUsed(size_t const depth, ScAddr const & connectorAddr) const
+  {
+    for (size_t previousDepth = 0; previousDepth < depth; ++previousDepth)
+    {
+      if (m_construction[previousDepth][1] == connectorAddr)
+        return true;
+    }
+
+    return false;
+  }
+
+  void SearchNode(size_t const nodeIdx, size_t const depth, std::vector<ScTemplateSearchResult> & results)
+  {
+    ScTemplateBatchNode const & node = m_nodes[nodeIdx];
+    auto const & items = node.m_items;
+
+    ScIterator3Ptr const it = CreateIterator(items);
+    if (!it || !it->IsValid())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidState,
+          "Fully variable triple was selected during searching by specified sc-templates. It is possible that you have "
+          "incorrect sc-template or you can't find constructions in knowledge base using this sc-template. Check "
+          "sc-templates.");
+
+    while (it->Next())
+    {
+      ScAddrTriple const & replacementTriple = it->Get();
+      if (IsConnectorUsed(depth, replacementTriple[1]))
+        continue;
+
+      bool isMatched = true;
+      std::array<bool, 3> boundItems = {false, false, false};
+      for (size_t i = 0; i < items.size(); ++i)
+      {
+        // sc-elements of previous triples and previous items of this triple must be the same
+        ScAddr const & resolvedAddr = ResolveAddr(items[i]);
+        if (resolvedAddr.IsValid())
+        {
+          if (resolvedAddr != replacementTriple[i])
+          {
+            isMatched = false;
+            break;
+          }
+        }
+        else if (items[i].m_slot != NO_SLOT)
+        {
+          m_slotsAddrs[items[i].m_slot] = replacementTriple[i];
+          boundItems[i] = true;
+        }
+      }
+
+      if (isMatched)
+      {
+        m_construction[depth] = replacementTriple;
+        for (size_t const templateIdx : node.m_completedTemplates)
+          AppendConstruction(m_templates[templateIdx], results[templateIdx]);
+
+        for (size_t const childNodeIdx : node.m_children)
+          SearchNode(childNodeIdx, depth + 1, results);
+      }
+
+      for (size_t i = 0; i < items.size(); ++i)
+      {
+        if (boundItems[i])
+          m_slotsAddrs[items[i].m_slot] = ScAddr::Empty;
+      }
+    }
+  }
+
+  void AppendConstruction(ScTemplateBatchTemplate const & batchTemplate, ScTemplateSearchResult & result)
+  {
+    m_resultConstruction.assign(batchTemplate.m_constructionSize, ScAddr::Empty);
+    for (size_t depth = 0; depth < batchTemplate.m_triples.size(); ++depth)
+    {
+      size_t const tripleIdx = batchTemplate.m_triples[depth];
+      for (size_t i = 0; i < m_construction[depth].size(); ++i)
+        m_resultConstruction[tripleIdx * 3 + i] = m_construction[depth][i];
+    }
+
+    result.AppendReplacementConstruction(m_resultConstruction.data());
+  }
+
+private:
+  ScMemoryContext & m_context;
+
+  // fields of trie of triples
+  std::vector<ScTemplateBatchNode> m_nodes;
+  std::vector<size_t> m_rootNodes;
+  std::vector<ScTemplateBatchTemplate> m_templates;
+
+  // fields of search by trie
+  std::vector<ScAddr> m_slotsAddrs;
+  std::vector<ScAddrTriple> m_construction;
+  ScAddrVector m_resultConstruction;
+};
+
+ScTemplate::Result ScTemplate::Search(
+    ScMemoryContext & ctx,
+    ScTemplateSearchResult & result,
+    ScTemplateSearchOptions const & options) const
+{
+  ScTemplateSearch search(const_cast<ScTemplate &>(*this), ctx, options.m_structureAddr);
+  search.SetJoinEnabled(options.m_isJoinEnabled);
+  if (search.IsParallelizable(options.m_threadsCount))
+    return search.SearchInParallel(result, options.m_threadsCount);
+
+  return search(result);
+}
+
+void ScTemplate::Search(
+    ScMemoryContext & ctx,
+    ScTemplateSearchResultCallback const & callback,
+    ScTemplateSearchResultFilterCallback const & filterCallback,
+    ScTemplateSearchResultCheckCallback const & checkCallback,
+    ScTemplateSearchOptions const & options) const
+{
+  ScTemplateSearch search(const_cast<ScTemplate &>(*this), ctx, options.m_structureAddr);
+  search.SetJoinEnabled(options.m_isJoinEnabled);
+  search.SetCallback(callback);
+  search.SetFilterCallback(filterCallback);
+  search.SetCheckCallback(checkCallback);
+  if (search.IsParallelizable(options.m_threadsCount))
+    search.SearchInParallel(options.m_threadsCount);
+  else
+    search();
+}
+
+void ScTemplate::Search(
     ScMemoryContext & ctx,
     ScTemplateSearchResultCallbackWithRequest const & callback,
     ScTemplateSearchResultFilterCallback const & filterCallback,
-    ScTemplateSearchResultCheckCallback const & checkCallback) const
+    ScTemplateSearchResultCheckCallback const & checkCallback,
+    ScTemplateSearchOptions const & options) const
 {
-  ScTemplateSearch search(const_cast<ScTemplate &>(*this), ctx, ScAddr::Empty);
+  ScTemplateSearch search(const_cast<ScTemplate &>(*this), ctx, options.m_structureAddr);
+  search.SetJoinEnabled(options.m_isJoinEnabled);
   search.SetCallbackWithRequest(callback);
   search.SetFilterCallback(filterCallback);
   search.SetCheckCallback(checkCallback);
-  search();
+  if (search.IsParallelizable(options.m_threadsCount))
+    search.SearchInParallel(options.m_threadsCount);
+  else
+    search();
+}
+
+std::string ScTemplate::ExplainSearch(ScMemoryContext & ctx) const
+{
+  ScTemplateSearch search(const_cast<ScTemplate &>(*this), ctx, ScAddr::Empty);
+  return search.Explain();
+}
+
+bool ScTemplate::CollectTriplesFixedElements(ScMemoryContext & ctx, ScAddrUnorderedSet & elementsAddrs) const
+{
+  ScTemplateSearch search(const_cast<ScTemplate &>(*this), ctx, ScAddr::Empty);
+  return search.CollectTriplesFixedElements(elementsAddrs);
+}
+
+void ScTemplate::SearchByConnector(
+    ScMemoryContext & ctx,
+    ScAddr const & connectorAddr,
+    ScType const & connectorType,
+    ScTemplateSearchResultCallback const & callback) const
+{
+  for (size_t tripleIdx = 0; tripleIdx < Size(); ++tripleIdx)
+  {
+    ScTemplateSearch search(const_cast<ScTemplate &>(*this), ctx, tripleIdx, connectorAddr, connectorType);
+    if (!search.IsConnectorMatched())
+      continue;
+
+    search.SetCallback(callback);
+    search();
+  }
+}
+
+ScTemplateSearchCursor ScTemplate::CreateSearchCursor(ScMemoryContext & ctx, size_t offset, size_t limit) const
+{
+  auto search = std::make_unique<ScTemplateSearch>(const_cast<ScTemplate &>(*this), ctx, ScAddr::Empty);
+  search->PrepareCursor();
+  return {std::move(search), offset, limit};
+}
+
+void ScTemplate::SearchBatch(
+    ScMemoryContext & ctx,
+    std::vector<ScTemplate const *> const & templates,
+    std::vector<ScTemplateSearchResult> & results)
+{
+  ScTemplateBatchSearch search(templates, ctx);
+  search(results);
+}
+
+ScTemplateSearchCursor::ScTemplateSearchCursor(std::unique_ptr<ScTemplateSearch> search, size_t offset, size_t limit)
+  : m_search(std::move(search))
+  , m_offset(offset)
+  , m_limit(limit)
+{
+}
+
+ScTemplateSearchCursor::ScTemplateSearchCursor(ScTemplateSearchCursor && other) noexcept = default;
+
+ScTemplateSearchCursor & ScTemplateSearchCursor::operator=(ScTemplateSearchCursor && other) noexcept = default;
+
+ScTemplateSearchCursor::~ScTemplateSearchCursor() = default;
+
+bool ScTemplateSearchCursor::Next(ScTemplateResultItem & outItem)
+{
+  if (m_foundCount >= m_limit)
+    return false;
+
+  for (; m_skippedCount < m_offset; ++m_skippedCount)
+  {
+    if (!m_search->NextCursorConstruction())
+      return false;
+  }
+
+  if (!m_search->NextCursorConstruction())
+    return false;
+
+  ++m_foundCount;
+  m_search->GetCursorConstruction(outItem);
+  return true;
+}
+
+size_t ScTemplateSearchCursor::GetFoundCount() const noexcept
+{
+  return m_foundCount;
+}
+
+ScTemplate::ScTemplateItemsToReplacementsItemsPositions const & ScTemplateSearchCursor::GetReplacements()
+    const noexcept
+{
+  return m_search->GetCursorReplacements();
 }
@@ -0,0 +1,178 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_template_subscription.hpp"
+
+#include "sc_memory.hpp"
+
+ScTemplateSubscription::ScTemplateSubscription(
+    ScMemoryContext & context,
+    ScTemplate && templateToWatch,
+    DelegateFunc const & onConstructionGenerated,
+    DelegateFunc const & onConstructionErased)
+  : m_context(new ScMemoryContext(context.GetUser()))
+  , m_template(std::move(templateToWatch))
+  , m_onConstructionGenerated(onConstructionGenerated)
+  , m_onConstructionErased(onConstructionErased)
+{
+  ScAddrUnorderedSet fixedElementsAddrs;
+  if (!m_template.CollectTriplesFixedElements(*m_context, fixedElementsAddrs))
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Not able to subscribe to sc-constructions of sc-template because it has triple without fixed source and "
+        "target sc-elements. Generation of sc-connectors of such triple can't be tracked.");
+
+  // sc-events are subscribed before searching, so sc-constructions generated during searching aren't missed. Their
+  // sc-events are processed after the lock is released, and sc-constructions already found aren't added twice.
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  for (ScAddr const & elementAddr : fixedElementsAddrs)
+  {
+    m_subscriptions.emplace_back(new ScElementaryEventSubscription<EventGenerateType>(
+        *m_context,
+        elementAddr,
+        [this](EventGenerateType const & event)
+        {
+          OnConnectorGenerated(event);
+        }));
+    m_subscriptions.emplace_back(new ScElementaryEventSubscription<EventEraseType>(
+        *m_context,
+        elementAddr,
+        [this](EventEraseType const & event)
+        {
+          OnConnectorErased(event);
+        }));
+  }
+
+  m_context->SearchByTemplate(
+      m_template,
+      [this](ScTemplateResultItem const & item)
+      {
+        AddConstruction(item);
+      });
+}
+
+ScTemplateSubscription::~ScTemplateSubscription() noexcept
+{
+  m_subscriptions.clear();
+}
+
+size_t ScTemplateSubscription::GetConstructionsCount() const noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_constructions.size();
+}
+
+void ScTemplateSubscription::ForEachConstruction(DelegateFunc const & func) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (auto const & [constructionId, item] : m_constructions)
+    func(item);
+}
+
+void ScTemplateSubscription::OnConnectorGenerated(EventGenerateType const & event)
+{
+  std::vector<ScTemplateResultItem> generatedItems;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    try
+    {
+      // only sc-constructions with generated sc-connector can be new
+      m_template.SearchByConnector(
+          *m_context,
+          event.GetConnector(),
+          event.GetConnectorType(),
+          [this, &generatedItems](ScTemplateResultItem const & item)
+          {
+            if (AddConstruction(item))
+              generatedItems.push_back(item);
+          });
+    }
+    catch (utils::ScException const & exception)
+    {
+      // sc-connector can be erased before sc-event is processed
+      SC_LOG_DEBUG("Not able to search sc-constructions by generated sc-connector: " << exception.Message());
+    }
+  }
+
+  // callbacks are called out of the lock, so they can use this subscription
+  if (m_onConstructionGenerated)
+  {
+    for (ScTemplateResultItem const & item : generatedItems)
+      m_onConstructionGenerated(item);
+  }
+}
+
+void ScTemplateSubscription::OnConnectorErased(EventEraseType const & event)
+{
+  std::vector<ScTemplateResultItem> erasedItems;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    EraseConstructions(event.GetConnector(), erasedItems);
+  }
+
+  if (m_onConstructionErased)
+  {
+    for (ScTemplateResultItem const & item : erasedItems)
+      m_onConstructionErased(item);
+  }
+}
+
+void ScTemplateSubscription::EraseConstructions(
+    ScAddr const & connectorAddr,
+    std::vector<ScTemplateResultItem> & erasedItems)
+{
+  auto const [beginIt, endIt] = m_connectorsConstructions.equal_range(connectorAddr);
+  std::vector<sc_uint64> erasedConstructionsIds;
+  for (auto it = beginIt; it != endIt; ++it)
+    erasedConstructionsIds.push_back(it->second);
+
+  for (sc_uint64 const constructionId : erasedConstructionsIds)
+  {
+    auto const constructionIt = m_constructions.find(constructionId);
+    ScTemplateResultItem const & item = constructionIt->second;
+
+    for (size_t i = 1; i < item.Size(); i += 3)
+    {
+      auto [connectorBeginIt, connectorEndIt] = m_connectorsConstructions.equal_range(item[i]);
+      for (auto it = connectorBeginIt; it != connectorEndIt; ++it)
+      {
+        if (it->second == constructionId)
+        {
+          m_connectorsConstructions.erase(it);
+          break;
+        }
+      }
+    }
+
+    erasedItems.push_back(std::move(constructionIt->second));
+    m_constructions.erase(constructionIt);
+  }
+}
+
+bool ScTemplateSubscription::AddConstruction(ScTemplateResultItem const & item)
+{
+  // the same sc-construction can be found by sc-events of both incident sc-elements of sc-connector
+  auto const [beginIt, endIt] = m_connectorsConstructions.equal_range(item[1]);
+  for (auto it = beginIt; it != endIt; ++it)
+  {
+    ScTemplateResultItem const & otherItem = m_constructions.at(it->second);
+    bool isEqual = true;
+    for (size_t i = 1; i < item.Size() && isEqual; i += 3)
+      isEqual = item[i] == otherItem[i];
+
+    if (isEqual)
+      return false;
+  }
+
+  sc_uint64 const constructionId = ++m_lastConstructionId;
+  auto const & [constructionIt, isInserted] = m_constructions.insert({constructionId, item});
+  for (size_t i = 1; i < item.Size(); i += 3)
+    m_connectorsConstructions.insert({constructionIt->second[i], constructionId});
+
+  return isInserted;
+}
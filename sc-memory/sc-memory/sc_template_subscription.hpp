@@ -0,0 +1,98 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "sc_event_subscription.hpp"
+#include "sc_template.hpp"
+
+/*!
+ * @class ScTemplateSubscription
+ * @brief Keeps sc-constructions found by sc-template up to date and calls callbacks when they are generated or erased.
+ *
+ * Subscription listens sc-events of generation and erasure of sc-connectors incident to sc-elements fixed in
+ * sc-template. When sc-connector is generated, only sc-constructions that contain this sc-connector are searched. When
+ * sc-connector is erased, sc-constructions that contain it are erased too. So each triple of sc-template must have
+ * fixed source or target sc-element.
+ *
+ * @note Sc-constructions found when subscription is created are kept, but callbacks aren't called for them. Callbacks
+ * are called one by one out of the lock of the subscription, so they may get its sc-constructions, but they must not
+ * destroy the subscription.
+ */
+class _SC_EXTERN ScTemplateSubscription final : public ScObject
+{
+  friend class ScAgentContext;
+
+  SC_DISALLOW_COPY_AND_MOVE(ScTemplateSubscription);
+
+  using EventGenerateType = ScEventAfterGenerateConnector<ScType::Unknown>;
+  using EventEraseType = ScEventBeforeEraseConnector<ScType::Unknown>;
+
+public:
+  using DelegateFunc = std::function<void(ScTemplateResultItem const & item)>;
+
+  _SC_EXTERN ~ScTemplateSubscription() noexcept override;
+
+  /*!
+   * @brief Gets count of sc-constructions found by sc-template at the moment.
+   * @return Count of found sc-constructions.
+   */
+  _SC_EXTERN size_t GetConstructionsCount() const noexcept;
+
+  /*!
+   * @brief Calls function for each sc-construction found by sc-template at the moment.
+   * @param func A function to call for each found sc-construction.
+   */
+  _SC_EXTERN void ForEachConstruction(DelegateFunc const & func) const;
+
+protected:
+  /*!
+   * @brief Searches sc-constructions by sc-template and subscribes to sc-events of sc-elements fixed in it.
+   * @param context A sc-memory context which user is used to search sc-constructions.
+   * @param templateToWatch An object of `ScTemplate` to search sc-constructions by it.
+   * @param onConstructionGenerated A callback called when new sc-construction is found.
+   * @param onConstructionErased A callback called when found sc-construction is erased.
+   * @throws utils::ExceptionInvalidParams if sc-template has triple without fixed source and target sc-elements.
+   */
+  _SC_EXTERN ScTemplateSubscription(
+      ScMemoryContext & context,
+      ScTemplate && templateToWatch,
+      DelegateFunc const & onConstructionGenerated,
+      DelegateFunc const & onConstructionErased) noexcept(false);
+
+private:
+  void OnConnectorGenerated(EventGenerateType const & event);
+
+  void OnConnectorErased(EventEraseType const & event);
+
+  /// Stores found sc-construction if it isn't stored yet. Must be called under `m_mutex`.
+  bool AddConstruction(ScTemplateResultItem const & item);
+
+  /// Removes sc-constructions that contain sc-connector and moves them to `erasedItems`.
+  /// Must be called under `m_mutex`.
+  void EraseConstructions(ScAddr const & connectorAddr, std::vector<ScTemplateResultItem> & erasedItems);
+
+private:
+  std::unique_ptr<ScMemoryContext> m_context;
+  ScTemplate m_template;
+  DelegateFunc m_onConstructionGenerated;
+  DelegateFunc m_onConstructionErased;
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<sc_uint64, ScTemplateResultItem> m_constructions;
+  std::unordered_multimap<ScAddr, sc_uint64, ScAddrHashFunc>
+      m_connectorsConstructions;  ///< Identifiers of found sc-constructions that contain sc-connector.
+  sc_uint64 m_lastConstructionId = 0;
+
+  std::vector<std::unique_ptr<ScEventSubscription>> m_subscriptions;
+};
+
+SHARED_PTR_TYPE(ScTemplateSubscription);
@@ -15,11 +15,15 @@
 #include "units/memory_erase_set_elements.hpp"
 
 #include "units/memory_erase_elements.hpp"
+#include "units/memory_erase_structure.hpp"
+
+#include "units/memory_bulk_read.hpp"
 
 #include "units/sc_code_base_vs_extend.hpp"
 
 #include "units/template_search_complex.hpp"
 #include "units/template_search_smoke.hpp"
+#include "units/template_search_cycled.hpp"
 
 #include <atomic>
 #include <chrono>
@@ -510,6 +514,49 @@ BENCHMARK_TEMPLATE(BM_MemoryRanged, TestEraseElements)
 ->Arg(10)->Arg(100)->Arg(1000)
 ->Iterations(5000);
 
+int constexpr kBulkReadAddrs = 1000000;
+int constexpr kBulkReadIters = 10;
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestGetElementTypeOneByOne)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(kBulkReadAddrs)
+->Iterations(kBulkReadIters);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestGetElementTypes)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(kBulkReadAddrs)
+->Iterations(kBulkReadIters);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestGetConnectorIncidentElementsOneByOne)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(kBulkReadAddrs)
+->Iterations(kBulkReadIters);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestGetConnectorsIncidentElements)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(kBulkReadAddrs)
+->Iterations(kBulkReadIters);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestIsElementOneByOne)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(kBulkReadAddrs)
+->Iterations(kBulkReadIters);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestAreElements)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(kBulkReadAddrs)
+->Iterations(kBulkReadIters);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestEraseStructureOneByOne)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(10000)->Arg(100000)
+->Iterations(TestEraseStructure::kStructuresNum);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestEraseStructureElements)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(10000)->Arg(100000)
+->Iterations(TestEraseStructure::kStructuresNum);
+
 // ------------------------------------
 template <class BMType>
 void BM_Template(benchmark::State & state)
@@ -536,6 +583,14 @@ BENCHMARK_TEMPLATE(BM_Template, TestTemplateSearchComplex)
 ->Unit(benchmark::TimeUnit::kMicrosecond)
 ->Arg(5)->Arg(50);
 
+BENCHMARK_TEMPLATE(BM_Template, TestTemplateSearchCycled)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(10)->Arg(50)->Arg(100);
+
+BENCHMARK_TEMPLATE(BM_Template, TestTemplateSearchCycledNested)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(10)->Arg(50)->Arg(100);
+
 // SC-code base vs extended
 BENCHMARK_TEMPLATE(BM_Template, TestScCodeBase)
 ->Unit(benchmark::TimeUnit::kMicrosecond)
@@ -0,0 +1,90 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+#include <algorithm>
+#include <random>
+
+class TestBulkRead : public TestMemory
+{
+public:
+  void Setup(size_t connectorsNum) override
+  {
+    ScAddr const node = m_ctx->GenerateNode(ScType::NodeConstClass);
+    m_addrs.reserve(connectorsNum);
+    for (size_t i = 0; i < connectorsNum; ++i)
+    {
+      ScAddr const target = m_ctx->GenerateNode(ScType::NodeConst);
+      m_addrs.push_back(m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, node, target));
+    }
+
+    // search results are not ordered by sc-segments
+    std::shuffle(m_addrs.begin(), m_addrs.end(), std::mt19937{});
+  }
+
+protected:
+  std::vector<ScAddr> m_addrs;
+};
+
+class TestGetElementTypeOneByOne : public TestBulkRead
+{
+public:
+  void Run()
+  {
+    for (ScAddr const & addr : m_addrs)
+      benchmark::DoNotOptimize(m_ctx->GetElementType(addr));
+  }
+};
+
+class TestGetElementTypes : public TestBulkRead
+{
+public:
+  void Run()
+  {
+    benchmark::DoNotOptimize(m_ctx->GetElementTypes(m_addrs));
+  }
+};
+
+class TestGetConnectorIncidentElementsOneByOne : public TestBulkRead
+{
+public:
+  void Run()
+  {
+    for (ScAddr const & addr : m_addrs)
+      benchmark::DoNotOptimize(m_ctx->GetConnectorIncidentElements(addr));
+  }
+};
+
+class TestGetConnectorsIncidentElements : public TestBulkRead
+{
+public:
+  void Run()
+  {
+    benchmark::DoNotOptimize(m_ctx->GetConnectorsIncidentElements(m_addrs));
+  }
+};
+
+class TestIsElementOneByOne : public TestBulkRead
+{
+public:
+  void Run()
+  {
+    for (ScAddr const & addr : m_addrs)
+      benchmark::DoNotOptimize(m_ctx->IsElement(addr));
+  }
+};
+
+class TestAreElements : public TestBulkRead
+{
+public:
+  void Run()
+  {
+    benchmark::DoNotOptimize(m_ctx->AreElements(m_addrs));
+  }
+};
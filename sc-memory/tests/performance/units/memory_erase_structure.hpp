@@ -0,0 +1,69 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+class TestEraseStructure : public TestMemory
+{
+public:
+  static size_t constexpr kStructuresNum = 10;
+
+  void Setup(size_t elementsNum) override
+  {
+    for (size_t i = 0; i < kStructuresNum; ++i)
+    {
+      ScAddr const structureAddr = m_ctx->GenerateNode(ScType::NodeConstStruct);
+      std::vector<ScAddr> elementAddrs;
+      elementAddrs.reserve(elementsNum);
+
+      ScAddr prevNodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+      elementAddrs.push_back(prevNodeAddr);
+      while (elementAddrs.size() < elementsNum)
+      {
+        ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+        ScAddr const arcAddr = m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, prevNodeAddr, nodeAddr);
+        m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, structureAddr, nodeAddr);
+        m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, structureAddr, arcAddr);
+        elementAddrs.push_back(nodeAddr);
+        prevNodeAddr = nodeAddr;
+      }
+
+      m_structures.push_back(std::move(elementAddrs));
+    }
+  }
+
+protected:
+  std::vector<ScAddr> PopStructure()
+  {
+    std::vector<ScAddr> elementAddrs = std::move(m_structures.back());
+    m_structures.pop_back();
+    return elementAddrs;
+  }
+
+private:
+  std::vector<std::vector<ScAddr>> m_structures;
+};
+
+class TestEraseStructureOneByOne : public TestEraseStructure
+{
+public:
+  void Run()
+  {
+    for (ScAddr const & addr : PopStructure())
+      m_ctx->EraseElement(addr);
+  }
+};
+
+class TestEraseStructureElements : public TestEraseStructure
+{
+public:
+  void Run()
+  {
+    m_ctx->EraseElements(PopStructure());
+  }
+};
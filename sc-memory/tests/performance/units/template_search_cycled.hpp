@@ -0,0 +1,69 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "template_test.hpp"
+
+/*!
+ * Searches cycles `_a => _b => _c => _a` in dense sc-graph: each `_a` is connected with each `_b` and each `_b` is
+ * connected with each `_c`, but each `_c` is connected with the only `_a`. Nested iteration of triples goes through all
+ * paths `_a => _b => _c`, search by join intersects sc-elements adjacent to `_b` and `_a`.
+ */
+class TestTemplateSearchCycled : public TestTemplate
+{
+public:
+  void Setup(size_t constrCount) override
+  {
+    ScAddr const set = m_ctx->GenerateNode(ScType::NodeConst);
+
+    ScAddrVector firstNodes, secondNodes, thirdNodes;
+    for (size_t i = 0; i < constrCount; ++i)
+    {
+      firstNodes.push_back(m_ctx->GenerateNode(ScType::NodeConst));
+      secondNodes.push_back(m_ctx->GenerateNode(ScType::NodeConst));
+      thirdNodes.push_back(m_ctx->GenerateNode(ScType::NodeConst));
+      m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, set, firstNodes.back());
+    }
+
+    for (size_t i = 0; i < constrCount; ++i)
+    {
+      for (size_t j = 0; j < constrCount; ++j)
+      {
+        m_ctx->GenerateConnector(ScType::EdgeDCommonConst, firstNodes[i], secondNodes[j]);
+        m_ctx->GenerateConnector(ScType::EdgeDCommonConst, secondNodes[i], thirdNodes[j]);
+      }
+      m_ctx->GenerateConnector(ScType::EdgeDCommonConst, thirdNodes[i], firstNodes[i]);
+    }
+
+    m_templ.Triple(
+          set,
+          ScType::EdgeAccessVarPosPerm,
+          ScType::NodeVar >> "_a");
+    m_templ.Triple(
+          "_a",
+          ScType::EdgeDCommonVar,
+          ScType::NodeVar >> "_b");
+    m_templ.Triple(
+          "_b",
+          ScType::EdgeDCommonVar,
+          ScType::NodeVar >> "_c");
+    m_templ.Triple(
+          "_c",
+          ScType::EdgeDCommonVar,
+          "_a");
+  }
+};
+
+class TestTemplateSearchCycledNested : public TestTemplateSearchCycled
+{
+public:
+  void Setup(size_t constrCount) override
+  {
+    TestTemplateSearchCycled::Setup(constrCount);
+    m_options.m_isJoinEnabled = false;
+  }
+};
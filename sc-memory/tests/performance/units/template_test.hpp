@@ -40,7 +40,7 @@ public:
   bool Run()
   {
     ScTemplateSearchResult result;
-    bool status = m_ctx->SearchByTemplate(m_templ, result);
+    bool status = m_ctx->SearchByTemplate(m_templ, result, m_options);
 
     for (size_t i = 0; i < result.Size(); i++);
 
@@ -50,4 +50,5 @@ public:
 protected:
   std::unique_ptr<ScMemoryContext> m_ctx;
   ScTemplate m_templ;
+  ScTemplateSearchOptions m_options;
 };
@@ -416,6 +416,160 @@ TEST_F(ScActionTest, InitiateAndWaitFinishedAction)
   EXPECT_FALSE(action.IsInitiated());
 }
 
+TEST_F(ScActionTest, InitiateAsyncAction)
+{
+  m_ctx->SubscribeAgent<ATestCheckResult>();
+
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action)
+                        .SetArguments(
+                            ATestGenerateOutgoingArc::generate_outgoing_arc_action,
+                            ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  std::future<bool> future = action.InitiateAsync();
+  EXPECT_TRUE(action.IsInitiated());
+  EXPECT_EQ(future.wait_for(std::chrono::milliseconds(5000)), std::future_status::ready);
+  EXPECT_TRUE(future.get());
+  EXPECT_TRUE(action.IsFinished());
+  EXPECT_TRUE(action.IsFinishedSuccessfully());
+
+  m_ctx->UnsubscribeAgent<ATestCheckResult>();
+}
+
+TEST_F(ScActionTest, InitiateAsyncSeveralActions)
+{
+  m_ctx->SubscribeAgent<ATestCheckResult>();
+
+  std::vector<std::pair<ScAction, std::future<bool>>> actions;
+  for (size_t i = 0; i < 10; ++i)
+  {
+    ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action)
+                          .SetArguments(
+                              ATestGenerateOutgoingArc::generate_outgoing_arc_action,
+                              ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+    std::future<bool> future = action.InitiateAsync();
+    actions.emplace_back(action, std::move(future));
+  }
+
+  for (auto & [action, future] : actions)
+  {
+    EXPECT_EQ(future.wait_for(std::chrono::milliseconds(5000)), std::future_status::ready);
+    EXPECT_TRUE(future.get());
+    EXPECT_TRUE(action.IsFinishedSuccessfully());
+  }
+
+  m_ctx->UnsubscribeAgent<ATestCheckResult>();
+}
+
+TEST_F(ScActionTest, InitiateAsyncActionAndFinishItManually)
+{
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  std::future<bool> future = action.InitiateAsync();
+  EXPECT_EQ(future.wait_for(std::chrono::milliseconds(1)), std::future_status::timeout);
+  EXPECT_NO_THROW(action.FinishUnsuccessfully());
+  EXPECT_EQ(future.wait_for(std::chrono::milliseconds(5000)), std::future_status::ready);
+  EXPECT_TRUE(future.get());
+  EXPECT_TRUE(action.IsFinishedUnsuccessfully());
+}
+
+TEST_F(ScActionTest, InitiateAsyncActionAndNotFinishIt)
+{
+  // no other action is waited after this one, but its future is resolved after waiting time is expired
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  std::future<bool> future = action.InitiateAsync(100);
+  EXPECT_EQ(future.wait_for(std::chrono::milliseconds(5000)), std::future_status::ready);
+  EXPECT_FALSE(future.get());
+  EXPECT_FALSE(action.IsFinished());
+}
+
+TEST_F(ScActionTest, InitiateAsyncInitiatedAction)
+{
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  EXPECT_NO_THROW(action.Initiate());
+  EXPECT_THROW(action.InitiateAsync(1), utils::ExceptionInvalidState);
+}
+
+TEST_F(ScActionTest, InitiateActionWithContinuation)
+{
+  m_ctx->SubscribeAgent<ATestCheckResult>();
+
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action)
+                        .SetArguments(
+                            ATestGenerateOutgoingArc::generate_outgoing_arc_action,
+                            ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+
+  TestWaiter waiter;
+  bool isFinishedSuccessfully = false;
+  action.InitiateAndThen(
+      [&](ScAgentContext &, ScAction & action)
+      {
+        isFinishedSuccessfully = action.IsFinishedSuccessfully();
+        waiter.Unlock();
+      });
+  EXPECT_TRUE(action.IsInitiated());
+  EXPECT_TRUE(waiter.Wait());
+  EXPECT_TRUE(isFinishedSuccessfully);
+
+  m_ctx->UnsubscribeAgent<ATestCheckResult>();
+}
+
+TEST_F(ScActionTest, InitiateActionWithContinuationAndNotFinishIt)
+{
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+
+  TestWaiter waiter;
+  bool isFinished = true;
+  action.InitiateAndThen(
+      [&](ScAgentContext &, ScAction & action)
+      {
+        isFinished = action.IsFinished();
+        waiter.Unlock();
+      },
+      1);
+  EXPECT_TRUE(waiter.Wait());
+  EXPECT_FALSE(isFinished);
+}
+
+TEST_F(ScActionTest, SuspendActionAndFinishItInContinuation)
+{
+  m_ctx->SubscribeAgent<ATestCheckResult>();
+  m_ctx->SubscribeAgent<ATestSuspendedAction>();
+
+  ScAction action = m_ctx->GenerateAction(ATestSuspendedAction::suspended_action);
+  EXPECT_TRUE(action.InitiateAndWait());
+  EXPECT_TRUE(action.IsFinishedSuccessfully());
+
+  m_ctx->UnsubscribeAgent<ATestSuspendedAction>();
+  m_ctx->UnsubscribeAgent<ATestCheckResult>();
+}
+
+TEST_F(ScActionTest, SuspendActionAndFinishItInContinuationAfterSubActionExpiration)
+{
+  m_ctx->SubscribeAgent<ATestSuspendedAction>();
+
+  ScAction action = m_ctx->GenerateAction(ATestSuspendedAction::suspended_action);
+  EXPECT_TRUE(action.InitiateAndWait());
+  EXPECT_TRUE(action.IsFinishedUnsuccessfully());
+
+  m_ctx->UnsubscribeAgent<ATestSuspendedAction>();
+}
+
+TEST_F(ScActionTest, SuspendNotInitiatedAction)
+{
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  EXPECT_THROW(action.Suspend(), utils::ExceptionInvalidState);
+  EXPECT_FALSE(action.IsSuspended());
+}
+
+TEST_F(ScActionTest, SuspendInitiatedAction)
+{
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  action.Initiate();
+  EXPECT_FALSE(action.IsSuspended());
+
+  action.Suspend();
+  EXPECT_TRUE(action.IsSuspended());
+  EXPECT_FALSE(action.IsFinished());
+}
+
 TEST_F(ScActionTest, FinishUnsuccessfullyNotInitiatedAction)
 {
   m_ctx->SubscribeAgent<ATestCheckResult>();
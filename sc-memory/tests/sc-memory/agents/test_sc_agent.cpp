@@ -487,3 +487,31 @@ ScResult ATestActionDeactivated::DoProgram(ScActionInitiatedEvent const &, ScAct
   msWaiter.Unlock();
   return action.FinishSuccessfully();
 }
+
+/// --------------------------------------
+
+ScAddr ATestSuspendedAction::GetActionClass() const
+{
+  return ATestSuspendedAction::suspended_action;
+}
+
+ScResult ATestSuspendedAction::DoProgram(ScAction & action)
+{
+  ScAddr const & actionAddr = action;
+  m_context.GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action)
+      .SetArguments(
+          ATestGenerateOutgoingArc::generate_outgoing_arc_action,
+          ATestGenerateOutgoingArc::generate_outgoing_arc_action)
+      .InitiateAndThen(
+          [actionAddr](ScAgentContext & context, ScAction & subAction)
+          {
+            ScAction action = context.ConvertToAction(actionAddr);
+            if (subAction.IsFinishedSuccessfully())
+              action.FinishSuccessfully();
+            else
+              action.FinishUnsuccessfully();
+          },
+          100);
+
+  return action.Suspend();
+}
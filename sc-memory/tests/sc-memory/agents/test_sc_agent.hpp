@@ -400,3 +400,13 @@ public:
 
   ScResult DoProgram(ScActionInitiatedEvent const & event, ScAction & action) override;
 };
+
+class ATestSuspendedAction : public ScActionInitiatedAgent
+{
+public:
+  static inline ScKeynode const suspended_action{"suspended_action", ScType::NodeConstClass};
+
+  ScAddr GetActionClass() const override;
+
+  ScResult DoProgram(ScAction & action) override;
+};
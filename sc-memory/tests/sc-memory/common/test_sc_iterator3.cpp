@@ -80,6 +80,55 @@ TEST_F(ScIterator3Test, FAF)
   EXPECT_EQ(iter3->Get(2), ScAddr::Empty);
 }
 
+TEST_F(ScIterator3Test, IterateInRangeBasedFor)
+{
+  ScAddr const & otherTarget = m_ctx->GenerateNode(ScType::NodeConst);
+  ScAddr const & otherConnector = m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, m_source, otherTarget);
+
+  ScAddrSet connectors;
+  for (auto const & [source, connector, target] :
+       m_ctx->Iterate(m_source, ScType::EdgeAccessConstPosPerm, ScType::Node))
+  {
+    EXPECT_EQ(source, m_source);
+    EXPECT_TRUE(target == m_target || target == otherTarget);
+    connectors.insert(connector);
+  }
+  EXPECT_EQ(connectors, ScAddrSet({m_connector, otherConnector}));
+
+  auto emptyIter3 = m_ctx->Iterate(m_source, ScType::EdgeDCommonConst, ScType::Node);
+  EXPECT_TRUE(emptyIter3.begin() == emptyIter3.end());
+
+  auto iter3 = m_ctx->Iterate(m_source, ScType::EdgeAccessConstPosPerm, m_target);
+  EXPECT_TRUE(iter3.IsValid());
+  EXPECT_TRUE(iter3.Next());
+  EXPECT_EQ(iter3.Get(1), m_connector);
+  EXPECT_FALSE(iter3.Next());
+}
+
+TEST_F(ScIterator3Test, CopyIteratorAndIterateIndependently)
+{
+  auto iter3 = m_ctx->Iterate(m_source, ScType::EdgeAccessConstPosPerm, m_target);
+  auto copiedIter3 = std::make_unique<decltype(iter3)>(iter3);
+  EXPECT_TRUE(copiedIter3->IsValid());
+
+  EXPECT_TRUE(iter3.Next());
+  EXPECT_EQ(iter3.Get(1), m_connector);
+  EXPECT_FALSE(iter3.Next());
+
+  auto secondCopiedIter3 = *copiedIter3;
+  EXPECT_TRUE(copiedIter3->Next());
+  EXPECT_EQ(copiedIter3->Get(1), m_connector);
+  copiedIter3.reset();
+
+  EXPECT_TRUE(secondCopiedIter3.Next());
+  EXPECT_EQ(secondCopiedIter3.Get(1), m_connector);
+  EXPECT_FALSE(secondCopiedIter3.Next());
+
+  auto emptyIter3 = m_ctx->Iterate(m_target, ScType::EdgeAccessConstPosPerm, m_source);
+  secondCopiedIter3 = emptyIter3;
+  EXPECT_FALSE(secondCopiedIter3.Next());
+}
+
 TEST_F(ScIterator3Test, FAF2)
 {
   ScIterator3Ptr const iter3 = m_ctx->CreateIterator3(m_source, sc_type_arc_pos_const_perm, m_target);
@@ -272,6 +321,150 @@ TEST_F(ScIterator3Test, FFF)
   EXPECT_EQ(iter3->Get(2), ScAddr::Empty);
 }
 
+TEST_F(ScIterator3Test, FAAForHubWithArcsOfDifferentTypes)
+{
+  size_t const arcsCount = 3000;
+  std::vector<ScAddr> posArcs;
+  std::vector<ScAddr> negArcs;
+  for (size_t i = 0; i < arcsCount; ++i)
+  {
+    ScAddr const & targetAddr = m_ctx->GenerateNode(ScType::NodeConst);
+    if (i % 3 == 0)
+      negArcs.push_back(m_ctx->GenerateConnector(ScType::EdgeAccessConstNegPerm, m_source, targetAddr));
+    else
+      posArcs.push_back(m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, m_source, targetAddr));
+  }
+  m_ctx->GenerateConnector(ScType::EdgeUCommonConst, m_source, m_target);
+
+  auto const & countArcs = [this](ScType const & arcType) -> size_t
+  {
+    size_t count = 0;
+    ScIterator3Ptr const iter3 = m_ctx->CreateIterator3(m_source, arcType, ScType::Unknown);
+    while (iter3->Next())
+    {
+      EXPECT_EQ(m_ctx->GetElementType(iter3->Get(1)).BitAnd(*arcType), *arcType);
+      ++count;
+    }
+    return count;
+  };
+
+  EXPECT_EQ(countArcs(ScType::EdgeAccessConstPosPerm), posArcs.size() + 1);
+  EXPECT_EQ(countArcs(ScType::EdgeAccessConstNegPerm), negArcs.size());
+  EXPECT_EQ(countArcs(ScType::EdgeAccess), posArcs.size() + negArcs.size() + 1);
+  EXPECT_EQ(countArcs(ScType::EdgeUCommon), 1u);
+  EXPECT_EQ(countArcs(ScType::Unknown), posArcs.size() + negArcs.size() + 2);
+
+  for (size_t i = 0; i < 100; ++i)
+    EXPECT_TRUE(m_ctx->EraseElement(posArcs[i]));
+  for (size_t i = 0; i < 50; ++i)
+    EXPECT_TRUE(m_ctx->SetElementSubtype(negArcs[i], ScType::EdgeAccessConstPosPerm));
+
+  EXPECT_EQ(countArcs(ScType::EdgeAccessConstPosPerm), posArcs.size() - 100 + 50 + 1);
+  EXPECT_EQ(countArcs(ScType::EdgeAccessConstNegPerm), negArcs.size() - 50);
+  EXPECT_EQ(countArcs(ScType::EdgeAccess), posArcs.size() - 100 + negArcs.size() + 1);
+  EXPECT_EQ(countArcs(ScType::EdgeUCommon), 1u);
+  EXPECT_EQ(countArcs(ScType::Unknown), posArcs.size() - 100 + negArcs.size() + 2);
+}
+
+TEST_F(ScIterator3Test, FAAForElementBecomingHubDuringIteration)
+{
+  size_t const arcsCount = 1000;
+  for (size_t i = 0; i < arcsCount; ++i)
+  {
+    ScType const & arcType = i % 2 == 0 ? ScType::EdgeAccessConstNegPerm : ScType::EdgeAccessConstPosPerm;
+    m_ctx->GenerateConnector(arcType, m_source, m_ctx->GenerateNode(ScType::NodeConst));
+  }
+
+  ScAddrUnorderedSet visitedArcs;
+  ScIterator3Ptr const iter3 = m_ctx->CreateIterator3(m_source, ScType::EdgeAccess, ScType::Unknown);
+  EXPECT_TRUE(iter3->Next());
+  visitedArcs.insert(iter3->Get(1));
+
+  // outgoing sc-arcs of the element are indexed after this, but the iterator keeps visiting the list of them
+  for (size_t i = 0; i < 100; ++i)
+    m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, m_source, m_ctx->GenerateNode(ScType::NodeConst));
+
+  size_t count = 1;
+  while (iter3->Next())
+  {
+    visitedArcs.insert(iter3->Get(1));
+    ++count;
+  }
+
+  // the sc-arc generated in SetUp is visited too
+  EXPECT_EQ(count, arcsCount + 1);
+  EXPECT_EQ(visitedArcs.size(), arcsCount + 1);
+}
+
+TEST_F(ScIterator3Test, FAFForHubWithArcsToDifferentElements)
+{
+  size_t const arcsCount = 3000;
+  std::vector<ScAddr> targets;
+  for (size_t i = 0; i < arcsCount; ++i)
+  {
+    ScAddr const & targetAddr = m_ctx->GenerateNode(ScType::NodeConst);
+    m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, m_source, targetAddr);
+    targets.push_back(targetAddr);
+  }
+  ScAddr const & negArcAddr = m_ctx->GenerateConnector(ScType::EdgeAccessConstNegPerm, m_source, m_target);
+  ScAddr const & edgeAddr = m_ctx->GenerateConnector(ScType::EdgeUCommonConst, m_target, m_source);
+
+  auto const & countConnectors =
+      [this](ScAddr const & sourceAddr, ScType const & connectorType, ScAddr const & targetAddr) -> size_t
+  {
+    size_t count = 0;
+    ScIterator3Ptr const iter3 = m_ctx->CreateIterator3(sourceAddr, connectorType, targetAddr);
+    while (iter3->Next())
+    {
+      EXPECT_EQ(iter3->Get(0), sourceAddr);
+      EXPECT_EQ(iter3->Get(2), targetAddr);
+      ++count;
+    }
+    return count;
+  };
+
+  EXPECT_EQ(countConnectors(m_source, ScType::EdgeAccessConstPosPerm, m_target), 1u);
+  EXPECT_EQ(countConnectors(m_source, ScType::EdgeAccessConstNegPerm, m_target), 1u);
+  EXPECT_EQ(countConnectors(m_source, ScType::EdgeAccess, m_target), 2u);
+  EXPECT_EQ(countConnectors(m_source, ScType::EdgeUCommon, m_target), 1u);
+  EXPECT_EQ(countConnectors(m_source, ScType::Unknown, m_target), 3u);
+  EXPECT_EQ(countConnectors(m_target, ScType::EdgeUCommon, m_source), 1u);
+  EXPECT_EQ(countConnectors(m_target, ScType::Unknown, m_source), 1u);
+  EXPECT_EQ(countConnectors(m_source, ScType::EdgeAccessConstPosPerm, targets[100]), 1u);
+  EXPECT_EQ(countConnectors(m_target, ScType::EdgeAccessConstPosPerm, targets[100]), 0u);
+
+  EXPECT_TRUE(m_ctx->SetElementSubtype(edgeAddr, ScType::EdgeUCommonVar));
+  EXPECT_EQ(countConnectors(m_source, ScType::EdgeUCommonVar, m_target), 1u);
+  EXPECT_EQ(countConnectors(m_source, ScType::Unknown, m_target), 3u);
+  EXPECT_TRUE(m_ctx->SetElementSubtype(edgeAddr, ScType::EdgeUCommonConst));
+
+  EXPECT_TRUE(m_ctx->CheckConnector(m_source, m_target, ScType::EdgeAccessConstNegPerm));
+  EXPECT_TRUE(m_ctx->EraseElement(negArcAddr));
+  EXPECT_FALSE(m_ctx->CheckConnector(m_source, m_target, ScType::EdgeAccessConstNegPerm));
+  EXPECT_TRUE(m_ctx->CheckConnector(m_source, m_target, ScType::EdgeAccessConstPosPerm));
+  EXPECT_TRUE(m_ctx->CheckConnector(m_target, m_source, ScType::EdgeUCommonConst));
+  EXPECT_TRUE(m_ctx->EraseElement(edgeAddr));
+  EXPECT_FALSE(m_ctx->CheckConnector(m_target, m_source, ScType::EdgeUCommonConst));
+}
+
+TEST_F(ScIterator3Test, FAFForElementWithManyIncomingArcs)
+{
+  size_t const arcsCount = 3000;
+  for (size_t i = 0; i < arcsCount; ++i)
+    m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, m_ctx->GenerateNode(ScType::NodeConst), m_target);
+
+  ScAddr const & sourceAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  EXPECT_FALSE(m_ctx->CheckConnector(sourceAddr, m_target, ScType::EdgeAccessConstPosPerm));
+  ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, sourceAddr, m_target);
+  EXPECT_TRUE(m_ctx->CheckConnector(sourceAddr, m_target, ScType::EdgeAccessConstPosPerm));
+  EXPECT_TRUE(m_ctx->CheckConnector(m_source, m_target, ScType::EdgeAccessConstPosPerm));
+
+  ScIterator3Ptr const iter3 = m_ctx->CreateIterator3(sourceAddr, ScType::EdgeAccessConstPosPerm, m_target);
+  EXPECT_TRUE(iter3->Next());
+  EXPECT_EQ(iter3->Get(1), arcAddr);
+  EXPECT_FALSE(iter3->Next());
+}
+
 class ScEdgeTest : public ScMemoryTest
 {
 protected:
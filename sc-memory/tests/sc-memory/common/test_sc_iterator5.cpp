@@ -83,6 +83,46 @@ TEST_F(ScIterator5Test, InvalidIndex)
   EXPECT_EQ(iter5->Get(4), ScAddr::Empty);
 }
 
+TEST_F(ScIterator5Test, IterateInRangeBasedFor)
+{
+  size_t count = 0;
+  for (auto const & [source, connector, target, attrConnector, attr] : m_ctx->Iterate(
+           m_source, ScType::EdgeAccessConstPosPerm, ScType::Unknown, ScType::EdgeAccessConstPosPerm, m_attr))
+  {
+    EXPECT_EQ(source, m_source);
+    EXPECT_EQ(connector, m_connector);
+    EXPECT_EQ(target, m_target);
+    EXPECT_EQ(attrConnector, m_attrConnector);
+    EXPECT_EQ(attr, m_attr);
+    ++count;
+  }
+  EXPECT_EQ(count, 1u);
+}
+
+TEST_F(ScIterator5Test, CopyIteratorInTheMiddleAndIterateIndependently)
+{
+  ScAddr const & otherAttr = m_ctx->GenerateNode(ScType::NodeConst);
+  ScAddr const & otherAttrConnector = m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, otherAttr, m_connector);
+
+  auto iter5 = m_ctx->Iterate(
+      m_source, ScType::EdgeAccessConstPosPerm, ScType::Unknown, ScType::EdgeAccessConstPosPerm, ScType::NodeConst);
+  EXPECT_TRUE(iter5.Next());
+  ScAddr const & firstAttrConnector = iter5.Get(3);
+
+  auto copiedIter5 = std::make_unique<decltype(iter5)>(iter5);
+  EXPECT_TRUE(iter5.Next());
+  ScAddr const & secondAttrConnector = iter5.Get(3);
+  EXPECT_FALSE(iter5.Next());
+  EXPECT_EQ(ScAddrSet({firstAttrConnector, secondAttrConnector}), ScAddrSet({m_attrConnector, otherAttrConnector}));
+
+  auto secondCopiedIter5 = *copiedIter5;
+  copiedIter5.reset();
+  EXPECT_TRUE(secondCopiedIter5.Next());
+  EXPECT_EQ(secondCopiedIter5.Get(1), m_connector);
+  EXPECT_EQ(secondCopiedIter5.Get(3), secondAttrConnector);
+  EXPECT_FALSE(secondCopiedIter5.Next());
+}
+
 TEST_F(ScIterator5Test, AAFAA)
 {
   ScIterator5Ptr const iter5 = m_ctx->CreateIterator5(
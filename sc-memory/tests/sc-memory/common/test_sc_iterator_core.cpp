@@ -113,6 +113,41 @@ TEST_F(ScIterator3CoreTest, sc_iterator3_f_a_f)
   sc_iterator3_free(it);
 }
 
+TEST_F(ScIterator3CoreTest, sc_iterator3_f_a_f_init_on_stack)
+{
+  sc_iterator3 it;
+  EXPECT_TRUE(sc_iterator3_f_a_f_init(&it, **m_ctx, m_source, sc_type_arc_pos_const_perm, m_target));
+
+  EXPECT_TRUE(sc_iterator3_next(&it));
+
+  EXPECT_TRUE(SC_ADDR_IS_EQUAL(sc_iterator3_value(&it, 0), m_source));
+  EXPECT_TRUE(SC_ADDR_IS_EQUAL(sc_iterator3_value(&it, 1), m_connector));
+  EXPECT_TRUE(SC_ADDR_IS_EQUAL(sc_iterator3_value(&it, 2), m_target));
+
+  EXPECT_FALSE(sc_iterator3_next(&it));
+
+  EXPECT_TRUE(sc_iterator3_a_a_f_init(&it, **m_ctx, sc_type_node, sc_type_arc_pos_const_perm, m_target));
+  EXPECT_TRUE(sc_iterator3_next(&it));
+  EXPECT_TRUE(SC_ADDR_IS_EQUAL(sc_iterator3_value(&it, 0), m_source));
+  EXPECT_TRUE(SC_ADDR_IS_EQUAL(sc_iterator3_value(&it, 1), m_connector));
+  EXPECT_FALSE(sc_iterator3_next(&it));
+}
+
+TEST_F(ScIterator3CoreTest, sc_iterator3_init_invalid_params)
+{
+  sc_iterator3 it;
+  sc_iterator_param p1, p2, p3;
+  p1.is_type = SC_TRUE;
+  p1.type = sc_type_node;
+  p2.is_type = SC_TRUE;
+  p2.type = sc_type_arc_pos_const_perm;
+  p3.is_type = SC_TRUE;
+  p3.type = sc_type_node;
+
+  EXPECT_FALSE(sc_iterator3_init(&it, **m_ctx, sc_iterator3_f_a_a, p1, p2, p3));
+  EXPECT_FALSE(sc_iterator3_init(nullptr, **m_ctx, sc_iterator3_f_a_a, p1, p2, p3));
+}
+
 TEST_F(ScIterator3CoreTest, sc_iterator3_a_a_f)
 {
   sc_iterator3 * it =
@@ -353,6 +388,68 @@ TEST_F(ScIterator5CoreTest, sc_iterator5_f_a_a_a_a)
   sc_iterator5_free(it);
 }
 
+TEST_F(ScIterator5CoreTest, sc_iterator5_init_on_stack)
+{
+  sc_iterator_param p1, p2, p3, p4, p5;
+  p1.is_type = SC_FALSE;
+  p1.addr = m_source;
+  p2.is_type = SC_TRUE;
+  p2.type = sc_type_arc_pos_const_perm;
+  p3.is_type = SC_TRUE;
+  p3.type = sc_type_link | sc_type_const;
+  p4.is_type = SC_TRUE;
+  p4.type = sc_type_arc_pos_const_perm;
+  p5.is_type = SC_FALSE;
+  p5.addr = m_attr;
+
+  sc_iterator5 it;
+  EXPECT_TRUE(sc_iterator5_init(&it, **m_ctx, sc_iterator5_f_a_a_a_f, p1, p2, p3, p4, p5));
+  EXPECT_TRUE(sc_iterator5_next(&it));
+
+  EXPECT_TRUE(SC_ADDR_IS_EQUAL(sc_iterator5_value(&it, 0), m_source));
+  EXPECT_TRUE(SC_ADDR_IS_EQUAL(sc_iterator5_value(&it, 1), m_connector));
+  EXPECT_TRUE(SC_ADDR_IS_EQUAL(sc_iterator5_value(&it, 2), m_target));
+  EXPECT_TRUE(SC_ADDR_IS_EQUAL(sc_iterator5_value(&it, 3), m_attrEdge));
+  EXPECT_TRUE(SC_ADDR_IS_EQUAL(sc_iterator5_value(&it, 4), m_attr));
+
+  EXPECT_FALSE(sc_iterator5_next(&it));
+  EXPECT_FALSE(sc_iterator5_next(&it));
+
+  EXPECT_FALSE(sc_iterator5_init(&it, **m_ctx, sc_iterator5_a_a_a_a_f, p1, p2, p3, p4, p5));
+}
+
+TEST_F(ScIterator5CoreTest, sc_iterator5_f_a_a_a_f_several_main_connectors)
+{
+  sc_addr const otherTarget = sc_memory_link_new2(**m_ctx, sc_type_link | sc_type_const);
+  sc_addr const otherConnector = sc_memory_arc_new(**m_ctx, sc_type_arc_pos_const_perm, m_source, otherTarget);
+  sc_addr const notAttrConnectorTarget = sc_memory_link_new2(**m_ctx, sc_type_link | sc_type_const);
+  sc_memory_arc_new(**m_ctx, sc_type_arc_pos_const_perm, m_source, notAttrConnectorTarget);
+  sc_addr const otherAttrConnector = sc_memory_arc_new(**m_ctx, sc_type_arc_pos_const_perm, m_attr, otherConnector);
+
+  sc_iterator5 * it = sc_iterator5_f_a_a_a_f_new(
+      **m_ctx,
+      m_source,
+      sc_type_arc_pos_const_perm,
+      sc_type_link | sc_type_const,
+      sc_type_arc_pos_const_perm,
+      m_attr);
+  EXPECT_NE(it, nullptr);
+
+  sc_uint32 count = 0;
+  while (sc_iterator5_next(it))
+  {
+    sc_addr const connector = sc_iterator5_value(it, 1);
+    sc_addr const attrConnector = sc_iterator5_value(it, 3);
+    EXPECT_TRUE(
+        (SC_ADDR_IS_EQUAL(connector, m_connector) && SC_ADDR_IS_EQUAL(attrConnector, m_attrEdge))
+        || (SC_ADDR_IS_EQUAL(connector, otherConnector) && SC_ADDR_IS_EQUAL(attrConnector, otherAttrConnector)));
+    ++count;
+  }
+  EXPECT_EQ(count, 2u);
+
+  sc_iterator5_free(it);
+}
+
 TEST_F(ScIterator5CoreTest, sc_iterator5_f_a_f_a_a)
 {
   sc_iterator5 * it = sc_iterator5_f_a_f_a_a_new(
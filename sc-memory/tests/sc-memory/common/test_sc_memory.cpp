@@ -132,6 +132,66 @@ TEST_F(ScMemoryTest, LinkContentStringWithSpaces)
   EXPECT_EQ(str, "content with spaces");
 }
 
+TEST_F(ScMemoryTest, GetMetrics)
+{
+  ScMemory::ScMetrics const & initialMetrics = ScMemory::GetMetrics();
+
+  ScAddr const & linkAddr = m_ctx->GenerateLink();
+  EXPECT_TRUE(m_ctx->SetLinkContent(linkAddr, "content"));
+  std::string content;
+  EXPECT_TRUE(m_ctx->GetLinkContent(linkAddr, content));
+
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, nodeAddr, linkAddr);
+  ScIterator3Ptr const it3 = m_ctx->CreateIterator3(nodeAddr, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+  EXPECT_TRUE(it3->Next());
+  EXPECT_TRUE(m_ctx->EraseElement(nodeAddr));
+
+  ScMemory::ScMetrics const & metrics = ScMemory::GetMetrics();
+  // metrics are collected only if sc-machine is built with option SC_MEMORY_METRICS
+  if (initialMetrics.empty())
+  {
+    EXPECT_TRUE(metrics.empty());
+    return;
+  }
+
+  for (sc_char const * name :
+       {"element_allocation",
+        "element_erasure",
+        "iterator_creation",
+        "iterator_step",
+        "monitor_wait",
+        "fs_memory_read",
+        "fs_memory_write"})
+  {
+    ScMemory::ScMetric const & metric = metrics.at(name);
+    EXPECT_GT(metric.m_count, initialMetrics.at(name).m_count) << name;
+    EXPECT_EQ(metric.m_histogram.size(), initialMetrics.at(name).m_histogram.size()) << name;
+    EXPECT_FALSE(metric.m_histogram.empty()) << name;
+  }
+}
+
+TEST_F(ScMemoryTest, GetMetricsOfGenerationByTemplate)
+{
+  ScMemory::ScMetrics const & initialMetrics = ScMemory::GetMetrics();
+
+  // sc-nodes of template are generated at once
+  ScTemplate templ;
+  templ.Triple(ScType::NodeVar, ScType::EdgeAccessVarPosPerm, ScType::NodeVar);
+  ScTemplateGenResult result;
+  m_ctx->GenerateByTemplate(templ, result);
+
+  ScMemory::ScMetrics const & metrics = ScMemory::GetMetrics();
+  if (initialMetrics.empty())
+  {
+    EXPECT_TRUE(metrics.empty());
+    return;
+  }
+
+  EXPECT_GE(
+      metrics.at("element_allocation").m_count, initialMetrics.at("element_allocation").m_count + result.Size());
+}
+
 static inline ScTemplateKeynode const & testTemplate =
     ScTemplateKeynode("test_template").Triple(ScKeynodes::action_state, ScType::EdgeAccessVarPosPerm, ScType::NodeVar);
 
@@ -61,6 +61,183 @@ TEST_F(ScMemoryAPITest, GenerateElementsWithInvalidTypes)
   EXPECT_THROW(m_ctx->GenerateConnector(ScType::NodeConst, nodeAddr, linkAddr), utils::ExceptionInvalidParams);
 }
 
+TEST_F(ScMemoryAPITest, AreElements)
+{
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  ScAddr const & linkAddr = m_ctx->GenerateLink(ScType::LinkConst);
+  ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::EdgeAccess, nodeAddr, linkAddr);
+  ScAddr const & erasedNodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  EXPECT_TRUE(m_ctx->EraseElement(erasedNodeAddr));
+
+  EXPECT_EQ(
+      m_ctx->AreElements({arcAddr, ScAddr::Empty, nodeAddr, erasedNodeAddr, linkAddr}),
+      std::vector<bool>({true, false, true, false, true}));
+  EXPECT_TRUE(m_ctx->AreElements({}).empty());
+}
+
+TEST_F(ScMemoryAPITest, GetElementTypes)
+{
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::NodeConstClass);
+  ScAddr const & linkAddr = m_ctx->GenerateLink(ScType::LinkConst);
+  ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, nodeAddr, linkAddr);
+
+  EXPECT_EQ(
+      m_ctx->GetElementTypes({linkAddr, arcAddr, ScAddr::Empty, nodeAddr, linkAddr}),
+      std::vector<ScType>(
+          {ScType::LinkConst,
+           ScType::EdgeAccessConstPosPerm,
+           ScType::Unknown,
+           ScType::NodeConstClass,
+           ScType::LinkConst}));
+  EXPECT_TRUE(m_ctx->GetElementTypes({}).empty());
+}
+
+TEST_F(ScMemoryAPITest, GetElementTypesOfManyElements)
+{
+  std::vector<ScAddr> elementAddrs;
+  std::vector<ScType> expectedTypes;
+  for (size_t i = 0; i < 1000; ++i)
+  {
+    ScType const & type = i % 2 == 0 ? ScType::NodeConst : ScType::LinkVar;
+    elementAddrs.push_back(type.IsLink() ? m_ctx->GenerateLink(type) : m_ctx->GenerateNode(type));
+    expectedTypes.push_back(type);
+  }
+  std::reverse(elementAddrs.begin(), elementAddrs.end());
+  std::reverse(expectedTypes.begin(), expectedTypes.end());
+
+  EXPECT_EQ(m_ctx->GetElementTypes(elementAddrs), expectedTypes);
+}
+
+TEST_F(ScMemoryAPITest, GetConnectorsIncidentElements)
+{
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  ScAddr const & linkAddr = m_ctx->GenerateLink(ScType::LinkConst);
+  ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, nodeAddr, linkAddr);
+  ScAddr const & edgeAddr = m_ctx->GenerateConnector(ScType::EdgeUCommonConst, linkAddr, nodeAddr);
+
+  std::vector<std::tuple<ScAddr, ScAddr>> const incidentElements =
+      m_ctx->GetConnectorsIncidentElements({edgeAddr, nodeAddr, ScAddr::Empty, arcAddr});
+  EXPECT_EQ(
+      incidentElements,
+      (std::vector<std::tuple<ScAddr, ScAddr>>{
+          {linkAddr, nodeAddr}, {ScAddr::Empty, ScAddr::Empty}, {ScAddr::Empty, ScAddr::Empty}, {nodeAddr, linkAddr}}));
+}
+
+TEST_F(ScMemoryAPITest, EraseElements)
+{
+  ScAddr const & structureAddr = m_ctx->GenerateNode(ScType::NodeConstStruct);
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  ScAddr const & linkAddr = m_ctx->GenerateLink(ScType::LinkConst);
+  ScAddr const & edgeAddr = m_ctx->GenerateConnector(ScType::EdgeUCommonConst, nodeAddr, linkAddr);
+  ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, nodeAddr, edgeAddr);
+  ScAddr const & loopAddr = m_ctx->GenerateConnector(ScType::EdgeDCommonConst, linkAddr, linkAddr);
+
+  ScAddr const & otherNodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  ScAddr const & otherEdgeAddr = m_ctx->GenerateConnector(ScType::EdgeUCommonConst, otherNodeAddr, nodeAddr);
+  std::vector<ScAddr> structureArcAddrs;
+  for (ScAddr const & elementAddr : {nodeAddr, otherNodeAddr, linkAddr, edgeAddr})
+    structureArcAddrs.push_back(m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, structureAddr, elementAddr));
+
+  EXPECT_TRUE(m_ctx->EraseElements({nodeAddr, linkAddr, nodeAddr}));
+
+  EXPECT_EQ(
+      m_ctx->AreElements({nodeAddr, linkAddr, edgeAddr, arcAddr, loopAddr, otherEdgeAddr}),
+      std::vector<bool>(6, false));
+  EXPECT_EQ(m_ctx->AreElements(structureArcAddrs), std::vector<bool>({false, true, false, false}));
+  EXPECT_TRUE(m_ctx->IsElement(structureAddr));
+  EXPECT_TRUE(m_ctx->IsElement(otherNodeAddr));
+
+  EXPECT_EQ(m_ctx->GetElementEdgesAndOutgoingArcsCount(structureAddr), 1u);
+  EXPECT_EQ(m_ctx->GetElementEdgesAndIncomingArcsCount(otherNodeAddr), 1u);
+  EXPECT_EQ(m_ctx->GetElementEdgesAndOutgoingArcsCount(otherNodeAddr), 0u);
+
+  ScIterator3Ptr it3 = m_ctx->CreateIterator3(structureAddr, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+  EXPECT_TRUE(it3->Next());
+  EXPECT_EQ(it3->Get(1), structureArcAddrs[1]);
+  EXPECT_EQ(it3->Get(2), otherNodeAddr);
+  EXPECT_FALSE(it3->Next());
+
+  it3 = m_ctx->CreateIterator3(ScType::Unknown, ScType::EdgeAccessConstPosPerm, otherNodeAddr);
+  EXPECT_TRUE(it3->Next());
+  EXPECT_EQ(it3->Get(0), structureAddr);
+  EXPECT_FALSE(it3->Next());
+
+  EXPECT_TRUE(m_ctx->EraseElements({}));
+}
+
+TEST_F(ScMemoryAPITest, EraseElementsWithInvalidAddrs)
+{
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  ScAddr const & erasedNodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  EXPECT_TRUE(m_ctx->EraseElement(erasedNodeAddr));
+
+  EXPECT_FALSE(m_ctx->EraseElements({ScAddr::Empty, nodeAddr, erasedNodeAddr}));
+  EXPECT_FALSE(m_ctx->IsElement(nodeAddr));
+}
+
+TEST_F(ScMemoryAPITest, EraseManyElements)
+{
+  ScAddr const & structureAddr = m_ctx->GenerateNode(ScType::NodeConstStruct);
+  std::vector<ScAddr> elementAddrs;
+  ScAddr prevNodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  elementAddrs.push_back(prevNodeAddr);
+  for (size_t i = 0; i < 1000; ++i)
+  {
+    ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+    ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, prevNodeAddr, nodeAddr);
+    m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, structureAddr, nodeAddr);
+    m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, structureAddr, arcAddr);
+    elementAddrs.push_back(nodeAddr);
+    prevNodeAddr = nodeAddr;
+  }
+
+  EXPECT_TRUE(m_ctx->EraseElements(elementAddrs));
+  EXPECT_EQ(m_ctx->AreElements(elementAddrs), std::vector<bool>(elementAddrs.size(), false));
+  EXPECT_EQ(m_ctx->GetElementEdgesAndOutgoingArcsCount(structureAddr), 0u);
+
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, structureAddr, nodeAddr);
+  EXPECT_EQ(m_ctx->GetElementEdgesAndOutgoingArcsCount(structureAddr), 1u);
+}
+
+TEST_F(ScMemoryAPITest, CalculateStatistics)
+{
+  ScMemoryContext::ScMemoryStatistics const & statisticsBefore = m_ctx->CalculateStatistics();
+  size_t const classesCountBefore = m_ctx->GetElementsCountByType(ScType::NodeConstClass);
+  size_t const arcsCountBefore = m_ctx->GetElementsCountByType(ScType::EdgeAccessConstPosPerm);
+
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::NodeConstClass);
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  ScAddr const & linkAddr = m_ctx->GenerateLink(ScType::LinkConst);
+  m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, classAddr, nodeAddr);
+  m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, classAddr, linkAddr);
+
+  ScMemoryContext::ScMemoryStatistics statistics = m_ctx->CalculateStatistics();
+  EXPECT_EQ(statistics.m_nodesNum, statisticsBefore.m_nodesNum + 2);
+  EXPECT_EQ(statistics.m_linksNum, statisticsBefore.m_linksNum + 1);
+  EXPECT_EQ(statistics.m_connectorsNum, statisticsBefore.m_connectorsNum + 2);
+  EXPECT_EQ(statistics.GetAllNum(), statisticsBefore.GetAllNum() + 5);
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType::NodeConstClass), classesCountBefore + 1);
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType::EdgeAccessConstPosPerm), arcsCountBefore + 2);
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType::Unknown), statistics.GetAllNum());
+
+  EXPECT_TRUE(m_ctx->SetElementSubtype(nodeAddr, ScType::NodeConstClass));
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType::NodeConstClass), classesCountBefore + 2);
+
+  EXPECT_TRUE(m_ctx->EraseElement(classAddr));
+  statistics = m_ctx->CalculateStatistics();
+  EXPECT_EQ(statistics.m_nodesNum, statisticsBefore.m_nodesNum + 1);
+  EXPECT_EQ(statistics.m_linksNum, statisticsBefore.m_linksNum + 1);
+  EXPECT_EQ(statistics.m_connectorsNum, statisticsBefore.m_connectorsNum);
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType::NodeConstClass), classesCountBefore + 1);
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType::EdgeAccessConstPosPerm), arcsCountBefore);
+
+  EXPECT_TRUE(m_ctx->EraseElements({nodeAddr, linkAddr}));
+  statistics = m_ctx->CalculateStatistics();
+  EXPECT_EQ(statistics.GetAllNum(), statisticsBefore.GetAllNum());
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType::NodeConstClass), classesCountBefore);
+}
+
 TEST_F(ScMemoryAPITest, SetGetFindSystemIdentifier)
 {
   ScAddr const & addr = m_ctx->GenerateNode(ScType::NodeConst);
@@ -140,6 +317,46 @@ TEST_F(ScMemoryAPITest, ResolveGetSystemIdentifierWithOutFiver)
   EXPECT_TRUE(resolveQuintuple.addr5.IsValid());
 }
 
+TEST_F(ScMemoryAPITest, SearchSystemIdentifierAfterErasingElement)
+{
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::NodeConst);
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("test_node", addr));
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), addr);
+
+  EXPECT_TRUE(m_ctx->EraseElement(addr));
+  EXPECT_FALSE(m_ctx->SearchElementBySystemIdentifier("test_node").IsValid());
+
+  ScAddr const & otherAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("test_node", otherAddr));
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), otherAddr);
+}
+
+TEST_F(ScMemoryAPITest, SearchSystemIdentifierAfterErasingRelationPair)
+{
+  ScSystemIdentifierQuintuple quintuple;
+  EXPECT_TRUE(m_ctx->ResolveElementSystemIdentifier("test_node", ScType::NodeConst, quintuple));
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), quintuple.addr1);
+
+  EXPECT_TRUE(m_ctx->EraseElement(quintuple.addr2));
+  EXPECT_FALSE(m_ctx->SearchElementBySystemIdentifier("test_node").IsValid());
+
+  ScAddr const & addr = m_ctx->ResolveElementSystemIdentifier("test_node", ScType::NodeConst);
+  EXPECT_TRUE(addr.IsValid());
+  EXPECT_NE(addr, quintuple.addr1);
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), addr);
+}
+
+TEST_F(ScMemoryAPITest, SearchSystemIdentifierAfterChangingLinkContent)
+{
+  ScSystemIdentifierQuintuple quintuple;
+  EXPECT_TRUE(m_ctx->ResolveElementSystemIdentifier("test_node", ScType::NodeConst, quintuple));
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), quintuple.addr1);
+
+  EXPECT_TRUE(m_ctx->SetLinkContent(quintuple.addr3, "other_test_node"));
+  EXPECT_FALSE(m_ctx->SearchElementBySystemIdentifier("test_node").IsValid());
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("other_test_node"), quintuple.addr1);
+}
+
 SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_BEGIN
 
 TEST_F(ScMemoryAPITest, CreateNode_Deprecated)
@@ -204,7 +204,14 @@ void TestReadActionsSuccessfully(std::unique_ptr<ScAgentContext> const & context
   EXPECT_EQ(nodeAddr1, nodeAddr);
   EXPECT_EQ(nodeAddr2, linkAddr);
   EXPECT_EQ(userContext.GetElementType(nodeAddr), ScType::NodeConst);
+  EXPECT_EQ(userContext.AreElements({nodeAddr, arcAddr}), std::vector<bool>({true, true}));
+  EXPECT_EQ(
+      userContext.GetElementTypes({nodeAddr, linkAddr}), std::vector<ScType>({ScType::NodeConst, ScType::LinkConst}));
+  EXPECT_EQ(
+      userContext.GetConnectorsIncidentElements({arcAddr}),
+      (std::vector<std::tuple<ScAddr, ScAddr>>{{nodeAddr, linkAddr}}));
   EXPECT_NO_THROW(userContext.CalculateStatistics());
+  EXPECT_NO_THROW(userContext.GetElementsCountByType(ScType::NodeConst));
   std::string content;
   EXPECT_FALSE(userContext.GetLinkContent(linkAddr, content));
   EXPECT_TRUE(content.empty());
@@ -229,7 +236,11 @@ void TestReadActionsUnsuccessfully(std::unique_ptr<ScAgentContext> const & conte
   ScAddr nodeAddr1, nodeAddr2;
   EXPECT_THROW(userContext.GetConnectorIncidentElements(arcAddr), utils::ExceptionInvalidState);
   EXPECT_THROW(userContext.GetElementType(nodeAddr), utils::ExceptionInvalidState);
+  EXPECT_THROW(userContext.AreElements({nodeAddr}), utils::ExceptionInvalidState);
+  EXPECT_THROW(userContext.GetElementTypes({nodeAddr}), utils::ExceptionInvalidState);
+  EXPECT_THROW(userContext.GetConnectorsIncidentElements({arcAddr}), utils::ExceptionInvalidState);
   EXPECT_THROW(userContext.CalculateStatistics(), utils::ExceptionInvalidState);
+  EXPECT_THROW(userContext.GetElementsCountByType(ScType::NodeConst), utils::ExceptionInvalidState);
   std::string content;
   EXPECT_THROW(userContext.GetLinkContent(linkAddr, content), utils::ExceptionInvalidState);
 }
@@ -325,6 +336,9 @@ void TestEraseActionsSuccessfully(std::unique_ptr<ScAgentContext> const & contex
   ScAddr const & nodeAddr = context->GenerateNode(ScType::NodeConst);
 
   EXPECT_TRUE(userContext.EraseElement(nodeAddr));
+
+  ScAddr const & otherNodeAddr = context->GenerateNode(ScType::NodeConst);
+  EXPECT_TRUE(userContext.EraseElements({otherNodeAddr}));
 }
 
 void TestEraseActionsUnsuccessfully(std::unique_ptr<ScAgentContext> const & context, TestScMemoryContext & userContext)
@@ -332,6 +346,8 @@ void TestEraseActionsUnsuccessfully(std::unique_ptr<ScAgentContext> const & cont
   ScAddr const & nodeAddr = context->GenerateNode(ScType::NodeConst);
 
   EXPECT_THROW(userContext.EraseElement(nodeAddr), utils::ExceptionInvalidState);
+  EXPECT_THROW(userContext.EraseElements({nodeAddr}), utils::ExceptionInvalidState);
+  EXPECT_TRUE(context->IsElement(nodeAddr));
 }
 
 void TestApplyActionsSuccessfully(std::unique_ptr<ScAgentContext> const & context, TestScMemoryContext & userContext)
@@ -1402,6 +1418,11 @@ void TestReadActionsWithinStructureWithConnectorAndIncidentElementsSuccessfully(
     ScAddr const & relationAddr)
 {
   EXPECT_EQ(userContext.GetElementType(nodeAddr), ScType::NodeConst);
+  EXPECT_EQ(
+      userContext.GetElementTypes({nodeAddr, linkAddr}), std::vector<ScType>({ScType::NodeConst, ScType::LinkConst}));
+  EXPECT_EQ(
+      userContext.GetConnectorsIncidentElements({arcAddr}),
+      (std::vector<std::tuple<ScAddr, ScAddr>>{{nodeAddr, linkAddr}}));
 
   ScIterator3Ptr it3 = userContext.CreateIterator3(nodeAddr, ScType::EdgeAccessConstPosTemp, ScType::Unknown);
   EXPECT_TRUE(it3->Next());
@@ -1482,6 +1503,7 @@ void TestReadActionsWithinStructureWithConnectorAndIncidentElementsUnsuccessfull
     ScAddr const & nodeAddr)
 {
   EXPECT_THROW(userContext.GetElementType(nodeAddr), utils::ExceptionInvalidState);
+  EXPECT_THROW(userContext.GetElementTypes({nodeAddr}), utils::ExceptionInvalidState);
 
   ScIterator3Ptr const it3 = userContext.CreateIterator3(nodeAddr, ScType::EdgeAccessConstPosTemp, ScType::Unknown);
   EXPECT_FALSE(it3->Next());
@@ -1883,6 +1905,65 @@ TEST_F(ScMemoryTestWithUserMode, HandleElementsByAuthenticatedUserWithLocalReadP
   }
 }
 
+TEST_F(ScMemoryTestWithUserMode, HandleElementsBySeveralContextsOfUserWithLocalReadPermissionsAndWithoutAfter)
+{
+  ScAddr const & userAddr = m_ctx->GenerateNode(ScType::NodeConst);
+
+  ScAddr nodeAddr1, arcAddr, linkAddr, relationEdgeAddr, relationAddr, nodeAddr2;
+  ScAddr const & structureAddr = TestGenerateStructureWithConnectorAndIncidentElements(
+      m_ctx, nodeAddr1, arcAddr, linkAddr, relationEdgeAddr, relationAddr, nodeAddr2);
+
+  auto const & IsReadable = [&nodeAddr1](TestScMemoryContext & userContext) -> bool
+  {
+    try
+    {
+      return userContext.GetElementType(nodeAddr1) == ScType::NodeConst;
+    }
+    catch (utils::ExceptionInvalidState const &)
+    {
+      return false;
+    }
+  };
+
+  TestScMemoryContext userContext1{userAddr};
+  TestAddPermissionsForUserToInitReadActionsWithinStructure(m_ctx, userAddr, structureAddr);
+  TestAuthenticationRequestUser(m_ctx, userAddr);
+  SC_LOCK_WAIT_WHILE_TRUE(!IsReadable(userContext1));
+  EXPECT_TRUE(IsReadable(userContext1));
+
+  // Identified guest user has another sc-memory context of the same user
+  TestScMemoryContext userContext2;
+  TestSetIdentifiedUser(m_ctx, userContext2.GetUser(), userAddr);
+  SC_LOCK_WAIT_WHILE_TRUE(userContext2.GetUser() != userAddr);
+  EXPECT_EQ(userContext2.GetUser(), userAddr);
+
+  TestAuthenticationRequestUser(m_ctx, userAddr);
+  SC_LOCK_WAIT_WHILE_TRUE(!IsReadable(userContext2));
+  EXPECT_TRUE(IsReadable(userContext2));
+
+  ScAddr const & nrelUserActionClassWithinScStructureAddr{nrel_user_action_class_within_sc_structure_addr};
+  ScIterator3Ptr it3 = m_ctx->CreateIterator3(
+      nrelUserActionClassWithinScStructureAddr, ScType::EdgeAccessConstPosTemp, ScType::EdgeDCommonConst);
+  EXPECT_TRUE(it3->Next());
+  ScAddr const arcToUserActionClassAddr = it3->Get(2);
+
+  // Local permissions are removed before negative sc-arc to the erased sc-arc is generated
+  auto waiter = m_ctx->CreateConditionWaiter<ScEventAfterGenerateOutgoingArc<ScType::EdgeAccessConstNegTemp>>(
+      nrelUserActionClassWithinScStructureAddr,
+      [&]()
+      {
+        m_ctx->EraseElement(it3->Get(1));
+      },
+      [&](ScEventAfterGenerateOutgoingArc<ScType::EdgeAccessConstNegTemp> const & event) -> bool
+      {
+        return event.GetArcTargetElement() == arcToUserActionClassAddr;
+      });
+  EXPECT_TRUE(waiter->Wait(10000));
+
+  EXPECT_FALSE(IsReadable(userContext1));
+  EXPECT_FALSE(IsReadable(userContext2));
+}
+
 TEST_F(ScMemoryTestWithUserMode, HandleElementsByAuthenticatedUserHavingClassWithLocalReadPermissionsAndWithoutAfter)
 {
   ScAddr const & userAddr = m_ctx->GenerateNode(ScType::NodeConst);
@@ -2199,6 +2280,44 @@ TEST_F(ScMemoryTestWithUserMode, HandleElementsByAuthenticatedUserWithLocalReadP
   EXPECT_TRUE(isAuthenticated.load());
 }
 
+TEST_F(ScMemoryTestWithUserMode, HandleElementsByAuthenticatedUserWithLocalReadPermissionsAndWithChangedStructure)
+{
+  ScAddr const & userAddr = m_ctx->GenerateNode(ScType::NodeConst);
+
+  ScAddr nodeAddr1, arcAddr, linkAddr, relationEdgeAddr, relationAddr, nodeAddr2;
+  ScAddr const & structureAddr = TestGenerateStructureWithConnectorAndIncidentElements(
+      m_ctx, nodeAddr1, arcAddr, linkAddr, relationEdgeAddr, relationAddr, nodeAddr2);
+
+  TestScMemoryContext userContext{userAddr};
+  ScAddr const & conceptAuthenticatedUserAddr{concept_authenticated_user_addr};
+  std::atomic_bool isAuthenticated = false;
+  auto eventSubscription =
+      m_ctx->CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::EdgeAccess>>(
+          conceptAuthenticatedUserAddr,
+          [&](ScEventAfterGenerateOutgoingArc<ScType::EdgeAccess> const &)
+          {
+            isAuthenticated = true;
+          });
+  TestAddPermissionsForUserToInitReadActionsWithinStructure(m_ctx, userAddr, structureAddr);
+  TestAuthenticationRequestUser(m_ctx, userAddr);
+
+  SC_LOCK_WAIT_WHILE_TRUE(!isAuthenticated.load());
+  EXPECT_TRUE(isAuthenticated.load());
+
+  // results of repeated checks are cached, so they must be invalidated when the structure is changed
+  EXPECT_EQ(userContext.GetElementType(nodeAddr1), ScType::NodeConst);
+  EXPECT_EQ(userContext.GetElementType(nodeAddr1), ScType::NodeConst);
+  EXPECT_THROW(userContext.GetElementType(nodeAddr2), utils::ExceptionInvalidState);
+
+  ScStructure structure = m_ctx->ConvertToStructure(structureAddr);
+  structure << nodeAddr2;
+  EXPECT_EQ(userContext.GetElementType(nodeAddr2), ScType::NodeConst);
+
+  structure >> nodeAddr1;
+  EXPECT_THROW(userContext.GetElementType(nodeAddr1), utils::ExceptionInvalidState);
+  EXPECT_EQ(userContext.GetElementType(nodeAddr2), ScType::NodeConst);
+}
+
 ScAddr TestGenerateStructureWithLinks(
     std::unique_ptr<ScAgentContext> const & context,
     ScAddr & linkAddr1,
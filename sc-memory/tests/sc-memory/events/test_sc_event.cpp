@@ -2,6 +2,7 @@
 
 #include "sc-memory/sc_event.hpp"
 #include "sc-memory/sc_event_subscription.hpp"
+#include "sc-memory/sc_template_subscription.hpp"
 
 #include "sc-memory/sc_memory.hpp"
 #include "sc-memory/sc_timer.hpp"
@@ -85,6 +86,147 @@ TEST(ScEventQueueTest, EventsQueueDestroy)
   ScMemory::Shutdown();
 }
 
+void InitializeMemoryWithEventsQueue(sc_uint32 maxEventsQueueSize, sc_events_queue_overflow_mode overflowMode)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.clear = SC_TRUE;
+  params.repo_path = "repo";
+  params.log_level = "Debug";
+  params.dump_memory = SC_FALSE;
+  params.dump_memory_statistics = SC_FALSE;
+  params.max_events_and_agents_threads = 1;
+  params.max_events_queue_size = maxEventsQueueSize;
+  params.events_queue_overflow_mode = overflowMode;
+
+  ScMemory::LogMute();
+  ScMemory::Initialize(params);
+  ScMemory::LogUnmute();
+}
+
+void ShutdownMemory()
+{
+  ScMemory::LogMute();
+  ScMemory::Shutdown(SC_FALSE);
+  ScMemory::LogUnmute();
+}
+
+TEST(ScEventQueueTest, CalculateEventsStatistics)
+{
+  InitializeMemoryWithEventsQueue(0, SC_EVENTS_QUEUE_OVERFLOW_BLOCK);
+
+  {
+    ScAgentContext ctx;
+    ScAddr const nodeAddr = ctx.GenerateNode(ScType::NodeConst);
+
+    std::atomic<size_t> processedEventsCount = 0;
+    auto eventSubscription =
+        ctx.CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::EdgeAccessConstPosPerm>>(
+            nodeAddr,
+            [&processedEventsCount](ScEventAfterGenerateOutgoingArc<ScType::EdgeAccessConstPosPerm> const &)
+            {
+              ++processedEventsCount;
+            });
+
+    size_t const count = 10;
+    for (size_t i = 0; i < count; ++i)
+      ctx.GenerateConnector(ScType::EdgeAccessConstPosPerm, nodeAddr, ctx.GenerateNode(ScType::NodeConst));
+
+    ScTimer timer(5);
+    while (processedEventsCount < count && !timer.IsTimeOut())
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(processedEventsCount, count);
+
+    auto const & subscriptionStatistics = eventSubscription->GetStatistics();
+    EXPECT_EQ(subscriptionStatistics.m_processedEventsCount, count);
+
+    auto const & statistics = ctx.CalculateEventsStatistics();
+    EXPECT_EQ(statistics.m_maxQueueSize, 0u);
+    EXPECT_GE(statistics.m_processedEventsCount, count);
+    EXPECT_GE(statistics.m_eventsRunTime, subscriptionStatistics.m_eventsRunTime);
+    EXPECT_EQ(statistics.m_droppedEventsCount, 0u);
+    EXPECT_EQ(statistics.m_blockedEmissionsCount, 0u);
+  }
+
+  ShutdownMemory();
+}
+
+TEST(ScEventQueueTest, DropEventsIfQueueIsFull)
+{
+  InitializeMemoryWithEventsQueue(1, SC_EVENTS_QUEUE_OVERFLOW_DROP);
+
+  {
+    ScAgentContext ctx;
+    ScAddr const nodeAddr = ctx.GenerateNode(ScType::NodeConst);
+
+    std::atomic<size_t> processedEventsCount = 0;
+    auto eventSubscription =
+        ctx.CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::EdgeAccessConstPosPerm>>(
+            nodeAddr,
+            [&processedEventsCount](ScEventAfterGenerateOutgoingArc<ScType::EdgeAccessConstPosPerm> const &)
+            {
+              std::this_thread::sleep_for(std::chrono::milliseconds(50));
+              ++processedEventsCount;
+            });
+
+    size_t const count = 10;
+    for (size_t i = 0; i < count; ++i)
+      ctx.GenerateConnector(ScType::EdgeAccessConstPosPerm, nodeAddr, ctx.GenerateNode(ScType::NodeConst));
+
+    auto statistics = ctx.CalculateEventsStatistics();
+    EXPECT_EQ(statistics.m_maxQueueSize, 1u);
+    EXPECT_GT(statistics.m_droppedEventsCount, 0u);
+    EXPECT_LE(statistics.m_queueSize, 1u);
+
+    ScTimer timer(5);
+    while (ctx.CalculateEventsStatistics().m_queueSize != 0 && !timer.IsTimeOut())
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    statistics = ctx.CalculateEventsStatistics();
+    EXPECT_EQ(processedEventsCount + statistics.m_droppedEventsCount, count);
+  }
+
+  ShutdownMemory();
+}
+
+TEST(ScEventQueueTest, BlockEmittersIfQueueIsFull)
+{
+  InitializeMemoryWithEventsQueue(1, SC_EVENTS_QUEUE_OVERFLOW_BLOCK);
+
+  {
+    ScAgentContext ctx;
+    ScAddr const nodeAddr = ctx.GenerateNode(ScType::NodeConst);
+
+    std::atomic<size_t> processedEventsCount = 0;
+    auto eventSubscription =
+        ctx.CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::EdgeAccessConstPosPerm>>(
+            nodeAddr,
+            [&processedEventsCount](ScEventAfterGenerateOutgoingArc<ScType::EdgeAccessConstPosPerm> const &)
+            {
+              std::this_thread::sleep_for(std::chrono::milliseconds(10));
+              ++processedEventsCount;
+            });
+
+    size_t const count = 10;
+    for (size_t i = 0; i < count; ++i)
+    {
+      ctx.GenerateConnector(ScType::EdgeAccessConstPosPerm, nodeAddr, ctx.GenerateNode(ScType::NodeConst));
+      EXPECT_LE(ctx.CalculateEventsStatistics().m_queueSize, 1u);
+    }
+
+    ScTimer timer(5);
+    while (processedEventsCount < count && !timer.IsTimeOut())
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(processedEventsCount, count);
+
+    auto const & statistics = ctx.CalculateEventsStatistics();
+    EXPECT_EQ(statistics.m_droppedEventsCount, 0u);
+    EXPECT_GT(statistics.m_blockedEmissionsCount, 0u);
+  }
+
+  ShutdownMemory();
+}
+
 double const kTestTimeout = 0.1;
 
 template <ScType const & subscriptionConnectorType, ScType const & eventConnectorType>
@@ -1281,6 +1423,233 @@ TEST_F(ScEventTest, PendEvents)
   EXPECT_EQ(passedCount, el_num);
 }
 
+TEST_F(ScEventTest, DeliverEventsInOrderOfEmission)
+{
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+
+  std::mutex mutex;
+  ScAddrVector processedArcAddrs;
+  std::atomic<size_t> processingEventsCount = 0;
+  std::atomic<bool> wereEventsProcessedConcurrently = false;
+  auto eventSubscription =
+      m_ctx->CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::EdgeAccessConstPosPerm>>(
+          nodeAddr,
+          [&](ScEventAfterGenerateOutgoingArc<ScType::EdgeAccessConstPosPerm> const & event)
+          {
+            if (++processingEventsCount > 1)
+              wereEventsProcessedConcurrently = true;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            {
+              std::lock_guard<std::mutex> lock(mutex);
+              processedArcAddrs.push_back(event.GetArc());
+            }
+
+            --processingEventsCount;
+          });
+  eventSubscription->SetOrderedDelivery(true);
+
+  size_t const count = 50;
+  ScAddrVector arcAddrs;
+  for (size_t i = 0; i < count; ++i)
+    arcAddrs.push_back(
+        m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, nodeAddr, m_ctx->GenerateNode(ScType::NodeConst)));
+
+  ScTimer timer(5);
+  while (!timer.IsTimeOut())
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (processedArcAddrs.size() == count)
+        break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  EXPECT_FALSE(wereEventsProcessedConcurrently);
+  EXPECT_EQ(processedArcAddrs, arcAddrs);
+}
+
+TEST_F(ScEventTest, DeliverEventsOfSeveralSubscriptionsOfElementInOrderOfEmission)
+{
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+
+  std::mutex mutex;
+  ScAddrVector processedArcAddrs;
+  std::atomic<size_t> processingEventsCount = 0;
+  std::atomic<bool> wereEventsProcessedConcurrently = false;
+  auto const & processArc = [&](ScAddr const & arcAddr)
+  {
+    if (++processingEventsCount > 1)
+      wereEventsProcessedConcurrently = true;
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      processedArcAddrs.push_back(arcAddr);
+    }
+
+    --processingEventsCount;
+  };
+
+  auto outgoingArcsSubscription =
+      m_ctx->CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::EdgeAccessConstPosPerm>>(
+          nodeAddr,
+          [&](ScEventAfterGenerateOutgoingArc<ScType::EdgeAccessConstPosPerm> const & event)
+          {
+            processArc(event.GetArc());
+          });
+  outgoingArcsSubscription->SetOrderedDelivery(true);
+  auto incomingArcsSubscription =
+      m_ctx->CreateElementaryEventSubscription<ScEventAfterGenerateIncomingArc<ScType::EdgeAccessConstPosPerm>>(
+          nodeAddr,
+          [&](ScEventAfterGenerateIncomingArc<ScType::EdgeAccessConstPosPerm> const & event)
+          {
+            processArc(event.GetArc());
+          });
+  incomingArcsSubscription->SetOrderedDelivery(true);
+
+  size_t const count = 50;
+  ScAddrVector arcAddrs;
+  for (size_t i = 0; i < count; ++i)
+  {
+    ScAddr const & otherNodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+    arcAddrs.push_back(
+        i % 2 == 0 ? m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, nodeAddr, otherNodeAddr)
+                   : m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, otherNodeAddr, nodeAddr));
+  }
+
+  ScTimer timer(5);
+  while (!timer.IsTimeOut())
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (processedArcAddrs.size() == count)
+        break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  EXPECT_FALSE(wereEventsProcessedConcurrently);
+  EXPECT_EQ(processedArcAddrs, arcAddrs);
+}
+
+TEST_F(ScEventTest, PendEventsAndEraseElement)
+{
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  ScAddr const otherNodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  ScAddr const arcAddr = m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, nodeAddr, otherNodeAddr);
+
+  {
+    ScMemoryContextEventsPendingGuard guard(*m_ctx);
+    EXPECT_TRUE(m_ctx->EraseElement(arcAddr));
+  }
+
+  EXPECT_FALSE(m_ctx->IsElement(arcAddr));
+}
+
+TEST_F(ScEventTest, CoalescePendingEventsAndEmitTheSameEventOnce)
+{
+  ScAddr const linkAddr = m_ctx->GenerateLink(ScType::LinkConst);
+
+  std::atomic_uint eventsCount = 0;
+  auto eventSubscription = m_ctx->CreateElementaryEventSubscription<ScEventBeforeChangeLinkContent>(
+      linkAddr,
+      [&eventsCount](ScEventBeforeChangeLinkContent const &)
+      {
+        ++eventsCount;
+      });
+
+  {
+    ScMemoryContextEventsPendingGuard guard(*m_ctx, true);
+    for (size_t i = 0; i < 10; ++i)
+      m_ctx->SetLinkContent(linkAddr, "content" + std::to_string(i));
+  }
+
+  ScTimer timer(5);
+  while (eventsCount < 1u && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  // Coalesced events would be queued together with the emitted one
+  while (m_ctx->CalculateEventsStatistics().m_queueSize != 0 && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(eventsCount, 1u);
+}
+
+TEST_F(ScEventTest, CoalescePendingEventsAndCancelGeneratedAndErasedConnectors)
+{
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  ScAddr const otherNodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+
+  std::atomic_uint generateEventsCount = 0;
+  auto generateEventSubscription =
+      m_ctx->CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::EdgeAccessConstPosPerm>>(
+          nodeAddr,
+          [&generateEventsCount](ScEventAfterGenerateOutgoingArc<ScType::EdgeAccessConstPosPerm> const &)
+          {
+            ++generateEventsCount;
+          });
+  std::atomic_uint eraseEventsCount = 0;
+  auto eraseEventSubscription =
+      m_ctx->CreateElementaryEventSubscription<ScEventBeforeEraseOutgoingArc<ScType::EdgeAccessConstPosPerm>>(
+          nodeAddr,
+          [&eraseEventsCount](ScEventBeforeEraseOutgoingArc<ScType::EdgeAccessConstPosPerm> const &)
+          {
+            ++eraseEventsCount;
+          });
+
+  ScAddr remainedArcAddr;
+  {
+    ScMemoryContextEventsPendingGuard guard(*m_ctx, true);
+    for (size_t i = 0; i < 100; ++i)
+    {
+      ScAddr const arcAddr = m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, nodeAddr, otherNodeAddr);
+      EXPECT_TRUE(m_ctx->EraseElement(arcAddr));
+      EXPECT_FALSE(m_ctx->IsElement(arcAddr));
+    }
+    remainedArcAddr = m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, nodeAddr, otherNodeAddr);
+  }
+
+  ScTimer timer(5);
+  while (generateEventsCount < 1u && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  // Cancelled events would be queued together with the emitted one
+  while (m_ctx->CalculateEventsStatistics().m_queueSize != 0 && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(generateEventsCount, 1u);
+  EXPECT_EQ(eraseEventsCount, 0u);
+  EXPECT_TRUE(m_ctx->IsElement(remainedArcAddr));
+}
+
+TEST_F(ScEventTest, CoalescePendingEventsAndEraseExistingElement)
+{
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  ScAddr const otherNodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  ScAddr const arcAddr = m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, nodeAddr, otherNodeAddr);
+
+  std::atomic_bool isCalled = false;
+  auto eventSubscription =
+      m_ctx->CreateElementaryEventSubscription<ScEventBeforeEraseOutgoingArc<ScType::EdgeAccessConstPosPerm>>(
+          nodeAddr,
+          [&isCalled](ScEventBeforeEraseOutgoingArc<ScType::EdgeAccessConstPosPerm> const &)
+          {
+            isCalled = true;
+          });
+
+  {
+    ScMemoryContextEventsPendingGuard guard(*m_ctx, true);
+    EXPECT_TRUE(m_ctx->EraseElement(arcAddr));
+  }
+
+  ScTimer timer(kTestTimeout);
+  while (m_ctx->IsElement(arcAddr) && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  EXPECT_TRUE(isCalled);
+  EXPECT_FALSE(m_ctx->IsElement(arcAddr));
+}
+
 TEST_F(ScEventTest, BlockEventsAndNotEmitAfter)
 {
   ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
@@ -1385,3 +1754,98 @@ TEST_F(ScEventTest, BlockEventsGuardAndEmitAfter)
   std::this_thread::sleep_for(std::chrono::milliseconds(10));
   EXPECT_TRUE(isCalled);
 }
+
+TEST_F(ScEventTest, TemplateSubscriptionUpdatesConstructions)
+{
+  ScAddr const setAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  ScAddr const classAddr = m_ctx->GenerateNode(ScType::NodeConst);
+
+  ScAddr const elementAddr1 = m_ctx->GenerateNode(ScType::NodeConst);
+  m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, setAddr, elementAddr1);
+  m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, classAddr, elementAddr1);
+
+  ScTemplate templ;
+  templ.Triple(setAddr, ScType::EdgeAccessVarPosPerm, ScType::NodeVar >> "_element");
+  templ.Triple(classAddr, ScType::EdgeAccessVarPosPerm, "_element");
+
+  std::atomic<size_t> generatedCount = 0;
+  std::atomic<size_t> erasedCount = 0;
+  ScAddr const elementAddr2 = m_ctx->GenerateNode(ScType::NodeConst);
+  auto const subscription = m_ctx->CreateTemplateSubscription(
+      std::move(templ),
+      [&](ScTemplateResultItem const & item)
+      {
+        EXPECT_EQ(item["_element"], elementAddr2);
+        ++generatedCount;
+      },
+      [&](ScTemplateResultItem const & item)
+      {
+        EXPECT_EQ(item["_element"], elementAddr2);
+        ++erasedCount;
+      });
+  EXPECT_EQ(subscription->GetConstructionsCount(), 1u);
+
+  ScAddr const connectorAddr = m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, setAddr, elementAddr2);
+  m_ctx->GenerateConnector(ScType::EdgeAccessConstFuzPerm, classAddr, elementAddr2);
+  m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, classAddr, elementAddr2);
+
+  ScTimer timer(5);
+  while (generatedCount < 1 && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(generatedCount, 1u);
+  EXPECT_EQ(subscription->GetConstructionsCount(), 2u);
+
+  m_ctx->EraseElement(connectorAddr);
+
+  while (erasedCount < 1 && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(erasedCount, 1u);
+  EXPECT_EQ(subscription->GetConstructionsCount(), 1u);
+
+  size_t constructionsCount = 0;
+  subscription->ForEachConstruction(
+      [&](ScTemplateResultItem const & item)
+      {
+        EXPECT_EQ(item["_element"], elementAddr1);
+        ++constructionsCount;
+      });
+  EXPECT_EQ(constructionsCount, 1u);
+}
+
+TEST_F(ScEventTest, TemplateSubscriptionCallbackGetsConstructions)
+{
+  ScAddr const setAddr = m_ctx->GenerateNode(ScType::NodeConst);
+
+  ScTemplate templ;
+  templ.Triple(setAddr, ScType::EdgeAccessVarPosPerm, ScType::NodeVar >> "_element");
+
+  std::atomic<size_t> constructionsCount = 0;
+  std::shared_ptr<ScTemplateSubscription> subscription;
+  subscription = m_ctx->CreateTemplateSubscription(
+      std::move(templ),
+      [&](ScTemplateResultItem const &)
+      {
+        constructionsCount = subscription->GetConstructionsCount();
+      });
+
+  m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, setAddr, m_ctx->GenerateNode(ScType::NodeConst));
+
+  ScTimer timer(5);
+  while (constructionsCount < 1 && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(constructionsCount, 1u);
+}
+
+TEST_F(ScEventTest, TemplateSubscriptionWithTripleWithoutFixedElements)
+{
+  ScAddr const setAddr = m_ctx->GenerateNode(ScType::NodeConst);
+
+  ScTemplate templ;
+  templ.Triple(setAddr, ScType::EdgeAccessVarPosPerm, ScType::NodeVar >> "_element");
+  templ.Triple(ScType::NodeVar, ScType::EdgeAccessVarPosPerm, "_element");
+
+  EXPECT_THROW(
+      m_ctx->CreateTemplateSubscription(std::move(templ), [](ScTemplateResultItem const &) {}),
+      utils::ExceptionInvalidParams);
+}
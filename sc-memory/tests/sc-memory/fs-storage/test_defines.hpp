@@ -0,0 +1,3 @@
+#pragma once
+
+#define SC_DEPRECATED_DICTIONARY_FS_MEMORY_PATH "/root/repo/sc-memory/tests/sc-memory/fs-storage/deprecated-kb"
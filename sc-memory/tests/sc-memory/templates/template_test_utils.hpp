@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <set>
 
 using ScTemplateTest = ScMemoryTest;
 
@@ -50,6 +51,20 @@ inline bool HasAddr(ScAddrVector const & v, ScAddr const & addr)
   return std::find(v.begin(), v.end(), addr) != v.end();
 }
 
+//! Gets found sc-constructions as hashes of their sc-addresses, so results can be compared regardless of their order.
+inline std::set<std::vector<ScAddr::HashType>> GetConstructions(ScTemplateSearchResult const & result)
+{
+  std::set<std::vector<ScAddr::HashType>> constructions;
+  for (size_t i = 0; i < result.Size(); ++i)
+  {
+    std::vector<ScAddr::HashType> construction;
+    for (ScAddr const & addr : result[i])
+      construction.push_back(addr.Hash());
+    constructions.insert(construction);
+  }
+  return constructions;
+}
+
 inline ScAddr ResolveKeynode(ScMemoryContext & ctx, std::string const & idtf)
 {
   ScAddr const addr = ctx.ResolveElementSystemIdentifier(idtf, ScType::NodeConst);
@@ -451,3 +451,55 @@ TEST_F(ScTemplateGenApiTest, GenTemplateWithNodeReplacedByArc)
 
   EXPECT_EQ(result["_addr2"], edgeAddr);
 }
+
+TEST_F(ScTemplateGenApiTest, GenTemplateWithElementsSharedBetweenTriples)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::NodeConstClass);
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::EdgeAccessVarPosPerm >> "_class_arc", ScType::NodeVar >> "_node");
+  templ.Triple("_node", ScType::EdgeDCommonVar >> "_pair_arc", ScType::LinkVar >> "_link");
+  templ.Triple(ScType::NodeVarNoRole >> "_relation", ScType::EdgeAccessVarPosPerm >> "_relation_arc", "_pair_arc");
+  templ.Triple("_relation", ScType::EdgeAccessVarPosPerm, "_class_arc");
+  templ.Triple("_node", ScType::EdgeAccessVarPosTemp, "_node");
+
+  ScMemoryContext::ScMemoryStatistics const & statisticsBefore = m_ctx->CalculateStatistics();
+
+  ScTemplateGenResult result;
+  m_ctx->GenerateByTemplate(templ, result);
+  EXPECT_EQ(result.Size(), 15u);
+
+  ScMemoryContext::ScMemoryStatistics const & statisticsAfter = m_ctx->CalculateStatistics();
+  EXPECT_EQ(statisticsAfter.m_nodesNum, statisticsBefore.m_nodesNum + 2);
+  EXPECT_EQ(statisticsAfter.m_linksNum, statisticsBefore.m_linksNum + 1);
+  EXPECT_EQ(statisticsAfter.m_connectorsNum, statisticsBefore.m_connectorsNum + 5);
+
+  EXPECT_EQ(result[0], classAddr);
+  EXPECT_EQ(m_ctx->GetElementType(result["_node"]), ScType::NodeConst);
+  EXPECT_EQ(m_ctx->GetElementType(result["_link"]), ScType::LinkConst);
+  EXPECT_EQ(m_ctx->GetElementType(result["_relation"]), ScType::NodeConstNoRole);
+  EXPECT_TRUE(m_ctx->CheckConnector(classAddr, result["_node"], ScType::EdgeAccessConstPosPerm));
+  EXPECT_TRUE(m_ctx->CheckConnector(result["_node"], result["_link"], ScType::EdgeDCommonConst));
+  EXPECT_TRUE(m_ctx->CheckConnector(result["_relation"], result["_pair_arc"], ScType::EdgeAccessConstPosPerm));
+  EXPECT_TRUE(m_ctx->CheckConnector(result["_relation"], result["_class_arc"], ScType::EdgeAccessConstPosPerm));
+  EXPECT_TRUE(m_ctx->CheckConnector(result["_node"], result["_node"], ScType::EdgeAccessConstPosTemp));
+  EXPECT_EQ(result[6], result["_relation"]);
+  EXPECT_EQ(result[8], result["_pair_arc"]);
+  EXPECT_EQ(result[11], result["_class_arc"]);
+  EXPECT_EQ(result[12], result[14]);
+}
+
+TEST_F(ScTemplateGenApiTest, GenInvalidTemplateWithoutGeneratingElements)
+{
+  ScTemplate templ;
+  templ.Triple(ScType::NodeVar >> "_node", ScType::EdgeAccessVarPosPerm, ScType::NodeVar);
+  templ.Triple("_node", ScType::EdgeAccessVarPosPerm, ScType::Unknown);
+
+  ScMemoryContext::ScMemoryStatistics const & statisticsBefore = m_ctx->CalculateStatistics();
+
+  ScTemplateGenResult result;
+  EXPECT_THROW(m_ctx->GenerateByTemplate(templ, result), utils::ExceptionInvalidParams);
+
+  ScMemoryContext::ScMemoryStatistics const & statisticsAfter = m_ctx->CalculateStatistics();
+  EXPECT_EQ(statisticsAfter.GetAllNum(), statisticsBefore.GetAllNum());
+}
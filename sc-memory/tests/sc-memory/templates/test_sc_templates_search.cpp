@@ -476,3 +476,484 @@ TEST_F(ScTemplateSearchTest, StructureElements)
   EXPECT_EQ(searchResult[0]["_target"], targetAddr);
   EXPECT_EQ(searchResult[0]["_relation"], relationAddr);
 }
+
+TEST_F(ScTemplateSearchTest, SearchInStructure)
+{
+  ScAddr const & structureAddr = m_ctx->GenerateNode(ScType::NodeConstStruct);
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::NodeConstClass);
+  m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, structureAddr, classAddr);
+
+  size_t const constructionsCount = 20;
+  ScAddrUnorderedSet structureInstances;
+  for (size_t i = 0; i < constructionsCount; ++i)
+  {
+    ScAddr const & instanceAddr = m_ctx->GenerateNode(ScType::NodeConst);
+    ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, classAddr, instanceAddr);
+    if (i % 2 == 0)
+      continue;
+
+    m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, structureAddr, instanceAddr);
+    m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, structureAddr, arcAddr);
+    structureInstances.insert(instanceAddr);
+  }
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::EdgeAccessVarPosPerm, ScType::NodeVar >> "_instance");
+
+  ScTemplateSearchOptions options;
+  options.m_structureAddr = structureAddr;
+
+  // count of checks of sc-elements exceeds count of sc-elements of sc-structure
+  ScTemplateSearchResult searchResult;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult, options));
+  EXPECT_EQ(searchResult.Size(), structureInstances.size());
+  searchResult.ForEach(
+      [&](ScTemplateResultItem const & item)
+      {
+        EXPECT_TRUE(structureInstances.count(item["_instance"]));
+      });
+
+  // count of checks of sc-elements doesn't exceed count of sc-elements of sc-structure
+  ScAddr const & instanceAddr = *structureInstances.begin();
+  templ.Clear();
+  templ.Triple(classAddr, ScType::EdgeAccessVarPosPerm >> "_arc", instanceAddr);
+
+  size_t foundCount = 0;
+  m_ctx->SearchByTemplate(
+      templ,
+      [&](ScTemplateResultItem const & item)
+      {
+        EXPECT_EQ(item[2], instanceAddr);
+        ++foundCount;
+      },
+      {},
+      {},
+      options);
+  EXPECT_EQ(foundCount, 1u);
+
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult));
+  EXPECT_EQ(searchResult.Size(), 1u);
+}
+
+TEST_F(ScTemplateSearchTest, ReplacementsSharedBetweenTriples)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::NodeConstClass);
+  ScAddr const & relationAddr = m_ctx->GenerateNode(ScType::NodeConstNoRole);
+
+  ScTemplate templ;
+  templ.Triple(classAddr >> "_class", ScType::EdgeAccessVarPosPerm >> "_class_arc", ScType::NodeVar >> "_x");
+  templ.Quintuple(
+      "_x", ScType::EdgeDCommonVar >> "_pair_arc", ScType::NodeVar >> "_y", ScType::EdgeAccessVarPosPerm, relationAddr);
+  templ.Triple("_class", ScType::EdgeAccessVarPosPerm, "_y");
+
+  size_t const constructionsCount = 5;
+  for (size_t i = 0; i < constructionsCount; ++i)
+  {
+    ScTemplateGenResult genResult;
+    m_ctx->GenerateByTemplate(templ, genResult);
+  }
+
+  auto const & CheckItem = [&](ScTemplateResultItem const & item)
+  {
+    EXPECT_EQ(item["_class"], classAddr);
+    EXPECT_EQ(m_ctx->GetArcSourceElement(item["_class_arc"]), classAddr);
+    EXPECT_EQ(m_ctx->GetArcTargetElement(item["_class_arc"]), item["_x"]);
+    EXPECT_EQ(m_ctx->GetArcSourceElement(item["_pair_arc"]), item["_x"]);
+    EXPECT_EQ(m_ctx->GetArcTargetElement(item["_pair_arc"]), item["_y"]);
+    EXPECT_TRUE(m_ctx->CheckConnector(classAddr, item["_y"], ScType::EdgeAccessConstPosPerm));
+  };
+
+  ScTemplateSearchResult searchResult;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult));
+  EXPECT_EQ(searchResult.Size(), constructionsCount);
+  searchResult.ForEach(CheckItem);
+
+  size_t foundCount = 0;
+  m_ctx->SearchByTemplate(
+      templ,
+      [&](ScTemplateResultItem const & item)
+      {
+        CheckItem(item);
+        ++foundCount;
+      });
+  EXPECT_EQ(foundCount, constructionsCount);
+}
+
+TEST_F(ScTemplateSearchTest, SearchResultConstructionsInOneBuffer)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::NodeConstClass);
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::EdgeAccessVarPosPerm >> "_arc", ScType::NodeVar >> "_x");
+
+  size_t const constructionsCount = 3;
+  for (size_t i = 0; i < constructionsCount; ++i)
+    m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, classAddr, m_ctx->GenerateNode(ScType::NodeConst));
+
+  ScTemplateSearchResult searchResult;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult));
+  EXPECT_EQ(searchResult.Size(), constructionsCount);
+
+  ScAddrVector const & addrs = searchResult.GetReplacementConstructions();
+  EXPECT_EQ(addrs.size(), constructionsCount * 3);
+  for (size_t i = 0; i < searchResult.Size(); ++i)
+  {
+    ScTemplateResultItem item;
+    EXPECT_TRUE(searchResult.Get(i, item));
+    EXPECT_EQ(item.Size(), 3u);
+    EXPECT_EQ(&*item.begin(), addrs.data() + i * 3);
+    EXPECT_EQ(item[0], classAddr);
+    EXPECT_EQ(item["_x"], addrs[i * 3 + 2]);
+  }
+
+  ScTemplateResultItem copiedItem;
+  {
+    ScTemplateResultItem item;
+    EXPECT_TRUE(searchResult.Get(0, item));
+    copiedItem = item;
+  }
+  ScTemplateResultItem const ownedItem = searchResult[1];
+  EXPECT_NE(&*ownedItem.begin(), addrs.data() + 3);
+  ScAddr const xAddr = copiedItem["_x"];
+  ScAddr const otherXAddr = ownedItem["_x"];
+  searchResult.Clear();
+  EXPECT_EQ(copiedItem["_x"], xAddr);
+  EXPECT_EQ(copiedItem[0], classAddr);
+  EXPECT_TRUE(m_ctx->CheckConnector(classAddr, xAddr, ScType::EdgeAccessConstPosPerm));
+  EXPECT_EQ(ownedItem["_x"], otherXAddr);
+  EXPECT_EQ(ownedItem[0], classAddr);
+  EXPECT_TRUE(m_ctx->CheckConnector(classAddr, otherXAddr, ScType::EdgeAccessConstPosPerm));
+}
+
+TEST_F(ScTemplateSearchTest, SearchInParallel)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::NodeConstClass);
+  ScAddr const & relationAddr = m_ctx->GenerateNode(ScType::NodeConstNoRole);
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::EdgeAccessVarPosPerm >> "_class_arc", ScType::NodeVar >> "_x");
+  templ.Quintuple(
+      "_x", ScType::EdgeDCommonVar >> "_pair_arc", ScType::NodeVar >> "_y", ScType::EdgeAccessVarPosPerm, relationAddr);
+
+  size_t const constructionsCount = 100;
+  for (size_t i = 0; i < constructionsCount; ++i)
+  {
+    ScTemplateGenResult genResult;
+    m_ctx->GenerateByTemplate(templ, genResult);
+  }
+
+  auto const & CheckItem = [&](ScTemplateResultItem const & item)
+  {
+    EXPECT_EQ(m_ctx->GetArcSourceElement(item["_class_arc"]), classAddr);
+    EXPECT_EQ(m_ctx->GetArcTargetElement(item["_class_arc"]), item["_x"]);
+    EXPECT_EQ(m_ctx->GetArcSourceElement(item["_pair_arc"]), item["_x"]);
+    EXPECT_EQ(m_ctx->GetArcTargetElement(item["_pair_arc"]), item["_y"]);
+  };
+
+  ScTemplateSearchOptions options;
+  options.m_threadsCount = 4;
+
+  ScTemplateSearchResult searchResult;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult, options));
+  EXPECT_EQ(searchResult.Size(), constructionsCount);
+  searchResult.ForEach(CheckItem);
+
+  ScAddrUnorderedSet foundElements;
+  m_ctx->SearchByTemplate(
+      templ,
+      [&](ScTemplateResultItem const & item)
+      {
+        CheckItem(item);
+        foundElements.insert(item["_x"]);
+      },
+      {},
+      {},
+      options);
+  EXPECT_EQ(foundElements.size(), constructionsCount);
+
+  size_t foundCount = 0;
+  m_ctx->SearchByTemplateInterruptibly(
+      templ,
+      [&](ScTemplateResultItem const &) -> ScTemplateSearchRequest
+      {
+        ++foundCount;
+        return ScTemplateSearchRequest::STOP;
+      },
+      {},
+      {},
+      options);
+  EXPECT_EQ(foundCount, 1u);
+
+  // search with filter callback isn't divided between threads, so the callback needn't be thread-safe
+  std::thread::id const searchThreadId = std::this_thread::get_id();
+  size_t filteredCount = 0;
+  foundElements.clear();
+  m_ctx->SearchByTemplate(
+      templ,
+      [&](ScTemplateResultItem const & item)
+      {
+        foundElements.insert(item["_x"]);
+      },
+      [&](ScTemplateResultItem const &) -> bool
+      {
+        EXPECT_EQ(std::this_thread::get_id(), searchThreadId);
+        return ++filteredCount % 2 == 0;
+      },
+      {},
+      options);
+  EXPECT_EQ(filteredCount, constructionsCount);
+  EXPECT_EQ(foundElements.size(), constructionsCount / 2);
+}
+
+TEST_F(ScTemplateSearchTest, SearchByCursor)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::NodeConstClass);
+  ScAddr const & relationAddr = m_ctx->GenerateNode(ScType::NodeConstNoRole);
+
+  ScTemplate templ;
+  templ.Triple(classAddr >> "_class", ScType::EdgeAccessVarPosPerm >> "_class_arc", ScType::NodeVar >> "_x");
+  templ.Quintuple(
+      "_x", ScType::EdgeDCommonVar >> "_pair_arc", ScType::NodeVar >> "_y", ScType::EdgeAccessVarPosPerm, relationAddr);
+  templ.Triple("_class", ScType::EdgeAccessVarPosPerm, "_y");
+
+  size_t const constructionsCount = 10;
+  for (size_t i = 0; i < constructionsCount; ++i)
+  {
+    ScTemplateGenResult genResult;
+    m_ctx->GenerateByTemplate(templ, genResult);
+  }
+
+  ScAddrUnorderedSet expectedElements;
+  m_ctx->SearchByTemplate(
+      templ,
+      [&](ScTemplateResultItem const & item)
+      {
+        expectedElements.insert(item["_x"]);
+      });
+  EXPECT_EQ(expectedElements.size(), constructionsCount);
+
+  ScTemplateResultItem item;
+  ScAddrUnorderedSet foundElements;
+  ScTemplateSearchCursor cursor = m_ctx->CreateTemplateSearchCursor(templ);
+  while (cursor.Next(item))
+  {
+    EXPECT_EQ(item["_class"], classAddr);
+    EXPECT_EQ(m_ctx->GetArcSourceElement(item["_class_arc"]), classAddr);
+    EXPECT_EQ(m_ctx->GetArcTargetElement(item["_class_arc"]), item["_x"]);
+    EXPECT_EQ(m_ctx->GetArcSourceElement(item["_pair_arc"]), item["_x"]);
+    EXPECT_EQ(m_ctx->GetArcTargetElement(item["_pair_arc"]), item["_y"]);
+    EXPECT_TRUE(m_ctx->CheckConnector(classAddr, item["_y"], ScType::EdgeAccessConstPosPerm));
+    foundElements.insert(item["_x"]);
+  }
+  EXPECT_FALSE(cursor.Next(item));
+  EXPECT_EQ(cursor.GetFoundCount(), constructionsCount);
+  EXPECT_EQ(foundElements, expectedElements);
+  EXPECT_TRUE(cursor.GetReplacements().count("_x"));
+
+  size_t const pageSize = 3;
+  foundElements.clear();
+  for (size_t offset = 0; offset < constructionsCount + pageSize; offset += pageSize)
+  {
+    ScTemplateSearchCursor pageCursor = m_ctx->CreateTemplateSearchCursor(templ, offset, pageSize);
+    while (pageCursor.Next(item))
+      foundElements.insert(item["_x"]);
+
+    EXPECT_EQ(
+        pageCursor.GetFoundCount(), std::min(pageSize, constructionsCount - std::min(offset, constructionsCount)));
+  }
+  EXPECT_EQ(foundElements, expectedElements);
+}
+
+TEST_F(ScTemplateSearchTest, SearchByCursorWithoutConstructions)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::NodeConstClass);
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::EdgeAccessVarPosPerm, ScType::NodeVar >> "_x");
+
+  ScTemplateResultItem item;
+  ScTemplateSearchCursor cursor = m_ctx->CreateTemplateSearchCursor(templ);
+  EXPECT_FALSE(cursor.Next(item));
+  EXPECT_EQ(cursor.GetFoundCount(), 0u);
+}
+
+TEST_F(ScTemplateSearchTest, SearchByTemplatesInOnePass)
+{
+  ScAddr const & actionClassAddr = m_ctx->GenerateNode(ScType::NodeConstClass);
+  ScAddr const & initiatedActionAddr = m_ctx->GenerateNode(ScType::NodeConstClass);
+
+  ScTemplate actionTemplate;
+  actionTemplate.Triple(actionClassAddr, ScType::EdgeAccessVarPosPerm >> "_arc", ScType::NodeVar >> "_action");
+  actionTemplate.Triple("_action", ScType::EdgeAccessVarPosPerm, ScType::NodeVar >> "_argument");
+
+  ScTemplate initiatedActionTemplate;
+  initiatedActionTemplate.Triple(actionClassAddr, ScType::EdgeAccessVarPosPerm, ScType::NodeVar >> "_other_action");
+  initiatedActionTemplate.Triple(initiatedActionAddr, ScType::EdgeAccessVarPosPerm, "_other_action");
+
+  ScTemplate classTemplate;
+  classTemplate.Triple(actionClassAddr, ScType::EdgeAccessVarPosPerm, ScType::NodeVar);
+
+  ScTemplate emptyTemplate;
+
+  size_t const actionsCount = 10;
+  for (size_t i = 0; i < actionsCount; ++i)
+  {
+    ScAddr const & actionAddr = m_ctx->GenerateNode(ScType::NodeConst);
+    m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, actionClassAddr, actionAddr);
+    m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, actionAddr, m_ctx->GenerateNode(ScType::NodeConst));
+    if (i % 2 == 0)
+      m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, initiatedActionAddr, actionAddr);
+  }
+
+  std::vector<ScTemplateSearchResult> results;
+  m_ctx->SearchByTemplates({&actionTemplate, &initiatedActionTemplate, &classTemplate, &emptyTemplate}, results);
+  EXPECT_EQ(results.size(), 4u);
+  EXPECT_EQ(results[0].Size(), actionsCount);
+  EXPECT_EQ(results[1].Size(), actionsCount / 2);
+  EXPECT_EQ(results[2].Size(), actionsCount);
+  EXPECT_TRUE(results[3].IsEmpty());
+
+  std::vector<std::pair<ScTemplate const *, ScTemplateSearchResult const *>> const templatesResults = {
+      {&actionTemplate, &results[0]}, {&initiatedActionTemplate, &results[1]}, {&classTemplate, &results[2]}};
+  for (auto const & [templ, result] : templatesResults)
+  {
+    ScTemplateSearchResult expectedResult;
+    m_ctx->SearchByTemplate(*templ, expectedResult);
+    EXPECT_EQ(result->Size(), expectedResult.Size());
+    EXPECT_EQ(GetConstructions(*result), GetConstructions(expectedResult));
+  }
+
+  ScTemplateResultItem item;
+  EXPECT_TRUE(results[0].Get(0, item));
+  EXPECT_EQ(m_ctx->GetArcTargetElement(item["_arc"]), item["_action"]);
+  EXPECT_TRUE(m_ctx->CheckConnector(item["_action"], item["_argument"], ScType::EdgeAccessConstPosPerm));
+  EXPECT_TRUE(results[1].Get(0, item));
+  EXPECT_TRUE(m_ctx->CheckConnector(initiatedActionAddr, item["_other_action"], ScType::EdgeAccessConstPosPerm));
+}
+
+TEST_F(ScTemplateSearchTest, SearchCycledTemplateByJoin)
+{
+  ScAddr const & setAddr = m_ctx->GenerateNode(ScType::NodeConst);
+
+  size_t const elementsCount = 30;
+  ScAddrVector elementsAddrs;
+  for (size_t i = 0; i < elementsCount; ++i)
+  {
+    elementsAddrs.push_back(m_ctx->GenerateNode(ScType::NodeConst));
+    m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, setAddr, elementsAddrs.back());
+  }
+
+  auto const & IsConnected = [](size_t const i, size_t const j)
+  {
+    return i < j && (i + j) % 3 != 0;
+  };
+  for (size_t i = 0; i < elementsCount; ++i)
+  {
+    for (size_t j = 0; j < elementsCount; ++j)
+    {
+      if (IsConnected(i, j))
+        m_ctx->GenerateConnector(ScType::EdgeDCommonConst, elementsAddrs[i], elementsAddrs[j]);
+    }
+  }
+
+  std::set<std::array<ScAddr::HashType, 3>> expectedTriangles;
+  for (size_t i = 0; i < elementsCount; ++i)
+  {
+    for (size_t j = 0; j < elementsCount; ++j)
+    {
+      for (size_t k = 0; k < elementsCount; ++k)
+      {
+        if (IsConnected(i, j) && IsConnected(j, k) && IsConnected(i, k))
+          expectedTriangles.insert({elementsAddrs[i].Hash(), elementsAddrs[j].Hash(), elementsAddrs[k].Hash()});
+      }
+    }
+  }
+  size_t const expectedCount = expectedTriangles.size();
+
+  ScTemplate templ;
+  templ.Triple(setAddr, ScType::EdgeAccessVarPosPerm, ScType::NodeVar >> "_x");
+  templ.Triple(setAddr, ScType::EdgeAccessVarPosPerm, ScType::NodeVar >> "_y");
+  templ.Triple(setAddr, ScType::EdgeAccessVarPosPerm, ScType::NodeVar >> "_z");
+  templ.Triple("_x", ScType::EdgeDCommonVar, "_y");
+  templ.Triple("_y", ScType::EdgeDCommonVar, "_z");
+  templ.Triple("_x", ScType::EdgeDCommonVar, "_z");
+  EXPECT_NE(m_ctx->ExplainSearchByTemplate(templ).find("Search by join of 3 variable(s)"), std::string::npos);
+
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, result));
+  EXPECT_EQ(result.Size(), expectedCount);
+
+  EXPECT_EQ(GetConstructions(result).size(), expectedCount);
+
+  // triples from `setAddr` are equal, but join finds all triangles, not only ones with sc-arcs unused by other results
+  std::set<std::array<ScAddr::HashType, 3>> triangles;
+  result.ForEach(
+      [this, &triangles](ScTemplateResultItem const & item)
+      {
+        EXPECT_TRUE(m_ctx->CheckConnector(item["_x"], item["_y"], ScType::EdgeDCommonConst));
+        EXPECT_TRUE(m_ctx->CheckConnector(item["_y"], item["_z"], ScType::EdgeDCommonConst));
+        EXPECT_TRUE(m_ctx->CheckConnector(item["_x"], item["_z"], ScType::EdgeDCommonConst));
+        triangles.insert({item["_x"].Hash(), item["_y"].Hash(), item["_z"].Hash()});
+      });
+  EXPECT_EQ(triangles, expectedTriangles);
+
+  ScTemplateSearchOptions options;
+  options.m_threadsCount = 4;
+  std::atomic<size_t> foundCount = 0;
+  m_ctx->SearchByTemplate(
+      templ,
+      [&foundCount](ScTemplateResultItem const &)
+      {
+        ++foundCount;
+      },
+      {},
+      {},
+      options);
+  EXPECT_EQ(foundCount, expectedCount);
+}
+
+TEST_F(ScTemplateSearchTest, SearchFromMostSelectiveTriple)
+{
+  ScAddr const & hubClassAddr = m_ctx->GenerateNode(ScType::NodeConstClass);
+  ScAddr const & selectiveClassAddr = m_ctx->GenerateNode(ScType::NodeConstClass);
+
+  size_t const hubInstancesCount = 100;
+  for (size_t i = 0; i < hubInstancesCount; ++i)
+    m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, hubClassAddr, m_ctx->GenerateNode(ScType::NodeConst));
+
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::NodeConst);
+  m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, hubClassAddr, nodeAddr);
+  m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, selectiveClassAddr, nodeAddr);
+
+  ScTemplate templ;
+  templ.Triple(hubClassAddr, ScType::EdgeAccessVarPosPerm, ScType::NodeVar >> "_node");
+  templ.Triple(selectiveClassAddr, ScType::EdgeAccessVarPosPerm, "_node");
+
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, result));
+  EXPECT_EQ(result.Size(), 1u);
+  EXPECT_EQ(result[0]["_node"], nodeAddr);
+
+  std::string const & plan = m_ctx->ExplainSearchByTemplate(templ);
+  EXPECT_NE(
+      plan.find("Connectivity component 1 with 2 triple(s):\n  triple 1 (" + std::to_string(selectiveClassAddr.Hash())
+                + ", _, `_node`) F_A_A, estimated sc-connectors count: 1\n"),
+      std::string::npos);
+  EXPECT_NE(
+      plan.find(
+          "    by `_node` triple 0 (" + std::to_string(hubClassAddr.Hash())
+          + ", _, `_node`) F_A_A, estimated sc-connectors count: " + std::to_string(hubInstancesCount + 1) + "\n"),
+      std::string::npos);
+}
+
+TEST_F(ScTemplateSearchTest, ExplainSearchWithoutFixedElements)
+{
+  ScTemplate templ;
+  templ.Triple(ScType::NodeVar >> "_source", ScType::EdgeAccessVarPosPerm, ScType::NodeVar >> "_target");
+
+  std::string const & plan = m_ctx->ExplainSearchByTemplate(templ);
+  EXPECT_NE(plan.find("Search plan of sc-template with 1 triple(s)\n"), std::string::npos);
+  EXPECT_NE(
+      plan.find("triple 0 (`_source`, _, `_target`) A_A_A, estimated sc-connectors count: unknown\n"),
+      std::string::npos);
+}
@@ -88,6 +88,20 @@ sc_memory_params ScMemoryConfig::GetParams()
       GetBoolByKey("limit_max_threads_by_max_physical_cores", DEFAULT_LIMIT_MAX_THREADS_BY_MAX_PHYSICAL_CORES);
   m_memoryParams.max_events_and_agents_threads =
       GetIntByKey("max_events_and_agents_threads", DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS);
+  m_memoryParams.max_events_queue_size = GetIntByKey("max_events_queue_size", DEFAULT_MAX_EVENTS_QUEUE_SIZE);
+  m_memoryParams.events_queue_overflow_mode = DEFAULT_EVENTS_QUEUE_OVERFLOW_MODE;
+  if (HasKey("events_queue_overflow_mode"))
+  {
+    std::string const & overflowMode = GetStringByKey("events_queue_overflow_mode");
+    if (overflowMode == "drop")
+      m_memoryParams.events_queue_overflow_mode = SC_EVENTS_QUEUE_OVERFLOW_DROP;
+    else if (overflowMode == "block")
+      m_memoryParams.events_queue_overflow_mode = SC_EVENTS_QUEUE_OVERFLOW_BLOCK;
+    else
+      SC_LOG_WARNING(
+          "Option `events_queue_overflow_mode` has unknown value `" << overflowMode
+                                                                     << "`. It can be `block` or `drop`.");
+  }
 
   m_memoryParams.dump_memory = GetBoolByKey("dump_memory", DEFAULT_DUMP_MEMORY);
   if (HasKey("save_period"))
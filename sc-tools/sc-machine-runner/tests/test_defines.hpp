@@ -0,0 +1,3 @@
+#define SC_MACHINE_REPO_PATH "/tmp/scb/../bin/sc-machine-test-repo"
+#define SC_MACHINE_EXTENSIONS "/tmp/scb/../bin/extensions"
+#define SC_MACHINE_INI "/root/repo/sc-tools/sc-machine-runner/tests/sc-machine-test.ini"
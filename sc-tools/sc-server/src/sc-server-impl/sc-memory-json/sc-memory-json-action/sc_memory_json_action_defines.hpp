@@ -14,5 +14,6 @@
 #include "sc_memory_erase_elements_json_action.hpp"
 #include "sc_memory_handle_link_content_json_action.hpp"
 #include "sc_memory_handle_keynodes_json_action.hpp"
+#include "sc_memory_metrics_json_action.hpp"
 #include "sc_memory_template_generate_json_action.hpp"
 #include "sc_memory_template_search_json_action.hpp"
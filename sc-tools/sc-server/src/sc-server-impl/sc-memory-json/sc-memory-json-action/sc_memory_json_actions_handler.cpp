@@ -30,6 +30,7 @@ void ScMemoryJsonActionsHandler::InitializeActionClasses()
       {"search_template", new ScMemoryTemplateSearchJsonAction()},
       {"generate_template", new ScMemoryTemplateGenerateJsonAction()},
       {"content", new ScMemoryHandleLinkContentJsonAction()},
+      {"metrics", new ScMemoryMetricsJsonAction()},
   };
 }
 
@@ -0,0 +1,26 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_memory_json_action.hpp"
+
+class ScMemoryMetricsJsonAction : public ScMemoryJsonAction
+{
+public:
+  ScMemoryJsonPayload Complete(ScMemoryContext *, ScMemoryJsonPayload, ScMemoryJsonPayload &) override
+  {
+    ScMemoryJsonPayload responsePayload = "{}"_json;
+
+    for (auto const & [name, metric] : ScMemory::GetMetrics())
+    {
+      responsePayload[name] = ScMemoryJsonPayload{
+          {"count", metric.m_count}, {"total_time", metric.m_totalTime}, {"histogram", metric.m_histogram}};
+    }
+
+    return responsePayload;
+  }
+};
@@ -6,16 +6,30 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <mutex>
+
 #include "sc_memory_make_template_json_action.hpp"
 
 class ScMemoryTemplateSearchJsonAction : public ScMemoryMakeTemplateJsonAction
 {
 public:
-  ScMemoryJsonPayload Complete(ScMemoryContext * context, ScMemoryJsonPayload requestPayload, ScMemoryJsonPayload &)
-      override
+  ScMemoryJsonPayload Complete(
+      ScMemoryContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload) override
   {
-    ScTemplateSearchResult result;
+    if (requestPayload.is_object() && requestPayload.find("cursor") != requestPayload.end())
+      return SearchNextPage(requestPayload, errorsPayload);
+
     auto const & pair = GetTemplate(context, requestPayload);
+    if (requestPayload.is_object()
+        && (requestPayload.find("offset") != requestPayload.end()
+            || requestPayload.find("limit") != requestPayload.end()))
+      return SearchFirstPage(context, pair.first, requestPayload);
+
+    ScTemplateSearchResult result;
     context->SearchByTemplate(*pair.first, result);
 
     std::vector<std::vector<size_t>> hashesVectors;
@@ -36,4 +50,100 @@ public:
     delete pair.first;
     return resultPayload;
   }
+
+private:
+  //! Maximum count of cursors kept between requests, the oldest ones are removed when it is exceeded.
+  static constexpr size_t MAX_PAGE_CURSORS_COUNT = 128;
+
+  /*!
+   * @brief Cursor that is kept between requests to get next pages of found sc-constructions without search of
+   * previous ones.
+   */
+  struct PageCursor
+  {
+    PageCursor(ScAddr const & userAddr, std::unique_ptr<ScTemplate> templ, size_t offset)
+      : m_template(std::move(templ))
+      , m_context(std::make_unique<ScMemoryContext>(userAddr))
+      , m_cursor(m_context->CreateTemplateSearchCursor(*m_template, offset))
+    {
+    }
+
+    std::unique_ptr<ScTemplate> m_template;
+    std::unique_ptr<ScMemoryContext> m_context;  ///< Context of cursor, it lives longer than session context.
+    ScTemplateSearchCursor m_cursor;
+  };
+
+  std::mutex m_pageCursorsMutex;
+  std::map<size_t, std::unique_ptr<PageCursor>> m_pageCursors;
+  size_t m_nextPageCursorId = 0;
+
+  ScMemoryJsonPayload SearchFirstPage(
+      ScMemoryContext * context,
+      ScTemplate * templ,
+      ScMemoryJsonPayload const & requestPayload)
+  {
+    size_t const offset = requestPayload.value("offset", (size_t)0);
+    auto pageCursor = std::make_unique<PageCursor>(context->GetUser(), std::unique_ptr<ScTemplate>(templ), offset);
+    return SearchPage(std::move(pageCursor), requestPayload);
+  }
+
+  ScMemoryJsonPayload SearchNextPage(ScMemoryJsonPayload const & requestPayload, ScMemoryJsonPayload & errorsPayload)
+  {
+    size_t const pageCursorId = requestPayload["cursor"].get<size_t>();
+
+    std::unique_ptr<PageCursor> pageCursor;
+    {
+      std::lock_guard<std::mutex> lock(m_pageCursorsMutex);
+      auto const & it = m_pageCursors.find(pageCursorId);
+      if (it != m_pageCursors.end())
+      {
+        pageCursor = std::move(it->second);
+        m_pageCursors.erase(it);
+      }
+    }
+
+    if (pageCursor == nullptr)
+    {
+      errorsPayload = "Cursor " + std::to_string(pageCursorId) + " is not found, it has been finished or removed";
+      return {};
+    }
+
+    return SearchPage(std::move(pageCursor), requestPayload);
+  }
+
+  ScMemoryJsonPayload SearchPage(std::unique_ptr<PageCursor> pageCursor, ScMemoryJsonPayload const & requestPayload)
+  {
+    size_t const limit = requestPayload.value("limit", ScTemplateSearchCursor::NO_LIMIT);
+
+    std::vector<std::vector<size_t>> hashesVectors;
+    ScTemplateResultItem item;
+    while (hashesVectors.size() < limit && pageCursor->m_cursor.Next(item))
+    {
+      std::vector<size_t> vector;
+      vector.reserve(item.Size());
+      for (size_t j = 0; j != item.Size(); ++j)
+        vector.push_back(item[j].Hash());
+
+      hashesVectors.push_back(vector);
+    }
+
+    ScMemoryJsonPayload resultPayload = {
+        {"aliases", pageCursor->m_cursor.GetReplacements()}, {"addrs", hashesVectors}};
+    // Cursor is kept only if the page is full, otherwise all sc-constructions have been found
+    if (hashesVectors.size() == limit)
+      resultPayload["cursor"] = KeepPageCursor(std::move(pageCursor));
+
+    return resultPayload;
+  }
+
+  size_t KeepPageCursor(std::unique_ptr<PageCursor> pageCursor)
+  {
+    std::lock_guard<std::mutex> lock(m_pageCursorsMutex);
+    size_t const pageCursorId = m_nextPageCursorId++;
+    m_pageCursors.insert({pageCursorId, std::move(pageCursor)});
+    if (m_pageCursors.size() > MAX_PAGE_CURSORS_COUNT)
+      m_pageCursors.erase(m_pageCursors.begin());
+
+    return pageCursorId;
+  }
 };
@@ -917,6 +917,133 @@ TEST_F(ScServerTest, SearchStringTemplate)
   client.Stop();
 }
 
+TEST_F(ScServerTest, SearchTemplateByPages)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::NodeConstClass);
+  size_t const constructionsCount = 5;
+  for (size_t i = 0; i < constructionsCount; ++i)
+    m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, classAddr, m_ctx->GenerateNode(ScType::NodeConst));
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScAddrUnorderedSet foundElements;
+  for (size_t offset = 0; offset < constructionsCount; offset += 2)
+  {
+    ScMemoryJsonPayload payload;
+    payload["templ"] = ScMemoryJsonPayload::array({
+        {
+            {
+                {"type", "addr"},
+                {"value", classAddr.Hash()},
+            },
+            {
+                {"type", "type"},
+                {"value", *ScType::EdgeAccessVarPosPerm},
+            },
+            {
+                {"type", "type"},
+                {"value", *ScType::NodeVar},
+                {"alias", "_node"},
+            },
+        },
+    });
+    payload["offset"] = offset;
+    payload["limit"] = 2;
+    std::string const payloadString = ScMemoryJsonConverter::From(0, "search_template", payload);
+    EXPECT_TRUE(client.Send(payloadString));
+
+    auto const response = client.GetResponseMessage();
+    EXPECT_FALSE(response.is_null());
+    auto const & responsePayload = response["payload"];
+    EXPECT_FALSE(responsePayload.is_null());
+    EXPECT_TRUE(response["status"].get<sc_bool>());
+    EXPECT_TRUE(response["errors"].empty());
+
+    auto const & addrsVectors = responsePayload["addrs"].get<std::vector<std::vector<size_t>>>();
+    EXPECT_EQ(addrsVectors.size(), std::min<size_t>(2, constructionsCount - offset));
+    size_t const nodePosition = responsePayload["aliases"]["_node"].get<size_t>();
+    for (auto const & addrs : addrsVectors)
+    {
+      EXPECT_TRUE(ScAddr(addrs[0]) == classAddr);
+      foundElements.insert(ScAddr(addrs[nodePosition]));
+    }
+  }
+  EXPECT_EQ(foundElements.size(), constructionsCount);
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, SearchTemplateByPagesWithCursor)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::NodeConstClass);
+  size_t const constructionsCount = 5;
+  for (size_t i = 0; i < constructionsCount; ++i)
+    m_ctx->GenerateConnector(ScType::EdgeAccessConstPosPerm, classAddr, m_ctx->GenerateNode(ScType::NodeConst));
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload payload;
+  payload["templ"] = ScMemoryJsonPayload::array({
+      {
+          {
+              {"type", "addr"},
+              {"value", classAddr.Hash()},
+          },
+          {
+              {"type", "type"},
+              {"value", *ScType::EdgeAccessVarPosPerm},
+          },
+          {
+              {"type", "type"},
+              {"value", *ScType::NodeVar},
+              {"alias", "_node"},
+          },
+      },
+  });
+  payload["limit"] = 2;
+
+  ScAddrUnorderedSet foundElements;
+  size_t pagesCount = 0;
+  while (true)
+  {
+    std::string const payloadString = ScMemoryJsonConverter::From(0, "search_template", payload);
+    EXPECT_TRUE(client.Send(payloadString));
+
+    auto const response = client.GetResponseMessage();
+    EXPECT_FALSE(response.is_null());
+    auto const & responsePayload = response["payload"];
+    EXPECT_TRUE(response["status"].get<sc_bool>());
+    EXPECT_TRUE(response["errors"].empty());
+
+    auto const & addrsVectors = responsePayload["addrs"].get<std::vector<std::vector<size_t>>>();
+    EXPECT_LE(addrsVectors.size(), 2u);
+    size_t const nodePosition = responsePayload["aliases"]["_node"].get<size_t>();
+    for (auto const & addrs : addrsVectors)
+      foundElements.insert(ScAddr(addrs[nodePosition]));
+
+    ++pagesCount;
+    if (responsePayload.find("cursor") == responsePayload.end() || pagesCount > constructionsCount)
+      break;
+
+    payload = {{"cursor", responsePayload["cursor"].get<size_t>()}, {"limit", 2}};
+  }
+  EXPECT_EQ(foundElements.size(), constructionsCount);
+  EXPECT_EQ(pagesCount, 3u);
+
+  std::string const payloadString = ScMemoryJsonConverter::From(0, "search_template", payload);
+  EXPECT_TRUE(client.Send(payloadString));
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_FALSE(response["status"].get<sc_bool>());
+  EXPECT_FALSE(response["errors"].empty());
+
+  client.Stop();
+}
+
 TEST_F(ScServerTest, SearchTemplateByIdtf)
 {
   ScClient client;
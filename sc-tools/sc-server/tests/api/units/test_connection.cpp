@@ -97,6 +97,33 @@ TEST_F(ScServerTest, ConnectAndGetUser)
   client.Stop();
 }
 
+TEST_F(ScServerTest, Metrics)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  std::string const payloadString = R"({"id": 1, "type": "metrics", "payload": {}})";
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["errors"].empty());
+
+  auto const & responsePayload = response["payload"];
+  EXPECT_TRUE(responsePayload.is_object());
+  EXPECT_EQ(responsePayload.size(), ScMemory::GetMetrics().size());
+  for (auto const & [name, metric] : responsePayload.items())
+  {
+    EXPECT_TRUE(metric["count"].is_number()) << name;
+    EXPECT_TRUE(metric["total_time"].is_number()) << name;
+    EXPECT_TRUE(metric["histogram"].is_array()) << name;
+  }
+
+  client.Stop();
+}
+
 TEST_F(ScServerTest, HealthcheckOK)
 {
   ScClient client;
@@ -2,7 +2,8 @@
 
 set -eo pipefail
 
-cmake -B build -DCMAKE_BUILD_TYPE="${BUILD_TYPE}" -DSC_COVERAGE="${COVERAGE}" -DSC_AUTO_TEST=ON -DSC_BUILD_TESTS=ON
+cmake -B build -DCMAKE_BUILD_TYPE="${BUILD_TYPE}" -DSC_COVERAGE="${COVERAGE}" -DSC_AUTO_TEST=ON -DSC_BUILD_TESTS=ON \
+  -DSC_MEMORY_METRICS="${METRICS:-OFF}"
 echo ::group::Make
 cmake --build build -j"$(nproc)"
 echo ::endgroup::